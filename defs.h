@@ -5,6 +5,10 @@ struct inode;
 struct pipe;
 struct proc;
 struct rtcdate;
+struct runq;
+struct schedattr;
+struct schedstat;
+struct schedevent;
 struct spinlock;
 struct sleeplock;
 struct stat;
@@ -79,6 +83,8 @@ extern volatile uint*    lapic;
 void            lapiceoi(void);
 void            lapicinit(void);
 void            lapicstartap(uchar, uint);
+void            lapiconeshot(uint);
+void            lapicipi(int, int);
 void            microdelay(int);
 
 // log.c
@@ -121,11 +127,44 @@ int             wait(void);
 void            wakeup(void*);
 void            yield(void);
 int             setLotteryTicket(int, int);
+int             setProcTicket(int);
 int             changeQueue(int, int);
 int             setSRPFPriority(int, char*);
 int             printInfo(void);
-void            floatToStr(float,int, char*);
-float           strToFloat(char*);
+void            fixToStr(int, int, char*);
+int             strToFix(char*);
+int             configQueues(int, int*);
+int             schedtick(void);
+int             setQuantum(int, int);
+void            schedclock(void);
+void            getSchedStat(struct schedstat*);
+void            schedSeed(uint);
+int             setSchedAttr(int*, int, struct schedattr*);
+int             getSchedAttr(int, struct schedattr*);
+int             setAffinity(int, uint);
+int             getAffinity(int);
+int             gangJoin(int);
+int             setRealtime(int, int, int, int);
+int             takeresched(void);
+int             procslot(struct proc*);
+struct proc*    slotproc(int);
+uint64          cyclecount(void);
+
+// sched.c
+int             hrrnratio(struct proc*, uint);
+void            runqseed(struct runq*, int, uint);
+int             runqindex(struct proc*);
+int             slicelen(struct proc*);
+void            runqinsert(struct runq*, struct proc*);
+void            runqremove(struct runq*, struct proc*);
+struct proc*    runqpick(struct runq*);
+struct proc*    runqsteal(struct runq*, int);
+int             runqpreempts(struct proc*, struct proc*);
+void            runqdispatch(struct runq*, struct proc*);
+int             runqtick(struct runq*, struct proc*);
+void            runqblocked(struct runq*, struct proc*);
+void            runqclock(struct runq*, uint);
+
 // swtch.S
 void            swtch(struct context**, struct context*);
 
@@ -170,6 +209,12 @@ extern uint     ticks;
 void            tvinit(void);
 extern struct spinlock tickslock;
 
+// trace.c
+void            traceinit(void);
+void            traceevent(int, struct proc*, int, int);
+int             tracedropped(void);
+int             schedTrace(struct schedevent*, int);
+
 // uart.c
 void            uartinit(void);
 void            uartintr(void);
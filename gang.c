@@ -0,0 +1,25 @@
+// Run a command in a new gang, so that it and the children
+// it forks are scheduled together.
+// usage: gang command [arg...]
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+
+int
+main(int argc, char *argv[])
+{
+  int id;
+
+  if(argc < 2){
+    printf(2, "usage: gang command [arg...]\n");
+    exit();
+  }
+  if((id = gangJoin(0)) < 0){
+    printf(2, "gang: cannot create gang\n");
+    exit();
+  }
+  exec(argv[1], argv + 1);
+  printf(2, "gang: exec %s failed\n", argv[1]);
+  exit();
+}
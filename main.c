@@ -27,6 +27,7 @@ main(void)
   consoleinit();   // console hardware
   uartinit();      // serial port
   pinit();         // process table
+  traceinit();     // scheduler trace
   tvinit();        // trap vectors
   binit();         // buffer cache
   fileinit();      // file table
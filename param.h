@@ -1,6 +1,6 @@
 #define NPROC        64  // maximum number of processes
 #define KSTACKSIZE 4096  // size of per-process kernel stack
-#define NCPU          1  // maximum number of CPUs
+#define NCPU          8  // maximum number of CPUs
 #define NOFILE       16  // open files per process
 #define NFILE       100  // open files per system
 #define NINODE       50  // maximum number of active i-nodes
@@ -10,5 +10,16 @@
 #define MAXOPBLOCKS  10  // max # of blocks any FS op writes
 #define LOGSIZE      (MAXOPBLOCKS*3)  // max data blocks in on-disk log
 #define NBUF         (MAXOPBLOCKS*3)  // size of disk block cache
-#define FSSIZE       1000  // size of file system in blocks
+#define FSSIZE       2000  // size of file system in blocks
+#define NQUEUE        8  // maximum MLFQ queues, including fallback queue 0
+#define MAXTICKET   (NPROC*1000)  // most lottery tickets a process may hold
+#define MLFQ_ALLOT    5  // full time slices at a level before demotion
+#define MLFQ_STARVE 100  // ticks queued before a process is aged up a level
+#define MLFQ_AGEPERIOD 10  // ticks between aging passes
+#define NTRACE      256  // scheduler trace events buffered per CPU
+#define NSLEEPQ      64  // wait channel hash buckets
+#define NPIDHASH     64  // pid hash buckets
+#define DYNTICK       0  // 1: CPUs other than 0 tick only while running a process
+#define STRIDE        0  // 1: boot with stride instead of lottery on queue 1
+#define RTLIMIT     900  // thousandths of a CPU real-time processes may reserve
 
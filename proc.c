@@ -6,10 +6,55 @@
 #include "x86.h"
 #include "proc.h"
 #include "spinlock.h"
+#include "traps.h"
+
+// Locking. Instead of one lock over the whole process table:
+//
+//   p->lock    p's state, chan and killed, and its scheduling
+//              fields (mlfq, edf, affinity, gang, rqcpu) while it
+//              is not on a run queue.
+//   rq->lock   a CPU's run queue, and the scheduling fields of the
+//              processes on it. nqueue, queueclass and quantum are
+//              read under any run queue lock and changed under all.
+//   sleepq     each wait queue of sleeping processes has a lock.
+//   waitlock   parent, children and zombies of every process.
+//   rtlock     real-time admission: edf.runtime, deadline and cpu
+//              change under it as well as under p->lock.
+//   ganglock   lastgang and every CPU's gangnext.
+//   pidlock    the pid hash, the free list and nextpid.
+//
+// Locks are taken in this order: the lock passed to sleep(),
+// waitlock, rtlock, p->lock, then one of a sleepq lock, rq->lock
+// or ganglock, and pidlock last. Several proc locks are taken in
+// table order, several run queue locks in CPU order.
+//
+// Around a context switch: a process calls sched() holding its own
+// p->lock and no other lock, and scheduler() releases it once
+// swtch() is back. scheduler() takes a process off a run queue under
+// rq->lock, lets that go, then acquires p->lock, which waits for the
+// CPU that last ran p to finish switching away from it, and holds
+// it through swtch() into p; p releases it in yield(), sleep() or
+// forkret(). So whoever holds the lock of a process that is not
+// RUNNING knows it is on no CPU, which is what wakeup() relies on.
+
+// A wait queue; see sleep().
+struct sleepq {
+  struct spinlock lock;
+  struct proc *head;
+};
 
 struct {
-  struct spinlock lock;
   struct proc proc[NPROC];
+  struct runq rq[NCPU];
+  uint samples;               // Queue-length samples taken, see schedclock
+  struct spinlock waitlock;
+  struct spinlock rtlock;
+  struct spinlock ganglock;
+  int lastgang;               // Most recent gang id handed out
+  struct sleepq sleepq[NSLEEPQ];  // Sleeping processes, hashed by chan
+  struct spinlock pidlock;
+  struct proc *pidhash[NPIDHASH];  // Allocated processes, by pid
+  struct proc *freelist;      // UNUSED slots
 } ptable;
 
 static struct proc *initproc;
@@ -18,12 +63,28 @@ int nextpid = 1;
 extern void forkret(void);
 extern void trapret(void);
 
-static void wakeup1(void *chan);
+static int leastloaded(uint mask);
 
 void
 pinit(void)
 {
-  initlock(&ptable.lock, "ptable");
+  struct proc *p;
+  int i;
+
+  for(p = &ptable.proc[NPROC-1]; p >= ptable.proc; p--){
+    initlock(&p->lock, "proc");
+    p->hashnext = ptable.freelist;
+    ptable.freelist = p;
+  }
+  for(i = 0; i < NCPU; i++)
+    initlock(&ptable.rq[i].lock, "runq");
+  for(i = 0; i < NSLEEPQ; i++)
+    initlock(&ptable.sleepq[i].lock, "sleepq");
+  initlock(&ptable.waitlock, "wait");
+  initlock(&ptable.rtlock, "rt");
+  initlock(&ptable.ganglock, "gang");
+  initlock(&ptable.pidlock, "pid");
+  schedSeed(1);
 }
 
 // Must be called with interrupts disabled
@@ -65,9 +126,224 @@ myproc(void) {
   return p;
 }
 
+// Process table slot of p, and the process in slot i,
+// for scheduling classes that index by slot.
+int
+procslot(struct proc *p)
+{
+  return p - ptable.proc;
+}
+
+struct proc*
+slotproc(int i)
+{
+  return &ptable.proc[i];
+}
+
+// Time source for the cost of scheduling decisions.
+uint64
+cyclecount(void)
+{
+  return rdtsc();
+}
+
+// Lock and return the run queue p is on, or last ran from.
+// p->lock must be held, which keeps p->rqcpu still.
+static struct runq*
+lockrq(struct proc *p)
+{
+  struct runq *rq = &ptable.rq[p->rqcpu];
+
+  acquire(&rq->lock);
+  return rq;
+}
+
+// Lock every CPU's run queue, to change what they share.
+static void
+lockrqs(void)
+{
+  int i;
+
+  for(i = 0; i < NCPU; i++)
+    acquire(&ptable.rq[i].lock);
+}
+
+static void
+unlockrqs(void)
+{
+  int i;
+
+  for(i = NCPU-1; i >= 0; i--)
+    release(&ptable.rq[i].lock);
+}
+
+// New work was queued on CPU id. If that CPU is halted in
+// scheduler(), wake it; if it is busy running something else,
+// wake some halted CPU to steal the work instead. The lock of
+// CPU id's run queue must be held: scheduler() marks a CPU idle
+// under it, so the mark is seen here or the work is seen there.
+// A CPU that marked itself idle after failing to steal may still
+// miss the work, which then waits for its own CPU.
+static void
+kickidle(int id)
+{
+  // This CPU may be on its way to halting, interrupted
+  // between scheduler() giving up the lock and cli().
+  if(id == cpuid()){
+    cpus[id].idle = 0;
+    return;
+  }
+  if(!cpus[id].idle){
+    if(cpus[id].proc == 0)
+      return;
+    for(id = 0; id < ncpu; id++)
+      if(cpus[id].idle)
+        break;
+    if(id == ncpu)
+      return;
+  }
+  cpus[id].idle = 0;
+  lapicipi(cpus[id].apicid, T_IRQ0 + IRQ_RESCHED);
+}
+
+// Ask CPU k to go through scheduler() soon: this one at the
+// end of the current trap, another one by IPI.
+static void
+resched(int k)
+{
+  if(k == cpuid()){
+    cpus[k].resched = 1;
+    return;
+  }
+  if(cpus[k].idle)
+    cpus[k].idle = 0;
+  else
+    cpus[k].resched = 1;
+  lapicipi(cpus[k].apicid, T_IRQ0 + IRQ_RESCHED);
+}
+
+// Mark p RUNNABLE and queue it for the scheduler.
+// p->lock must be held.
+static void
+setrunnable(struct proc *p)
+{
+  struct runq *rq;
+  struct proc *cur;
+  int preempt;
+
+  p->state = RUNNABLE;
+  p->mlfq.readyTick = ticks;
+  // Requeue where it last ran, to find its cache warm,
+  // unless its affinity no longer allows that CPU.
+  if(!(p->affinity & (1 << p->rqcpu)))
+    p->rqcpu = leastloaded(p->affinity);
+  rq = lockrq(p);
+  runqinsert(rq, p);
+  kickidle(p->rqcpu);
+  // Take the CPU from a process on a lower queue now rather
+  // than at the end of its slice. cur is looked at without its
+  // lock, so this may at worst preempt it needlessly or late.
+  cur = cpus[p->rqcpu].proc;
+  preempt = cur && cur != p && cur->state == RUNNING && runqpreempts(p, cur);
+  release(&rq->lock);
+  if(preempt)
+    resched(p->rqcpu);
+}
+
+// Pass a class parameter to the class of p's queue in rq.
+// Returns -1 if that class takes no such parameter.
+// p->lock and the lock of rq, p's run queue, must be held.
+static int
+setschedparam(struct runq *rq, struct proc *p, int param, int value)
+{
+  int i = runqindex(p);
+
+  if(queueclass[i]->set_param == 0)
+    return -1;
+  return queueclass[i]->set_param(&rq->q[i], p, param, value);
+}
+
+// Return the CPU in mask with the fewest processes queued or
+// running, where a new or displaced process is placed.
+// The counts are read without locks, as a hint.
+static int
+leastloaded(uint mask)
+{
+  int i, best, load, bestload;
+
+  best = -1;
+  bestload = 0;
+  for(i = 0; i < ncpu; i++){
+    if(!(mask & (1 << i)))
+      continue;
+    load = ptable.rq[i].nready + (cpus[i].proc != 0);
+    if(best < 0 || load < bestload){
+      best = i;
+      bestload = load;
+    }
+  }
+  return best < 0 ? 0 : best;
+}
+
 //PAGEBREAK: 32
-// Look in the process table for an UNUSED proc.
-// If found, change state to EMBRYO and initialize
+// Process slots in use are indexed by pid in a hash table,
+// and unused ones are kept on a free list, so that neither
+// finding a process nor allocating one scans the table.
+// Both are guarded by pidlock.
+
+// The process with the given pid, or 0. It is not locked, so
+// it may exit and its slot be reused before the caller locks it.
+static struct proc*
+pidlookup(int pid)
+{
+  struct proc *p;
+
+  if(pid <= 0)
+    return 0;
+  acquire(&ptable.pidlock);
+  for(p = ptable.pidhash[pid % NPIDHASH]; p; p = p->hashnext)
+    if(p->pid == pid)
+      break;
+  release(&ptable.pidlock);
+  return p;
+}
+
+// The process with the given pid, locked, or 0.
+static struct proc*
+lockpid(int pid)
+{
+  struct proc *p;
+
+  if((p = pidlookup(pid)) == 0)
+    return 0;
+  acquire(&p->lock);
+  if(p->pid != pid || p->state == UNUSED){
+    release(&p->lock);
+    return 0;
+  }
+  return p;
+}
+
+// Return p, whose kernel stack and memory are already
+// freed, to the free list. p->lock must be held.
+static void
+freeproc(struct proc *p)
+{
+  struct proc **pp;
+
+  acquire(&ptable.pidlock);
+  for(pp = &ptable.pidhash[p->pid % NPIDHASH]; *pp != p; pp = &(*pp)->hashnext)
+    ;
+  *pp = p->hashnext;
+  p->pid = 0;
+  p->state = UNUSED;
+  p->hashnext = ptable.freelist;
+  ptable.freelist = p;
+  release(&ptable.pidlock);
+}
+
+// Take an UNUSED proc off the free list.
+// If there is one, change state to EMBRYO and initialize
 // state required to run in the kernel.
 // Otherwise return 0.
 static struct proc*
@@ -76,28 +352,39 @@ allocproc(void)
   struct proc *p;
   char *sp;
 
-  acquire(&ptable.lock);
-
-  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++)
-    if(p->state == UNUSED)
-      goto found;
+  acquire(&ptable.pidlock);
 
-  release(&ptable.lock);
-  return 0;
+  if((p = ptable.freelist) == 0){
+    release(&ptable.pidlock);
+    return 0;
+  }
+  ptable.freelist = p->hashnext;
 
-found:
   p->state = EMBRYO;
   p->pid = nextpid++;
-  cmostime(&(p->mlfq.arrivalTime));
+  p->hashnext = ptable.pidhash[p->pid % NPIDHASH];
+  ptable.pidhash[p->pid % NPIDHASH] = p;
+  p->mlfq.arrivalTime = ticks;
   p->mlfq.queueNumber = 1;
   p->mlfq.executedCycleNumber = 1;
-  p->mlfq.remainedPriority = 1;
+  p->mlfq.remainedPriority = FIXSCALE;
   p->mlfq.lotteryTicket = 10;
-  release(&ptable.lock);
+  p->mlfq.fullSlices = 0;
+  p->mlfq.pass = 0;
+  p->mlfq.quantum = 0;
+  p->mlfq.flags = 0;
+  p->affinity = ~0;
+  p->gang = 0;
+  p->edf.runtime = 0;
+  p->edf.misses = 0;
+  p->children = p->zombies = 0;
+  release(&ptable.pidlock);
 
   // Allocate kernel stack.
   if((p->kstack = kalloc()) == 0){
-    p->state = UNUSED;
+    acquire(&p->lock);
+    freeproc(p);
+    release(&p->lock);
     return 0;
   }
   sp = p->kstack + KSTACKSIZE;
@@ -159,11 +446,12 @@ userinit(void)
   // run this process. the acquire forces the above
   // writes to be visible, and the lock is also needed
   // because the assignment might not be atomic.
-  acquire(&ptable.lock);
+  acquire(&p->lock);
 
-  p->state = RUNNABLE;
+  p->rqcpu = leastloaded(p->affinity);
+  setrunnable(p);
 
-  release(&ptable.lock);
+  release(&p->lock);
 }
 
 // Grow current process's memory by n bytes.
@@ -187,6 +475,32 @@ growproc(int n)
   return 0;
 }
 
+// Each process keeps its children on two lists, live ones and
+// zombies, so that wait() and exit() look only at its own
+// children. waitlock must be held.
+
+static void
+siblingadd(struct proc **list, struct proc *p)
+{
+  p->sibprev = 0;
+  p->sibnext = *list;
+  if(*list)
+    (*list)->sibprev = p;
+  *list = p;
+}
+
+static void
+siblingdel(struct proc **list, struct proc *p)
+{
+  if(p->sibprev)
+    p->sibprev->sibnext = p->sibnext;
+  else
+    *list = p->sibnext;
+  if(p->sibnext)
+    p->sibnext->sibprev = p->sibprev;
+  p->sibnext = p->sibprev = 0;
+}
+
 // Create a new process copying p as the parent.
 // Sets up stack to return as if from system call.
 // Caller must set state of returned proc to RUNNABLE.
@@ -196,6 +510,9 @@ fork(void)
   int i, pid;
   struct proc *np;
   struct proc *curproc = myproc();
+  struct MLFQ mlfq;
+  uint affinity;
+  int gang;
 
   // Allocate process.
   if((np = allocproc()) == 0){
@@ -206,7 +523,9 @@ fork(void)
   if((np->pgdir = copyuvm(curproc->pgdir, curproc->sz)) == 0){
     kfree(np->kstack);
     np->kstack = 0;
-    np->state = UNUSED;
+    acquire(&np->lock);
+    freeproc(np);
+    release(&np->lock);
     return -1;
   }
 
@@ -219,7 +538,6 @@ fork(void)
   //----
 
   np->sz = curproc->sz;
-  np->parent = curproc;
   *np->tf = *curproc->tf;
 
   // Clear %eax so that fork returns 0 in the child.
@@ -234,11 +552,33 @@ fork(void)
 
   pid = np->pid;
 
-  acquire(&ptable.lock);
+  acquire(&curproc->lock);
+  mlfq = curproc->mlfq;
+  affinity = curproc->edf.runtime ? curproc->edf.affinity : curproc->affinity;
+  gang = curproc->gang;
+  release(&curproc->lock);
 
-  np->state = RUNNABLE;
+  acquire(&ptable.waitlock);
+  np->parent = curproc;
+  siblingadd(&curproc->children, np);
+  release(&ptable.waitlock);
+
+  acquire(&np->lock);
+
+  if(mlfq.flags & SAF_INHERIT){
+    np->mlfq.queueNumber = mlfq.queueNumber;
+    np->mlfq.lotteryTicket = mlfq.lotteryTicket;
+    np->mlfq.remainedPriority = mlfq.remainedPriority;
+    np->mlfq.quantum = mlfq.quantum;
+    np->mlfq.flags = mlfq.flags;
+  }
+  np->affinity = affinity;
+  np->gang = gang;
+  np->rqcpu = leastloaded(np->affinity);
+  traceevent(EV_FORK, np, curproc->pid, 0);
+  setrunnable(np);
 
-  release(&ptable.lock);
+  release(&np->lock);
 
   return pid;
 }
@@ -269,20 +609,33 @@ exit(void)
   end_op();
   curproc->cwd = 0;
 
-  acquire(&ptable.lock);
+  acquire(&ptable.waitlock);
 
   // Parent might be sleeping in wait().
-  wakeup1(curproc->parent);
+  siblingdel(&curproc->parent->children, curproc);
+  siblingadd(&curproc->parent->zombies, curproc);
+  wakeup(curproc->parent);
 
   // Pass abandoned children to init.
-  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
-    if(p->parent == curproc){
+  while((p = curproc->children) != 0){
+    siblingdel(&curproc->children, p);
+    p->parent = initproc;
+    siblingadd(&initproc->children, p);
+  }
+  if(curproc->zombies){
+    while((p = curproc->zombies) != 0){
+      siblingdel(&curproc->zombies, p);
       p->parent = initproc;
-      if(p->state == ZOMBIE)
-        wakeup1(initproc);
+      siblingadd(&initproc->zombies, p);
     }
+    wakeup(initproc);
   }
 
+  // The parent takes the zombie only once it can hold
+  // curproc->lock, which is after the switch below.
+  acquire(&curproc->lock);
+  release(&ptable.waitlock);
+
   // Jump into the scheduler, never to return.
   curproc->state = ZOMBIE;
   sched();
@@ -295,41 +648,36 @@ int
 wait(void)
 {
   struct proc *p;
-  int havekids, pid;
+  int pid;
   struct proc *curproc = myproc();
   
-  acquire(&ptable.lock);
+  acquire(&ptable.waitlock);
   for(;;){
-    // Scan through table looking for exited children.
-    havekids = 0;
-    for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
-      if(p->parent != curproc)
-        continue;
-      havekids = 1;
-      if(p->state == ZOMBIE){
-        // Found one.
-        pid = p->pid;
-        kfree(p->kstack);
-        p->kstack = 0;
-        freevm(p->pgdir);
-        p->pid = 0;
-        p->parent = 0;
-        p->name[0] = 0;
-        p->killed = 0;
-        p->state = UNUSED;
-        release(&ptable.lock);
-        return pid;
-      }
+    // Take an exited child, if there is one.
+    if((p = curproc->zombies) != 0){
+      siblingdel(&curproc->zombies, p);
+      acquire(&p->lock);
+      pid = p->pid;
+      kfree(p->kstack);
+      p->kstack = 0;
+      freevm(p->pgdir);
+      p->parent = 0;
+      p->name[0] = 0;
+      p->killed = 0;
+      freeproc(p);
+      release(&p->lock);
+      release(&ptable.waitlock);
+      return pid;
     }
 
     // No point waiting if we don't have any children.
-    if(!havekids || curproc->killed){
-      release(&ptable.lock);
+    if(curproc->children == 0 || curproc->killed){
+      release(&ptable.waitlock);
       return -1;
     }
 
-    // Wait for children to exit.  (See wakeup1 call in proc_exit.)
-    sleep(curproc, &ptable.lock);  //DOC: wait-sleep
+    // Wait for children to exit.  (See wakeup call in proc_exit.)
+    sleep(curproc, &ptable.waitlock);  //DOC: wait-sleep
   }
 }
 
@@ -378,197 +726,441 @@ wait(void)
 //   }
 // }
 
-unsigned long randstate = 1;
-unsigned int
-rand()
+//PAGEBREAK: 40
+// Gang scheduling. The members of a gang are dispatched together:
+// when a CPU picks one, gangrun() hands each other RUNNABLE member
+// to a CPU of its own and makes that CPU reschedule, and when one
+// member's slice ends, gangstop() ends its running peers' slices
+// too. Only idle CPUs and CPUs running processes outside any gang
+// are taken over, so gangs do not preempt each other. Other CPUs
+// and processes are looked at without their locks: the CPU a
+// member is sent to checks that it can still run there.
+
+// Gang of the process CPU k is running, 0 for none, or -1
+// if it is running nothing. cpus[k].proc is read just once,
+// as it may change under us.
+static int
+cpugang(int k)
 {
-  randstate = randstate * 1664525 + 1013904223;
-  return randstate;
+  struct proc *p = cpus[k].proc;
+
+  return p ? p->gang : -1;
 }
 
+// A CPU other than those in used where gang member p can run
+// now, idle ones first, or -1.
+static int
+gangcpu(struct proc *p, uint used)
+{
+  int k, best;
 
-int findLottery(){
-  struct proc *p;
-  struct proc *winner;
-  int ticketSum = 0;
-  int foundPid = -1;
-  
-  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
-    if(p->state != RUNNABLE)
-      continue;
-    if(p->mlfq.queueNumber != 1)
+  best = -1;
+  for(k = 0; k < ncpu; k++){
+    if((used & (1 << k)) || !(p->affinity & (1 << k)) || cpus[k].gangnext)
       continue;
-
-    ticketSum = ticketSum + p->mlfq.lotteryTicket;  
+    if(cpus[k].idle)
+      return k;
+    if(best < 0 && cpugang(k) == 0)
+      best = k;
   }
-  int selectedTicket;
-  if(ticketSum != 0){
-    selectedTicket = rand() % ticketSum;
-    for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
-      if(p->state != RUNNABLE)
-        continue;
-      if(p->mlfq.queueNumber != 1)
-        continue;
+  return best;
+}
 
-      if( (selectedTicket - p->mlfq.lotteryTicket) <= 0 ){
-        winner = p;
-        foundPid = winner->pid;
-        break;
-      }
-      else{
-        selectedTicket -= p->mlfq.lotteryTicket;
-        continue;
-      }
-    }
+// p, a gang member, has just been given this CPU:
+// bring in its RUNNABLE peers on other CPUs.
+static void
+gangrun(struct proc *p)
+{
+  struct proc *q;
+  uint used;
+  int k;
+
+  acquire(&ptable.ganglock);
+  used = 0;
+  for(k = 0; k < ncpu; k++)
+    if(cpugang(k) == p->gang ||
+       (cpus[k].gangnext && cpus[k].gangnext->gang == p->gang))
+      used |= 1 << k;
+  for(q = ptable.proc; q < &ptable.proc[NPROC]; q++){
+    // Real-time members run only when EDF picks them.
+    if(q == p || q->gang != p->gang || q->state != RUNNABLE ||
+       q->edf.runtime > 0)
+      continue;
+    if((k = gangcpu(q, used)) < 0)
+      break;
+    used |= 1 << k;
+    cpus[k].gangnext = q;
+    resched(k);
   }
-  return foundPid;
+  release(&ptable.ganglock);
 }
 
-int findHRRN(){
+// The gang member gangrun() sent to CPU c, locked and taken off
+// its run queue, if it is still queued and may run on c.
+static struct proc*
+gangtake(struct cpu *c)
+{
   struct proc *p;
-  
-  float maxHRRN = -1;
-  struct rtcdate currentTime;
-  int waitingTime;
-  float HRRN;
-  struct proc *winner;
-  int foundPid = -1;
-  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
-    if(p->state != RUNNABLE)
-      continue;
-    if(p->mlfq.queueNumber != 2)
-      continue;
+  struct runq *rq;
+  int queued;
 
-    cmostime(&currentTime);
-    waitingTime = (currentTime.second - p->mlfq.arrivalTime.second) + (currentTime.minute - p->mlfq.arrivalTime.minute)*60 + (currentTime.hour - p->mlfq.arrivalTime.hour)*3600;
-    HRRN = (float) waitingTime / (float) p->mlfq.executedCycleNumber;
-    if( HRRN > maxHRRN ){
-      maxHRRN = HRRN;
-      winner = p;
-      foundPid = winner->pid;
-    }
+  acquire(&ptable.ganglock);
+  p = c->gangnext;
+  c->gangnext = 0;
+  release(&ptable.ganglock);
+  if(p == 0)
+    return 0;
+
+  acquire(&p->lock);
+  queued = 0;
+  if(p->state == RUNNABLE && (p->affinity & (1 << (c - cpus))) &&
+     p->edf.runtime == 0){
+    rq = lockrq(p);
+    if((queued = p->rqnext != 0) != 0)
+      runqremove(rq, p);
+    release(&rq->lock);
   }
-  
-  return foundPid;
+  if(!queued){
+    release(&p->lock);
+    return 0;
+  }
+  return p;
 }
 
-int findSRPF(){
+// p's slice is over: end those of its gang's other running members.
+static void
+gangstop(struct proc *p)
+{
+  int k;
+
+  for(k = 0; k < ncpu; k++)
+    if(cpus[k].proc != p && cpugang(k) == p->gang)
+      resched(k);
+}
+
+// Put the caller in gang id, or in a new gang if id is 0, or
+// in none if id is negative. Children join their parent's gang.
+// Returns the gang id.
+int
+gangJoin(int id)
+{
   struct proc *p;
-  int foundPid = -1;
-  float minRemainedPriority = 500000;
-  struct proc *winner;
-  int repeatedMinNum = 1;
-  
-  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
-    if(p->state != RUNNABLE)
-        continue;
-    if(p->mlfq.queueNumber != 3)
+
+  if(id == 0){
+    acquire(&ptable.ganglock);
+    id = ++ptable.lastgang;
+    release(&ptable.ganglock);
+  } else if(id > 0){
+    for(p = ptable.proc; p < &ptable.proc[NPROC]; p++)
+      if(p->gang == id && p->state != UNUSED && p->state != ZOMBIE)
+        break;
+    if(p == &ptable.proc[NPROC])
+      return -1;
+  } else
+    id = 0;
+  p = myproc();
+  acquire(&p->lock);
+  p->gang = id;
+  release(&p->lock);
+  return id;
+}
+
+// Return the run queue of the CPU with the most queued
+// processes free to move, other than CPU self, or 0 if all
+// are empty. Bound processes count only to break ties, as
+// self may not be allowed to take them. The counts are read
+// without locks, as a hint.
+static struct runq*
+busiest(int self)
+{
+  struct runq *rq = 0, *r;
+  int i;
+
+  for(i = 0; i < ncpu; i++){
+    r = &ptable.rq[i];
+    if(i == self || r->nready == 0)
       continue;
+    if(rq == 0 || r->nready - r->nbound > rq->nready - rq->nbound ||
+       (r->nready - r->nbound == rq->nready - rq->nbound && r->nready > rq->nready))
+      rq = r;
+  }
+  return rq;
+}
+
+// Take a process for CPU id to run off a run queue: its own,
+// or else the busiest other CPU's. Returns it locked, still
+// RUNNABLE, or 0 after marking the CPU idle. The mark is made
+// under the CPU's run queue lock, after one more look at the
+// queue, so that whoever queues work here either is seen now
+// or sees the mark and kicks the CPU out of its halt.
+static struct proc*
+pickproc(int id)
+{
+  struct runq *rq = &ptable.rq[id], *victim;
+  struct proc *p;
 
-    // In order to select random between whose remained priority is the same, we always choose the first one.
+  acquire(&rq->lock);
+  if((p = runqpick(rq)) != 0)
+    runqremove(rq, p);
+  release(&rq->lock);
 
-    if(p->mlfq.remainedPriority < minRemainedPriority){
-      winner = p;
-      foundPid = winner->pid;
-      minRemainedPriority = winner->mlfq.remainedPriority;
-      repeatedMinNum = 1;
-    }
-    else if(p->mlfq.remainedPriority == minRemainedPriority){
-      repeatedMinNum++;
-    }
+  if(p == 0 && (victim = busiest(id)) != 0){
+    acquire(&victim->lock);
+    if((p = runqsteal(victim, id)) != 0)
+      runqremove(victim, p);
+    release(&victim->lock);
   }
 
-  if(repeatedMinNum != 1){
-    int randNum = (rand() % repeatedMinNum) +1;
-    for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
-      if((p->state == RUNNABLE) && (p->mlfq.queueNumber == 3) && (p->mlfq.remainedPriority == minRemainedPriority)){
-        if(randNum==1){
-          winner = p;
-          foundPid = winner->pid;
-          return foundPid;
-        }
-        randNum--;
-      }
-    }
+  if(p == 0){
+    acquire(&rq->lock);
+    if((p = runqpick(rq)) != 0)
+      runqremove(rq, p);
+    else
+      cpus[id].idle = 1;
+    release(&rq->lock);
   }
-  
-  return foundPid;
-}
 
+  // Off the queue, p can only be dispatched from here, but it
+  // may still be switching out on the CPU that queued it.
+  if(p)
+    acquire(&p->lock);
+  return p;
+}
 
 void
 scheduler(void)
 {
   struct proc *p;
+  struct runq *rq;
   struct cpu *c = mycpu();
+  int id = c - cpus;
+  int n;
   c->proc = 0;
-  int isThirdQueue = 0;
-  int foundPid = -1;
+
   for(;;){
     // Enable interrupts on this processor.
     sti();
 
-    // Loop over process table looking for process to run.
-    acquire(&ptable.lock);
+    // A gang member sent here by gangrun() goes first, then
+    // this CPU's own queues; when they are empty, steal from
+    // the busiest other CPU.
+    if((p = gangtake(c)) == 0 && (p = pickproc(id)) == 0){
+      // Nothing to run anywhere: halt until an interrupt
+      // instead of spinning. Anyone queueing work here or
+      // sending a gang member clears c->idle or sets
+      // c->gangnext before its IPI, so check both again with
+      // interrupts off right before halting.
+      // Keep ticking while real-time processes wait here
+      // for their next release.
+      n = ptable.rq[id].nready;
+      if(DYNTICK && id != 0)
+        lapiconeshot(n > 0);
+      cli();
+      if(c->idle && c->gangnext == 0)
+        stihlt();
+      c->idle = 0;
+      continue;
+    }
 
-    //---
+    // setAffinity() may have ruled this CPU out while p
+    // was between run queues.
+    if(!(p->affinity & (1 << id))){
+      setrunnable(p);
+      release(&p->lock);
+      continue;
+    }
 
+    // Switch to chosen process.  It is the process's job
+    // to release p->lock and then reacquire it
+    // before jumping back to us.
+    p->rqcpu = id;
+    rq = lockrq(p);
+    runqdispatch(rq, p);
+    release(&rq->lock);
+    traceevent(EV_DISPATCH, p, 0, 0);
+    c->proc = p;
+    c->resched = 0;
+    if(p->gang)
+      gangrun(p);
+    switchuvm(p);
+    p->state = RUNNING;
+    if(DYNTICK && id != 0)
+      lapiconeshot(1);
+
+    swtch(&(c->scheduler), p->context);
+    switchkvm();
+
+    // Process is done running for now.
+    // It should have changed its p->state before coming back.
+    c->proc = 0;
+    release(&p->lock);
+  }
+}
 
-    if( (foundPid = findLottery()) != -1) {
-      isThirdQueue = 0;
-    }
-    else if( (foundPid = findHRRN()) != -1) {
-      isThirdQueue = 0;
-    }
-    else if( (foundPid = findSRPF()) != -1) {
-      isThirdQueue = 1;
-    }
-    else{
-      for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
-        if(p->state != RUNNABLE)
-          continue;
-        c->proc = p;
-        switchuvm(p);
-        p->state = RUNNING;
-
-        swtch(&(c->scheduler), p->context);
-        switchkvm();
-        c->proc = 0;
-      }
-      release(&ptable.lock);
-      continue;
+//PAGEBREAK: 30
+// Called on every timer tick while a process runs.
+// Returns 1 once its slice is used up and it should yield.
+int
+schedtick(void)
+{
+  struct proc *p;
+  struct runq *rq;
+  int expired;
+
+  p = myproc();
+  acquire(&p->lock);
+  rq = lockrq(p);
+  expired = runqtick(rq, p);
+  release(&rq->lock);
+  if(expired && p->gang)
+    gangstop(p);
+  if(!expired && DYNTICK && cpuid() != 0)
+    lapiconeshot(1);
+  release(&p->lock);
+  return expired;
+}
+
+// Called at the end of a trap: whether this CPU was asked,
+// by resched(), to give up its process.
+int
+takeresched(void)
+{
+  int r;
+
+  pushcli();
+  r = mycpu()->resched;
+  mycpu()->resched = 0;
+  popcli();
+  return r;
+}
+
+// Set the time slice of MLFQ level queue (0 for the fallback).
+int
+setQuantum(int queue, int n)
+{
+  if(queue < 0 || queue >= NQUEUE || n < 1)
+    return -1;
+  lockrqs();
+  quantum[queue] = n;
+  unlockrqs();
+  return 0;
+}
+
+// Called from the timer interrupt on CPU 0: keep track of
+// the length of a tick, and every MLFQ_AGEPERIOD ticks sample
+// the queue lengths and age long-waiting processes.
+void
+schedclock(void)
+{
+  static uint64 last;
+  struct runq *rq;
+  uint64 c = cyclecount();
+  uint now = ticks;
+
+  // Smoothed, and written without the lock: a reader that sees
+  // a torn value only misjudges one compensation.
+  if(last)
+    tickcycles = tickcycles ? (3*tickcycles + (c - last)) >> 2 : c - last;
+  last = c;
+
+  if(now % MLFQ_AGEPERIOD != 0)
+    return;
+
+  ptable.samples++;
+  for(rq = ptable.rq; rq < &ptable.rq[ncpu]; rq++){
+    acquire(&rq->lock);
+    runqclock(rq, now);
+    release(&rq->lock);
+  }
+}
+
+// Reseed the random draws of every run queue, so that a run
+// started right after makes the same lottery and tie-break
+// choices each time.
+void
+schedSeed(uint seed)
+{
+  int i;
+
+  lockrqs();
+  for(i = 0; i < NCPU; i++)
+    runqseed(&ptable.rq[i], i, seed);
+  unlockrqs();
+}
+
+// Fill st with the scheduler statistics summed over all CPUs.
+void
+getSchedStat(struct schedstat *st)
+{
+  struct queuestat *from, *to;
+  int c, i, j;
+
+  memset(st, 0, sizeof(*st));
+  lockrqs();
+  st->ticks = ticks;
+  st->samples = ptable.samples;
+  st->nqueue = nqueue;
+  for(i = 0; i <= RTQUEUE; i++){
+    if(i == RTQUEUE)
+      to = &st->rt;
+    else {
+      for(j = 0; j < NSCHEDCLASS; j++)
+        if(queueclass[i] == schedclasses[j])
+          st->cls[i] = j;
+      to = &st->q[i];
     }
-    if(foundPid != -1){
-      for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
-        if(p->pid == foundPid){
-          c->proc = p;
-          c->proc->mlfq.executedCycleNumber+= 1;
-
-          if(isThirdQueue == 1){
-            if( (c->proc->mlfq.remainedPriority - 0.1) < 0)
-              c->proc->mlfq.remainedPriority = 0;
-            else  
-              c->proc->mlfq.remainedPriority = c->proc->mlfq.remainedPriority - 0.1;
-          }
-          break;
-        }
-      } 
-      switchuvm(p);
-      p->state = RUNNING;
-
-      swtch(&(c->scheduler), p->context);
-      switchkvm();
-      // Process is done running for now.
-      // It should have changed its p->state before coming back.
-      c->proc = 0;
+    for(c = 0; c < ncpu; c++){
+      from = &ptable.rq[c].stat[i];
+      to->dispatches += from->dispatches;
+      to->runticks += from->runticks;
+      to->preemptions += from->preemptions;
+      to->yields += from->yields;
+      to->lensum += from->lensum;
+      if(from->lenmax > to->lenmax)
+        to->lenmax = from->lenmax;
+      for(j = 0; j < NLATBUCKET; j++)
+        to->latency[j] += from->latency[j];
     }
-    release(&ptable.lock);  
   }
+  unlockrqs();
 }
 
+// Rebind the MLFQ: n levels, level i+1 run by class classes[i].
+// Every queued process is taken off and requeued under the new
+// binding, so each class sees only processes it enqueued.
+int
+configQueues(int n, int *classes)
+{
+  struct proc *queued[NPROC];
+  struct runq *rq;
+  int i, j, nq;
 
+  if(n < 1 || n >= NQUEUE)
+    return -1;
+  for(i = 0; i < n; i++)
+    if(classes[i] < 0 || classes[i] >= NSCHEDCLASS)
+      return -1;
 
-// Enter scheduler.  Must hold only ptable.lock
+  lockrqs();
+  nq = 0;
+  for(rq = ptable.rq; rq < &ptable.rq[ncpu]; rq++){
+    for(j = 0; j <= nqueue; j++){
+      while(rq->q[j].head){
+        queued[nq] = rq->q[j].head;
+        runqremove(rq, queued[nq++]);
+      }
+    }
+  }
+  nqueue = n;
+  for(i = 0; i < n; i++)
+    queueclass[i+1] = schedclasses[classes[i]];
+  for(j = 0; j < nq; j++)
+    runqinsert(&ptable.rq[queued[j]->rqcpu], queued[j]);
+  unlockrqs();
+  return 0;
+}
+
+// Enter scheduler.  Must hold only p->lock
 // and have changed proc->state. Saves and restores
 // intena because intena is a property of this
 // kernel thread, not this CPU. It should
@@ -581,14 +1173,16 @@ sched(void)
   int intena;
   struct proc *p = myproc();
 
-  if(!holding(&ptable.lock))
-    panic("sched ptable.lock");
+  if(!holding(&p->lock))
+    panic("sched p->lock");
   if(mycpu()->ncli != 1)
     panic("sched locks");
   if(p->state == RUNNING)
     panic("sched running");
   if(readeflags()&FL_IF)
     panic("sched interruptible");
+  traceevent(EV_DESCHED, p, 0, p->state == SLEEPING ? EVR_SLEEP :
+             p->state == ZOMBIE ? EVR_EXIT : EVR_PREEMPT);
   intena = mycpu()->intena;
   swtch(&p->context, mycpu()->scheduler);
   mycpu()->intena = intena;
@@ -598,10 +1192,12 @@ sched(void)
 void
 yield(void)
 {
-  acquire(&ptable.lock);  //DOC: yieldlock
-  myproc()->state = RUNNABLE;
+  struct proc *p = myproc();
+
+  acquire(&p->lock);  //DOC: yieldlock
+  setrunnable(p);
   sched();
-  release(&ptable.lock);
+  release(&p->lock);
 }
 
 // A fork child's very first scheduling by scheduler()
@@ -610,8 +1206,8 @@ void
 forkret(void)
 {
   static int first = 1;
-  // Still holding ptable.lock from scheduler.
-  release(&ptable.lock);
+  // Still holding p->lock from scheduler.
+  release(&myproc()->lock);
 
   if (first) {
     // Some initialization functions must be run in the context
@@ -624,12 +1220,64 @@ forkret(void)
   // Return to "caller", actually trapret (see allocproc).
 }
 
+// Sleeping processes wait on one of NSLEEPQ queues, chosen by
+// hashing chan, so that a wakeup looks only at processes that
+// may be sleeping on its channel. Each queue has its own lock.
+
+static struct sleepq*
+sleepq(void *chan)
+{
+  return &ptable.sleepq[(((uint)chan * 0x9e3779b1) >> 16) % NSLEEPQ];
+}
+
+// Unlink p from q. q->lock must be held.
+static void
+sleepqunlink(struct sleepq *q, struct proc *p)
+{
+  if(p->slprev)
+    p->slprev->slnext = p->slnext;
+  else
+    q->head = p->slnext;
+  if(p->slnext)
+    p->slnext->slprev = p->slprev;
+  p->slnext = p->slprev = 0;
+}
+
+// Queue p to wait on p->chan. p->lock must be held.
+static void
+sleepqadd(struct proc *p)
+{
+  struct sleepq *q = sleepq(p->chan);
+
+  acquire(&q->lock);
+  p->slprev = 0;
+  p->slnext = q->head;
+  if(q->head)
+    q->head->slprev = p;
+  q->head = p;
+  release(&q->lock);
+}
+
+// Take p off the queue for p->chan, if a wakeup has not
+// already done so. p->lock must be held.
+static void
+sleepqdel(struct proc *p)
+{
+  struct sleepq *q = sleepq(p->chan);
+
+  acquire(&q->lock);
+  if(p->slprev || q->head == p)
+    sleepqunlink(q, p);
+  release(&q->lock);
+}
+
 // Atomically release lock and sleep on chan.
 // Reacquires lock when awakened.
 void
 sleep(void *chan, struct spinlock *lk)
 {
   struct proc *p = myproc();
+  struct runq *rq;
   
   if(p == 0)
     panic("sleep");
@@ -637,19 +1285,23 @@ sleep(void *chan, struct spinlock *lk)
   if(lk == 0)
     panic("sleep without lk");
 
-  // Must acquire ptable.lock in order to
+  // Must acquire p->lock in order to
   // change p->state and then call sched.
-  // Once we hold ptable.lock, we can be
-  // guaranteed that we won't miss any wakeup
-  // (wakeup runs with ptable.lock locked),
+  // Once we hold p->lock and are on chan's
+  // wait queue, we can be guaranteed that we
+  // won't miss any wakeup (wakeup finds us on
+  // the queue, then waits for p->lock),
   // so it's okay to release lk.
-  if(lk != &ptable.lock){  //DOC: sleeplock0
-    acquire(&ptable.lock);  //DOC: sleeplock1
-    release(lk);
-  }
-  // Go to sleep.
+  acquire(&p->lock);  //DOC: sleeplock1
   p->chan = chan;
+  sleepqadd(p);
+  release(lk);
+
+  // Go to sleep.
   p->state = SLEEPING;
+  rq = lockrq(p);
+  runqblocked(rq, p);
+  release(&rq->lock);
 
   sched();
 
@@ -657,32 +1309,47 @@ sleep(void *chan, struct spinlock *lk)
   p->chan = 0;
 
   // Reacquire original lock.
-  if(lk != &ptable.lock){  //DOC: sleeplock2
-    release(&ptable.lock);
-    acquire(lk);
-  }
+  release(&p->lock);  //DOC: sleeplock2
+  acquire(lk);
 }
 
 //PAGEBREAK!
 // Wake up all processes sleeping on chan.
-// The ptable lock must be held.
-static void
-wakeup1(void *chan)
-{
-  struct proc *p;
-
-  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++)
-    if(p->state == SLEEPING && p->chan == chan)
-      p->state = RUNNABLE;
-}
-
-// Wake up all processes sleeping on chan.
+// Only the wait queue chan hashes to need be searched.
+// The sleepers are taken off it under its lock, then each
+// is woken under its own, once it has finished going to
+// sleep. One that was woken meanwhile by kill() and went
+// back to sleep on chan is woken again, which sleep()
+// callers allow for.
 void
 wakeup(void *chan)
 {
-  acquire(&ptable.lock);
-  wakeup1(chan);
-  release(&ptable.lock);
+  struct sleepq *q = sleepq(chan);
+  struct proc *woken[NPROC];
+  struct proc *p, *next;
+  int i, n;
+
+  n = 0;
+  acquire(&q->lock);
+  for(p = q->head; p; p = next){
+    next = p->slnext;
+    if(p->chan == chan){
+      sleepqunlink(q, p);
+      woken[n++] = p;
+    }
+  }
+  release(&q->lock);
+
+  for(i = 0; i < n; i++){
+    p = woken[i];
+    acquire(&p->lock);
+    if(p->state == SLEEPING && p->chan == chan){
+      sleepqdel(p);
+      traceevent(EV_WAKEUP, p, 0, 0);
+      setrunnable(p);
+    }
+    release(&p->lock);
+  }
 }
 
 // Kill the process with the given pid.
@@ -693,19 +1360,17 @@ kill(int pid)
 {
   struct proc *p;
 
-  acquire(&ptable.lock);
-  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
-    if(p->pid == pid){
-      p->killed = 1;
-      // Wake process from sleep if necessary.
-      if(p->state == SLEEPING)
-        p->state = RUNNABLE;
-      release(&ptable.lock);
-      return 0;
-    }
+  if((p = lockpid(pid)) == 0)
+    return -1;
+  p->killed = 1;
+  // Wake process from sleep if necessary.
+  if(p->state == SLEEPING){
+    sleepqdel(p);
+    traceevent(EV_WAKEUP, p, 0, 0);
+    setrunnable(p);
   }
-  release(&ptable.lock);
-  return -1;
+  release(&p->lock);
+  return 0;
 }
 
 //PAGEBREAK: 36
@@ -745,33 +1410,366 @@ procdump(void)
   }
 }
 
+// Put p on MLFQ level queueNumber, moving it over
+// if it is queued. p->lock must be held.
+static void
+movequeue(struct proc *p, int queueNumber)
+{
+  struct runq *rq = lockrq(p);
+
+  if(p->rqnext){
+    runqremove(rq, p);
+    p->mlfq.queueNumber = queueNumber;
+    runqinsert(rq, p);
+  } else
+    p->mlfq.queueNumber = queueNumber;
+  release(&rq->lock);
+  traceevent(EV_QUEUE, p, queueNumber, EVR_MANUAL);
+}
+
 int
 changeQueue(int pid, int queueNumber)
 {
   struct proc *p;
-  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
-   if(p->pid == pid) {
-     p->mlfq.queueNumber = queueNumber;
-     return 0;
-   }
-  }
-  return -1;
+
+  if((p = lockpid(pid)) == 0)
+    return -1;
+  movequeue(p, queueNumber);
+  release(&p->lock);
+  return 0;
 }
 
 int
 setLotteryTicket(int pid, int newTicket)
 {
   struct proc *p;
-  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
-   if((p->mlfq.queueNumber == 1) && (p->pid == pid)) {
-     p->mlfq.lotteryTicket = newTicket;
-     return 0;
-   }
+  struct runq *rq;
+  int r;
+
+  if((p = lockpid(pid)) == 0)
+    return -1;
+  rq = lockrq(p);
+  r = setschedparam(rq, p, SP_TICKETS, newTicket);
+  release(&rq->lock);
+  if(r == 0)
+    traceevent(EV_TICKET, p, newTicket, 0);
+  release(&p->lock);
+  return r;
+}
+
+// Set p's lottery tickets, through its class if that takes
+// them. p->lock must be held.
+static void
+setticket(struct proc *p, int newTicket)
+{
+  struct runq *rq = lockrq(p);
+
+  if(setschedparam(rq, p, SP_TICKETS, newTicket) < 0)
+    p->mlfq.lotteryTicket = newTicket;
+  release(&rq->lock);
+  traceevent(EV_TICKET, p, newTicket, 0);
+}
+
+// Set the current process's own lottery tickets,
+// whichever queue it is in. Returns -1 if newTicket
+// is outside 1..MAXTICKET, so that ticket sums fit in an int.
+int
+setProcTicket(int newTicket)
+{
+  struct proc *p = myproc();
+
+  if(newTicket < 1 || newTicket > MAXTICKET)
+    return -1;
+  acquire(&p->lock);
+  setticket(p, newTicket);
+  release(&p->lock);
+  return 0;
+}
+
+// Find the process with the given pid, 0 meaning the caller,
+// and return it locked.
+static struct proc*
+findproc(int pid)
+{
+  struct proc *p;
+
+  if(pid != 0)
+    return lockpid(pid);
+  p = myproc();
+  acquire(&p->lock);
+  return p;
+}
+
+// Set the fields of a selected by a->mask on p.
+// p->lock must be held.
+static void
+applyschedattr(struct proc *p, struct schedattr *a)
+{
+  struct runq *rq;
+
+  if(a->mask & SA_QUEUE)
+    movequeue(p, a->queue);
+  if(a->mask & SA_TICKETS)
+    setticket(p, a->tickets);
+  if(a->mask & SA_PRIORITY){
+    rq = lockrq(p);
+    if(setschedparam(rq, p, SP_PRIORITY, a->priority) < 0)
+      p->mlfq.remainedPriority = a->priority;
+    release(&rq->lock);
+    traceevent(EV_PRIORITY, p, a->priority, 0);
+  }
+  if(a->mask & SA_QUANTUM)
+    p->mlfq.quantum = a->quantum;
+  if(a->mask & SA_FLAGS)
+    p->mlfq.flags = a->flags;
+}
+
+// Whether p is among the first n of procs.
+static int
+inprocs(struct proc **procs, int n, struct proc *p)
+{
+  int i;
+
+  for(i = 0; i < n; i++)
+    if(procs[i] == p)
+      return 1;
+  return 0;
+}
+
+// Apply a to each of the n processes in pids at once: either
+// all of them exist and all change, or none does. Tickets must
+// be in 1..MAXTICKET and the queue in 0..nqueue.
+int
+setSchedAttr(int *pids, int n, struct schedattr *a)
+{
+  struct proc *procs[NPROC], *p;
+  int i, ok;
+
+  if(n < 1 || n > NPROC)
+    return -1;
+  if((a->mask & SA_PRIORITY) && a->priority < 0)
+    return -1;
+  if((a->mask & SA_QUANTUM) && a->quantum < 0)
+    return -1;
+  if((a->mask & SA_TICKETS) && (a->tickets < 1 || a->tickets > MAXTICKET))
+    return -1;
+  if((a->mask & SA_QUEUE) && (a->queue < 0 || a->queue > nqueue))
+    return -1;
+
+  for(i = 0; i < n; i++){
+    procs[i] = pids[i] == 0 ? myproc() : pidlookup(pids[i]);
+    if(procs[i] == 0)
+      return -1;
+  }
+  // Lock them all, in table order so that two calls cannot
+  // deadlock, then make sure none exited before it was locked.
+  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++)
+    if(inprocs(procs, n, p))
+      acquire(&p->lock);
+  ok = 1;
+  for(i = 0; i < n; i++)
+    if(procs[i]->state == UNUSED || (pids[i] != 0 && procs[i]->pid != pids[i]))
+      ok = 0;
+  for(i = 0; ok && i < n; i++)
+    applyschedattr(procs[i], a);
+  for(p = &ptable.proc[NPROC-1]; p >= ptable.proc; p--)
+    if(inprocs(procs, n, p))
+      release(&p->lock);
+  return ok ? 0 : -1;
+}
+
+int
+getSchedAttr(int pid, struct schedattr *a)
+{
+  struct proc *p;
+
+  if((p = findproc(pid)) == 0)
+    return -1;
+  a->mask = SA_QUEUE | SA_TICKETS | SA_PRIORITY | SA_QUANTUM | SA_FLAGS;
+  a->queue = p->mlfq.queueNumber;
+  a->tickets = p->mlfq.lotteryTicket;
+  a->priority = p->mlfq.remainedPriority;
+  a->quantum = p->mlfq.quantum;
+  a->flags = p->mlfq.flags;
+  release(&p->lock);
+  return 0;
+}
+
+// Take p off its run queue, if it is on one, before a change
+// that may move it to another; returns whether it was queued,
+// and so has to be put back with requeue(). p->lock must be held.
+static int
+dequeue(struct proc *p)
+{
+  struct runq *rq = lockrq(p);
+  int queued;
+
+  if((queued = p->rqnext != 0) != 0)
+    runqremove(rq, p);
+  release(&rq->lock);
+  return queued;
+}
+
+// Queue p again after dequeue(), on a CPU it may run on.
+static void
+requeue(struct proc *p)
+{
+  struct runq *rq;
+
+  if(!(p->affinity & (1 << p->rqcpu)))
+    p->rqcpu = leastloaded(p->affinity);
+  rq = lockrq(p);
+  runqinsert(rq, p);
+  kickidle(p->rqcpu);
+  release(&rq->lock);
+}
+
+// Restrict pid to the CPUs in mask, one bit per CPU.
+// Real-time processes stay where they were admitted.
+// A queued process on a CPU it may no longer use moves now;
+// a running one moves the next time it is queued.
+int
+setAffinity(int pid, uint mask)
+{
+  struct proc *p;
+  uint all = (1 << ncpu) - 1;
+
+  if((mask &= all) == 0)
+    return -1;
+  if(mask == all)
+    mask = ~0;
+
+  if((p = findproc(pid)) == 0)
+    return -1;
+  if(p->edf.runtime > 0){
+    release(&p->lock);
+    return -1;
   }
-  return -1;
+  if(dequeue(p)){
+    p->affinity = mask;
+    requeue(p);
+  } else
+    p->affinity = mask;
+  release(&p->lock);
+  return 0;
 }
 
-// Here is the disgusting part inorder to change float to string
+// CPUs pid may run on, or -1.
+int
+getAffinity(int pid)
+{
+  struct proc *p;
+  int mask;
+
+  if((p = findproc(pid)) == 0)
+    return -1;
+  mask = p->affinity & ((1 << ncpu) - 1);
+  release(&p->lock);
+  return mask;
+}
+
+//PAGEBREAK: 40
+// Real-time processes. Each is admitted on one CPU and stays
+// there, so that EDF on that CPU alone decides whether it
+// meets its deadlines. It is admitted only if the CPU's
+// real-time processes then need at most RTLIMIT thousandths
+// of it, counting runtime/deadline for each; this guarantees
+// their deadlines and leaves the rest for the MLFQ levels.
+
+// Thousandths of a CPU that runtime ticks in every deadline
+// ticks take, rounded up, for runtime <= deadline.
+static int
+rtshare(int runtime, int deadline)
+{
+  // Scale down until runtime*1000 fits an int, rounding
+  // so the share only grows.
+  while(deadline > 2000000){
+    deadline >>= 1;
+    runtime = (runtime + 1) >> 1;
+  }
+  return (runtime * 1000 + deadline - 1) / deadline;
+}
+
+// Thousandths of CPU cpu reserved by real-time processes
+// other than p. rtlock must be held.
+static int
+rtload(int cpu, struct proc *p)
+{
+  struct proc *q;
+  int load;
+
+  load = 0;
+  for(q = ptable.proc; q < &ptable.proc[NPROC]; q++)
+    if(q != p && q->state != UNUSED && q->state != ZOMBIE &&
+       q->edf.runtime > 0 && q->edf.cpu == cpu)
+      load += rtshare(q->edf.runtime, q->edf.deadline);
+  return load;
+}
+
+// Make pid real-time: each job needs runtime ticks within
+// deadline ticks of its release, and jobs come at most once
+// every period ticks. runtime 0 makes it an ordinary process
+// again. Returns the CPU it was admitted on, or -1 if no CPU
+// it may run on has room; 0 when making it ordinary.
+int
+setRealtime(int pid, int runtime, int period, int deadline)
+{
+  struct proc *p;
+  uint mask;
+  int cpu, k, need, load, best, queued;
+
+  if(runtime < 0 || (runtime > 0 &&
+     (deadline < runtime || period < deadline)))
+    return -1;
+
+  acquire(&ptable.rtlock);
+  if((p = findproc(pid)) == 0){
+    release(&ptable.rtlock);
+    return -1;
+  }
+  mask = p->edf.runtime ? p->edf.affinity : p->affinity;
+
+  // The CPU with the least real-time load that has room.
+  cpu = -1;
+  if(runtime > 0){
+    need = rtshare(runtime, deadline);
+    best = 0;
+    for(k = 0; k < ncpu; k++){
+      if(!(mask & (1 << k)))
+        continue;
+      load = rtload(k, p);
+      if(load + need <= RTLIMIT && (cpu < 0 || load < best)){
+        cpu = k;
+        best = load;
+      }
+    }
+    if(cpu < 0){
+      release(&p->lock);
+      release(&ptable.rtlock);
+      return -1;
+    }
+  }
+
+  queued = dequeue(p);
+  p->affinity = mask;
+  p->edf.runtime = runtime;
+  if(runtime > 0){
+    p->edf.period = period;
+    p->edf.deadline = deadline;
+    p->edf.cpu = cpu;
+    p->edf.affinity = mask;
+    p->edf.release = ticks - period;
+    p->edf.left = 0;
+    p->affinity = 1 << cpu;
+  }
+  if(queued)
+    requeue(p);
+  release(&p->lock);
+  release(&ptable.rtlock);
+  return runtime > 0 ? cpu : 0;
+}
+
+// Helpers to print and parse the fixed-point scheduler values
 
 void
 reverse(char* str, int len) 
@@ -808,40 +1806,49 @@ intToStr(int x, char str[], int d)
     return i; 
 } 
 
-void 
-floatToStr(float in, int afterpoint, char* res)
-{ 
-  int ipart = (int)in;
-  float fpart = in - (float)ipart; 
-  int i = intToStr(ipart, res, 0);
-  res[i] = '.'; // add dot 
-  for(int i = 0; i < afterpoint; i++){
-    fpart = fpart * 10; 
+// Write fixed-point x with afterpoint decimals into res.
+void
+fixToStr(int x, int afterpoint, char* res)
+{
+  int i = 0, d, scale = FIXSCALE;
+
+  if(x < 0){
+    res[i++] = '-';
+    x = -x;
   }
-  intToStr((int)fpart, res + i + 1, afterpoint);  
+  i += intToStr(x / FIXSCALE, res + i, 0);
+  res[i] = '.'; // add dot
+  for(d = 0; d < afterpoint && scale > 1; d++)
+    scale /= 10;
+  intToStr((x % FIXSCALE) / scale, res + i + 1, d);
 }
 
-float
-strToFloat(char* s)
+// Parse a decimal string such as "2.5" into fixed point.
+int
+strToFix(char* s)
 {
-  float rez = 0, fact = 1;
-  if (*s == '-'){
-    s++;
-    fact = -1;
-  };
-  for (int point_seen = 0; *s; s++){
-    if (*s == '.'){
-      point_seen = 1; 
-      continue;
-    };
-    int d = *s - '0';
-    if (d >= 0 && d <= 9){
-      if (point_seen) fact /= 10.0f;
-      rez = rez * 10.0f + (float)d;
-    };
-  };
-  return rez * fact;
+  int rez = 0, frac = 0, scale = FIXSCALE, neg = 0, d;
 
+  if(*s == '-'){
+    s++;
+    neg = 1;
+  }
+  for(; *s && *s != '.'; s++){
+    d = *s - '0';
+    if(d >= 0 && d <= 9)
+      rez = rez * 10 + d;
+  }
+  if(*s == '.'){
+    for(s++; *s && scale > 1; s++){
+      d = *s - '0';
+      if(d >= 0 && d <= 9){
+        scale /= 10;
+        frac += d * scale;
+      }
+    }
+  }
+  rez = rez * FIXSCALE + frac;
+  return neg ? -rez : rez;
 }
 
 
@@ -849,15 +1856,33 @@ int
 setSRPFPriority(int pid, char* newStrPriority)
 {
   struct proc *p;
-  float newPriority;
-  newPriority = strToFloat(newStrPriority);
-  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
-    if((p->mlfq.queueNumber == 3) && (p->pid == pid)) {
-      p->mlfq.remainedPriority = newPriority;
-      return 0;
-    }
+  struct runq *rq;
+  int newPriority, r;
+  newPriority = strToFix(newStrPriority);
+  if((p = lockpid(pid)) == 0)
+    return -1;
+  rq = lockrq(p);
+  r = setschedparam(rq, p, SP_PRIORITY, newPriority);
+  release(&rq->lock);
+  if(r == 0)
+    traceevent(EV_PRIORITY, p, newPriority, 0);
+  release(&p->lock);
+  return r;
+}
+
+// Mean TSC cycles per pick_next call of cls.
+static uint
+classcost(struct schedclass *cls)
+{
+  uint64 cycles = cls->cycles;
+  uint picks = cls->picks;
+
+  // Scale down so the division stays 32-bit.
+  while(cycles >> 32){
+    cycles >>= 1;
+    picks >>= 1;
   }
-  return -1;  
+  return picks ? (uint)cycles / picks : 0;
 }
 
 void
@@ -887,10 +1912,12 @@ printState(struct proc *p)
 }
 
 
+// Like procdump(), reads the table without locks, so a
+// process may show up halfway through a change.
 int
 printInfo(void)
 {
-  cprintf("name      pid  state     priority  ticket  queueNum  cycle  HRRN     createTime\n");
+  cprintf("name      pid  state     priority  ticket  queueNum  cycle  HRRN     createTick\n");
   cprintf("-------------------------------------------------------------------------------\n");
   
   struct proc *p;
@@ -902,13 +1929,13 @@ printInfo(void)
     for (int i = 0; i < 10 - size; i++)
       cprintf(" ");
     cprintf("%d",p->pid);
-    char buf[5];
+    char buf[16];
     intToStr(p->pid,buf,0);
     size = strlen(buf);
     for (int i = 0; i < 5 - size; i++)
       cprintf(" ");
     printState(p);
-    floatToStr(p->mlfq.remainedPriority,1,buf);
+    fixToStr(p->mlfq.remainedPriority,1,buf);
     cprintf("%s", buf);
     size = strlen(buf);
     for(int i = 0; i < 10 - size; i++)
@@ -928,22 +1955,30 @@ printInfo(void)
     size = strlen(buf);
     for (int i = 0; i < 7 - size; i++)
       cprintf(" ");
-    struct rtcdate currentTime;
-    int waitingTime;
-    float HRRN;
-    cmostime(&currentTime);
-    waitingTime = (currentTime.second - p->mlfq.arrivalTime.second) + (currentTime.minute - p->mlfq.arrivalTime.minute)*60 + (currentTime.hour - p->mlfq.arrivalTime.hour)*3600;
-    HRRN = (float) waitingTime /(float) p->mlfq.executedCycleNumber;
-    floatToStr(HRRN, 3, buf);
+    fixToStr(hrrnratio(p, ticks), 3, buf);
     cprintf("%s",buf);
     size = strlen(buf);
     for (int i = 0; i < 9 - size; i++)
       cprintf(" ");
 
-    cprintf("%d:%d:%d", p->mlfq.arrivalTime.hour, p->mlfq.arrivalTime.minute,p->mlfq.arrivalTime.second);
+    cprintf("%d", p->mlfq.arrivalTime);
     cprintf("\n");
   }
 
-  
+  cprintf("\nqueues (class/quantum):");
+  for(int i = 1; i <= nqueue; i++)
+    cprintf(" %d=%s/%d", i, queueclass[i]->name, quantum[i]);
+  cprintf(" fallback=%s/%d\n", queueclass[0]->name, quantum[0]);
+  for(int i = 0; i < NSCHEDCLASS; i++)
+    cprintf("%s: %d picks, %d cycles/pick\n", schedclasses[i]->name,
+            schedclasses[i]->picks, classcost(schedclasses[i]));
+  cprintf("trace: %d events dropped\n", tracedropped());
+
+  cprintf("\nreal-time (runtime/period/deadline, cpu, deadline misses):\n");
+  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++)
+    if(p->state != UNUSED && p->edf.runtime > 0)
+      cprintf("%s %d: %d/%d/%d cpu %d, %d missed\n", p->name, p->pid,
+              p->edf.runtime, p->edf.period, p->edf.deadline,
+              p->edf.cpu, p->edf.misses);
   return 0;
 }
@@ -1,4 +1,5 @@
-#include "date.h"
+#include "spinlock.h"
+#include "sched.h"
 
 // Per-CPU state
 struct cpu {
@@ -10,6 +11,9 @@ struct cpu {
   int ncli;                    // Depth of pushcli nesting.
   int intena;                  // Were interrupts enabled before pushcli?
   struct proc *proc;           // The process running on this cpu or null
+  volatile int idle;           // Halted in scheduler() waiting for work
+  volatile int resched;        // Another CPU wants this one to reschedule
+  struct proc *gangnext;       // Gang member to run next, see gangrun()
 };
 
 extern struct cpu cpus[NCPU];
@@ -36,18 +40,49 @@ struct context {
 
 enum procstate { UNUSED, EMBRYO, SLEEPING, RUNNABLE, RUNNING, ZOMBIE };
 
+// Scheduler values such as HRRN ratios and SRPF priorities are
+// fixed point, FIXSCALE units to 1.0, so the kernel never uses the FPU.
+#define FIXSCALE 1000
+
 struct MLFQ
 {
   int queueNumber;
   int lotteryTicket;
-  float remainedPriority;
-  struct rtcdate arrivalTime;
+  int remainedPriority;         // Fixed point, see FIXSCALE
+  uint arrivalTime;             // ticks when the process was created
   int executedCycleNumber;
+  int sliceLeft;                // Ticks left in the current time slice
+  int fullSlices;               // Slices run out at this level, for demotion
+  uint enqueueTick;             // ticks when last put on a run queue
+  uint readyTick;               // ticks when it last became RUNNABLE
+  uint pass;                    // Stride scheduling virtual time
+  int comp;                     // Lottery compensation, fixed point ticket multiplier, 0 for none
+  uint64 runStart;              // cyclecount() when last dispatched
+  int quantum;                  // Own time slice in ticks, 0 for the queue's
+  int flags;                    // SAF_*, see sched.h
+};
+
+// Real-time parameters, see setRealtime(). A job is released
+// when the process becomes RUNNABLE after blocking, at most
+// once per period, and must get runtime ticks of CPU by its
+// deadline. runtime 0 means the process is not real-time.
+struct EDF
+{
+  int runtime;                  // Ticks of CPU per job
+  int period;                   // Least ticks between job releases
+  int deadline;                 // Ticks from release to deadline
+  int cpu;                      // CPU it was admitted on
+  uint affinity;                // Affinity to restore when it stops being real-time
+  uint release;                 // ticks the current job was released
+  uint absdeadline;             // release + deadline
+  int left;                     // Runtime left in the current job, 0 between jobs
+  int misses;                   // Jobs that finished after their deadline
 };
 
 
 // Per-process state
 struct proc {
+  struct spinlock lock;        // See the locking notes in proc.c
   uint sz;                     // Size of process memory (bytes)
   pde_t* pgdir;                // Page table
   char *kstack;                // Bottom of kernel stack for this process
@@ -63,8 +98,87 @@ struct proc {
   char name[16];               // Process name (debugging)
   // ----------
   struct MLFQ mlfq;
+  struct EDF edf;
+  struct proc *rqnext;         // Run queue links, 0 while not queued
+  struct proc *rqprev;
+  int heapidx;                 // Index in the queue-3 heap, valid while queued there
+  int rqcpu;                   // CPU whose run queue holds p, or that last ran it
+  uint affinity;               // CPUs p may run on, bit per CPU; ~0 for any
+  int gang;                    // Gang scheduled with, 0 for none
+  struct proc *slnext;         // Wait queue links, valid while SLEEPING
+  struct proc *slprev;
+  struct proc *children;       // Live children
+  struct proc *zombies;        // Exited children not yet waited for
+  struct proc *sibnext;        // Links in the parent's children or zombies
+  struct proc *sibprev;
+  struct proc *hashnext;       // Next in the pid hash chain, or free list while UNUSED
 };
 
+//PAGEBREAK: 30
+// Parameters a scheduling class may accept through set_param.
+#define SP_TICKETS   1  // lottery tickets
+#define SP_PRIORITY  2  // SRPF remaining priority, fixed point
+
+// Binary min-heap of queued processes, for classes that
+// pick by a key. Each member remembers its index in heapidx.
+struct procheap {
+  struct proc *heap[NPROC];
+  int n;
+};
+
+// One MLFQ queue of a CPU's run queue.
+struct queue {
+  struct proc *head;           // Ring of RUNNABLE processes, oldest first
+  int n;                       // Processes on the ring
+  uint rng;                    // Random state for classes that draw
+  union {                      // Private to the queue's scheduling class
+    struct {
+      int tickets[NPROC+1];    // Fenwick tree of tickets, by slot+1
+      int sum;                 // Total tickets in the tree
+    } lottery;
+    struct procheap srpf;      // On remainedPriority
+    struct {
+      struct procheap h;       // On pass, of processes with tickets
+      uint pass;               // Pass of the last process picked
+    } stride;
+  } u;
+};
+
+// A scheduling class chooses among the RUNNABLE processes of
+// the queues bound to it. Every op but pick_next may be 0.
+// All are called with the lock of the queue's run queue held.
+struct schedclass {
+  char *name;
+  void (*enqueue)(struct queue*, struct proc*);  // p was added to q
+  void (*dequeue)(struct queue*, struct proc*);  // p is leaving q
+  struct proc* (*pick_next)(struct queue*);      // choose and charge; p stays queued
+  void (*tick)(struct queue*, struct proc*);     // timer tick while p runs
+  void (*block)(struct queue*, struct proc*);    // p blocks before its slice is over
+  int (*set_param)(struct queue*, struct proc*, int, int);  // SP_*, value
+  uint picks;                  // Calls to pick_next
+  uint64 cycles;               // TSC cycles spent in pick_next
+};
+
+// Per-CPU run queue. Every CPU schedules from its own
+// queues and only looks at another CPU's when idle.
+// Real-time processes have a queue of their own, RTQUEUE,
+// ahead of all the MLFQ levels.
+#define RTQUEUE NQUEUE
+
+struct runq {
+  struct spinlock lock;
+  struct queue q[NQUEUE+1];    // 0 is the fallback, 1..nqueue the MLFQ levels
+  int nready;                  // Processes on all of the queues
+  int nbound;                  // Of those, ones with an affinity mask
+  struct queuestat stat[NQUEUE+1];  // Per-queue counters, see sched.h
+};
+
+extern int nqueue;
+extern struct schedclass *queueclass[NQUEUE+1];
+extern uint64 tickcycles;
+extern int quantum[NQUEUE];
+extern struct schedclass *schedclasses[];
+
 // Process memory is laid out contiguously, low addresses first:
 //   text
 //   original data and bss
@@ -0,0 +1,1649 @@
+
+_runq:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  exit();
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+  struct schedattr a;
+  int pids[NPROC];
+  int i, n, inherit;
+
+  memset(&a, 0, sizeof(a));
+  inherit = -1;
+   e:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+{
+  13:	56                   	push   %esi
+  memset(&a, 0, sizeof(a));
+  14:	8d 85 d0 fe ff ff    	lea    -0x130(%ebp),%eax
+{
+  1a:	53                   	push   %ebx
+  for(i = 1; i < argc && argv[i][0] == '-'; i++){
+  1b:	bb 01 00 00 00       	mov    $0x1,%ebx
+{
+  20:	51                   	push   %ecx
+  21:	81 ec 3c 01 00 00    	sub    $0x13c,%esp
+  27:	8b 11                	mov    (%ecx),%edx
+  29:	8b 71 04             	mov    0x4(%ecx),%esi
+  2c:	89 95 c4 fe ff ff    	mov    %edx,-0x13c(%ebp)
+  memset(&a, 0, sizeof(a));
+  32:	6a 18                	push   $0x18
+  34:	6a 00                	push   $0x0
+  36:	50                   	push   %eax
+  37:	e8 a4 04 00 00       	call   4e0 <memset>
+  for(i = 1; i < argc && argv[i][0] == '-'; i++){
+  3c:	8b 95 c4 fe ff ff    	mov    -0x13c(%ebp),%edx
+  42:	83 c4 10             	add    $0x10,%esp
+  45:	83 fa 01             	cmp    $0x1,%edx
+  48:	7e 54                	jle    9e <main+0x9e>
+  4a:	8b 04 9e             	mov    (%esi,%ebx,4),%eax
+  4d:	8d 0c 9d 00 00 00 00 	lea    0x0(,%ebx,4),%ecx
+  54:	80 38 2d             	cmpb   $0x2d,(%eax)
+  57:	75 45                	jne    9e <main+0x9e>
+    switch(argv[i][1]){
+  59:	0f b6 40 01          	movzbl 0x1(%eax),%eax
+      // Change running processes rather than start one.
+      if(inherit >= 0){
+        a.mask |= SA_FLAGS;
+        a.flags = inherit ? SAF_INHERIT : 0;
+      }
+      for(n = 0, i++; i < argc && n < NPROC; i++)
+  5d:	83 c3 01             	add    $0x1,%ebx
+    switch(argv[i][1]){
+  60:	3c 69                	cmp    $0x69,%al
+  62:	0f 84 9e 00 00 00    	je     106 <main+0x106>
+  68:	3c 6e                	cmp    $0x6e,%al
+  6a:	74 2c                	je     98 <main+0x98>
+  6c:	3c 61                	cmp    $0x61,%al
+  6e:	0f 84 99 00 00 00    	je     10d <main+0x10d>
+        usage();
+      if(setSchedAttr(pids, n, &a) < 0)
+        printf(2, "runq: cannot set attributes\n");
+      exit();
+    }
+    if(i + 1 >= argc)
+  74:	39 da                	cmp    %ebx,%edx
+  76:	0f 8e 0d 01 00 00    	jle    189 <main+0x189>
+      usage();
+    switch(argv[i][1]){
+  7c:	83 e8 67             	sub    $0x67,%eax
+  7f:	3c 0d                	cmp    $0xd,%al
+  81:	0f 87 02 01 00 00    	ja     189 <main+0x189>
+  87:	0f b6 c0             	movzbl %al,%eax
+  8a:	ff 24 85 9c 0c 00 00 	jmp    *0xc9c(,%eax,4)
+  91:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      inherit = 0;
+  98:	31 ff                	xor    %edi,%edi
+  for(i = 1; i < argc && argv[i][0] == '-'; i++){
+  9a:	39 da                	cmp    %ebx,%edx
+  9c:	7f ac                	jg     4a <main+0x4a>
+      break;
+    default:
+      usage();
+    }
+  }
+  if(i == argc)
+  9e:	39 da                	cmp    %ebx,%edx
+  a0:	0f 84 e3 00 00 00    	je     189 <main+0x189>
+    usage();
+
+  // Set our own attributes and become the command.
+  a.mask |= SA_FLAGS;
+  a6:	83 8d d0 fe ff ff 10 	orl    $0x10,-0x130(%ebp)
+  a.flags = inherit == 0 ? 0 : SAF_INHERIT;
+  ad:	31 c0                	xor    %eax,%eax
+  af:	85 ff                	test   %edi,%edi
+  b1:	0f 95 c0             	setne  %al
+  pids[0] = 0;
+  b4:	31 c9                	xor    %ecx,%ecx
+  a.flags = inherit == 0 ? 0 : SAF_INHERIT;
+  b6:	89 85 e4 fe ff ff    	mov    %eax,-0x11c(%ebp)
+  if(setSchedAttr(pids, 1, &a) < 0){
+  bc:	8d 85 d0 fe ff ff    	lea    -0x130(%ebp),%eax
+  pids[0] = 0;
+  c2:	89 8d e8 fe ff ff    	mov    %ecx,-0x118(%ebp)
+  if(setSchedAttr(pids, 1, &a) < 0){
+  c8:	57                   	push   %edi
+  c9:	50                   	push   %eax
+  ca:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+  d0:	6a 01                	push   $0x1
+  d2:	50                   	push   %eax
+  d3:	e8 7b 06 00 00       	call   753 <setSchedAttr>
+  d8:	83 c4 10             	add    $0x10,%esp
+  db:	85 c0                	test   %eax,%eax
+  dd:	0f 88 88 01 00 00    	js     26b <main+0x26b>
+    printf(2, "runq: cannot set attributes\n");
+    exit();
+  }
+  exec(argv[i], argv + i);
+  e3:	8d 1c 9e             	lea    (%esi,%ebx,4),%ebx
+  e6:	50                   	push   %eax
+  e7:	50                   	push   %eax
+  e8:	53                   	push   %ebx
+  e9:	ff 33                	push   (%ebx)
+  eb:	e8 ab 05 00 00       	call   69b <exec>
+  printf(2, "runq: exec %s failed\n", argv[i]);
+  f0:	83 c4 0c             	add    $0xc,%esp
+  f3:	ff 33                	push   (%ebx)
+  f5:	68 a7 0b 00 00       	push   $0xba7
+  fa:	6a 02                	push   $0x2
+  fc:	e8 2f 07 00 00       	call   830 <printf>
+  exit();
+ 101:	e8 5d 05 00 00       	call   663 <exit>
+    switch(argv[i][1]){
+ 106:	bf 01 00 00 00       	mov    $0x1,%edi
+ 10b:	eb 8d                	jmp    9a <main+0x9a>
+      if(inherit >= 0){
+ 10d:	83 ff ff             	cmp    $0xffffffff,%edi
+ 110:	74 0d                	je     11f <main+0x11f>
+        a.mask |= SA_FLAGS;
+ 112:	83 8d d0 fe ff ff 10 	orl    $0x10,-0x130(%ebp)
+        a.flags = inherit ? SAF_INHERIT : 0;
+ 119:	89 bd e4 fe ff ff    	mov    %edi,-0x11c(%ebp)
+      for(n = 0, i++; i < argc && n < NPROC; i++)
+ 11f:	39 da                	cmp    %ebx,%edx
+ 121:	7e 66                	jle    189 <main+0x189>
+ 123:	8d 44 0e 04          	lea    0x4(%esi,%ecx,1),%eax
+ 127:	89 95 c0 fe ff ff    	mov    %edx,-0x140(%ebp)
+ 12d:	31 ff                	xor    %edi,%edi
+ 12f:	8d b5 e8 fe ff ff    	lea    -0x118(%ebp),%esi
+ 135:	89 85 c4 fe ff ff    	mov    %eax,-0x13c(%ebp)
+ 13b:	87 fb                	xchg   %edi,%ebx
+ 13d:	8d 76 00             	lea    0x0(%esi),%esi
+        pids[n++] = atoi(argv[i]);
+ 140:	8b 85 c4 fe ff ff    	mov    -0x13c(%ebp),%eax
+ 146:	83 ec 0c             	sub    $0xc,%esp
+ 149:	8b 04 98             	mov    (%eax,%ebx,4),%eax
+ 14c:	83 c3 01             	add    $0x1,%ebx
+ 14f:	50                   	push   %eax
+ 150:	e8 9b 04 00 00       	call   5f0 <atoi>
+      for(n = 0, i++; i < argc && n < NPROC; i++)
+ 155:	8b 8d c0 fe ff ff    	mov    -0x140(%ebp),%ecx
+ 15b:	83 c4 10             	add    $0x10,%esp
+        pids[n++] = atoi(argv[i]);
+ 15e:	89 44 9e fc          	mov    %eax,-0x4(%esi,%ebx,4)
+      for(n = 0, i++; i < argc && n < NPROC; i++)
+ 162:	8d 04 3b             	lea    (%ebx,%edi,1),%eax
+ 165:	39 c8                	cmp    %ecx,%eax
+ 167:	7d 05                	jge    16e <main+0x16e>
+ 169:	83 fb 3f             	cmp    $0x3f,%ebx
+ 16c:	7e d2                	jle    140 <main+0x140>
+      if(setSchedAttr(pids, n, &a) < 0)
+ 16e:	50                   	push   %eax
+ 16f:	8d 85 d0 fe ff ff    	lea    -0x130(%ebp),%eax
+ 175:	50                   	push   %eax
+ 176:	53                   	push   %ebx
+ 177:	56                   	push   %esi
+ 178:	e8 d6 05 00 00       	call   753 <setSchedAttr>
+ 17d:	83 c4 10             	add    $0x10,%esp
+ 180:	85 c0                	test   %eax,%eax
+ 182:	78 0a                	js     18e <main+0x18e>
+      exit();
+ 184:	e8 da 04 00 00       	call   663 <exit>
+      usage();
+ 189:	e8 52 02 00 00       	call   3e0 <usage>
+        printf(2, "runq: cannot set attributes\n");
+ 18e:	50                   	push   %eax
+ 18f:	50                   	push   %eax
+ 190:	68 8a 0b 00 00       	push   $0xb8a
+ 195:	6a 02                	push   $0x2
+ 197:	e8 94 06 00 00       	call   830 <printf>
+ 19c:	83 c4 10             	add    $0x10,%esp
+ 19f:	eb e3                	jmp    184 <main+0x184>
+ 1a1:	89 95 c4 fe ff ff    	mov    %edx,-0x13c(%ebp)
+      a.tickets = atoi(argv[++i]);
+ 1a7:	83 ec 0c             	sub    $0xc,%esp
+      a.mask |= SA_TICKETS;
+ 1aa:	83 8d d0 fe ff ff 02 	orl    $0x2,-0x130(%ebp)
+      a.tickets = atoi(argv[++i]);
+ 1b1:	ff 74 0e 04          	push   0x4(%esi,%ecx,1)
+ 1b5:	e8 36 04 00 00       	call   5f0 <atoi>
+      break;
+ 1ba:	8b 95 c4 fe ff ff    	mov    -0x13c(%ebp),%edx
+ 1c0:	83 c4 10             	add    $0x10,%esp
+      a.tickets = atoi(argv[++i]);
+ 1c3:	89 85 d8 fe ff ff    	mov    %eax,-0x128(%ebp)
+      break;
+ 1c9:	83 c3 01             	add    $0x1,%ebx
+ 1cc:	e9 c9 fe ff ff       	jmp    9a <main+0x9a>
+ 1d1:	89 95 c4 fe ff ff    	mov    %edx,-0x13c(%ebp)
+      a.quantum = atoi(argv[++i]);
+ 1d7:	83 ec 0c             	sub    $0xc,%esp
+      a.mask |= SA_QUANTUM;
+ 1da:	83 8d d0 fe ff ff 08 	orl    $0x8,-0x130(%ebp)
+      a.quantum = atoi(argv[++i]);
+ 1e1:	ff 74 0e 04          	push   0x4(%esi,%ecx,1)
+ 1e5:	e8 06 04 00 00       	call   5f0 <atoi>
+      break;
+ 1ea:	8b 95 c4 fe ff ff    	mov    -0x13c(%ebp),%edx
+ 1f0:	83 c4 10             	add    $0x10,%esp
+      a.quantum = atoi(argv[++i]);
+ 1f3:	89 85 e0 fe ff ff    	mov    %eax,-0x120(%ebp)
+      break;
+ 1f9:	eb ce                	jmp    1c9 <main+0x1c9>
+ 1fb:	89 95 c4 fe ff ff    	mov    %edx,-0x13c(%ebp)
+      a.queue = atoi(argv[++i]);
+ 201:	83 ec 0c             	sub    $0xc,%esp
+      a.mask |= SA_QUEUE;
+ 204:	83 8d d0 fe ff ff 01 	orl    $0x1,-0x130(%ebp)
+      a.queue = atoi(argv[++i]);
+ 20b:	ff 74 0e 04          	push   0x4(%esi,%ecx,1)
+ 20f:	e8 dc 03 00 00       	call   5f0 <atoi>
+      break;
+ 214:	8b 95 c4 fe ff ff    	mov    -0x13c(%ebp),%edx
+ 21a:	83 c4 10             	add    $0x10,%esp
+      a.queue = atoi(argv[++i]);
+ 21d:	89 85 d4 fe ff ff    	mov    %eax,-0x12c(%ebp)
+      break;
+ 223:	eb a4                	jmp    1c9 <main+0x1c9>
+ 225:	89 95 c4 fe ff ff    	mov    %edx,-0x13c(%ebp)
+      a.priority = thousandths(argv[++i]);
+ 22b:	83 ec 0c             	sub    $0xc,%esp
+      a.mask |= SA_PRIORITY;
+ 22e:	83 8d d0 fe ff ff 04 	orl    $0x4,-0x130(%ebp)
+      a.priority = thousandths(argv[++i]);
+ 235:	ff 74 0e 04          	push   0x4(%esi,%ecx,1)
+ 239:	e8 42 00 00 00       	call   280 <thousandths>
+      break;
+ 23e:	8b 95 c4 fe ff ff    	mov    -0x13c(%ebp),%edx
+ 244:	83 c4 10             	add    $0x10,%esp
+      a.priority = thousandths(argv[++i]);
+ 247:	89 85 dc fe ff ff    	mov    %eax,-0x124(%ebp)
+      break;
+ 24d:	e9 77 ff ff ff       	jmp    1c9 <main+0x1c9>
+      show(atoi(argv[i+1]));
+ 252:	83 ec 0c             	sub    $0xc,%esp
+ 255:	ff 74 0e 04          	push   0x4(%esi,%ecx,1)
+ 259:	e8 92 03 00 00       	call   5f0 <atoi>
+ 25e:	89 04 24             	mov    %eax,(%esp)
+ 261:	e8 8a 00 00 00       	call   2f0 <show>
+      exit();
+ 266:	e8 f8 03 00 00       	call   663 <exit>
+    printf(2, "runq: cannot set attributes\n");
+ 26b:	52                   	push   %edx
+ 26c:	52                   	push   %edx
+ 26d:	68 8a 0b 00 00       	push   $0xb8a
+ 272:	6a 02                	push   $0x2
+ 274:	e8 b7 05 00 00       	call   830 <printf>
+    exit();
+ 279:	e8 e5 03 00 00       	call   663 <exit>
+ 27e:	66 90                	xchg   %ax,%ax
+
+00000280 <thousandths>:
+{
+ 280:	55                   	push   %ebp
+ 281:	89 e5                	mov    %esp,%ebp
+ 283:	57                   	push   %edi
+ 284:	56                   	push   %esi
+ 285:	53                   	push   %ebx
+ 286:	83 ec 18             	sub    $0x18,%esp
+ 289:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  n = atoi(s) * 1000;
+ 28c:	53                   	push   %ebx
+ 28d:	e8 5e 03 00 00       	call   5f0 <atoi>
+ 292:	69 f0 e8 03 00 00    	imul   $0x3e8,%eax,%esi
+  if((s = strchr(s, '.')) == 0)
+ 298:	58                   	pop    %eax
+ 299:	5a                   	pop    %edx
+ 29a:	6a 2e                	push   $0x2e
+ 29c:	53                   	push   %ebx
+ 29d:	e8 5e 02 00 00       	call   500 <strchr>
+ 2a2:	83 c4 10             	add    $0x10,%esp
+ 2a5:	85 c0                	test   %eax,%eax
+ 2a7:	74 3c                	je     2e5 <thousandths+0x65>
+  for(s++, scale = 100; *s >= '0' && *s <= '9' && scale > 0; s++, scale /= 10)
+ 2a9:	0f b6 48 01          	movzbl 0x1(%eax),%ecx
+ 2ad:	8d 51 d0             	lea    -0x30(%ecx),%edx
+ 2b0:	80 fa 09             	cmp    $0x9,%dl
+ 2b3:	77 30                	ja     2e5 <thousandths+0x65>
+ 2b5:	8d 58 01             	lea    0x1(%eax),%ebx
+ 2b8:	ba 64 00 00 00       	mov    $0x64,%edx
+ 2bd:	bf cd cc cc cc       	mov    $0xcccccccd,%edi
+    n += (*s - '0') * scale;
+ 2c2:	83 e9 30             	sub    $0x30,%ecx
+  for(s++, scale = 100; *s >= '0' && *s <= '9' && scale > 0; s++, scale /= 10)
+ 2c5:	89 d0                	mov    %edx,%eax
+ 2c7:	83 c3 01             	add    $0x1,%ebx
+    n += (*s - '0') * scale;
+ 2ca:	0f be c9             	movsbl %cl,%ecx
+ 2cd:	0f af ca             	imul   %edx,%ecx
+  for(s++, scale = 100; *s >= '0' && *s <= '9' && scale > 0; s++, scale /= 10)
+ 2d0:	f7 e7                	mul    %edi
+    n += (*s - '0') * scale;
+ 2d2:	01 ce                	add    %ecx,%esi
+  for(s++, scale = 100; *s >= '0' && *s <= '9' && scale > 0; s++, scale /= 10)
+ 2d4:	0f b6 0b             	movzbl (%ebx),%ecx
+ 2d7:	c1 ea 03             	shr    $0x3,%edx
+ 2da:	8d 41 d0             	lea    -0x30(%ecx),%eax
+ 2dd:	3c 09                	cmp    $0x9,%al
+ 2df:	77 04                	ja     2e5 <thousandths+0x65>
+ 2e1:	85 d2                	test   %edx,%edx
+ 2e3:	75 dd                	jne    2c2 <thousandths+0x42>
+}
+ 2e5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 2e8:	89 f0                	mov    %esi,%eax
+ 2ea:	5b                   	pop    %ebx
+ 2eb:	5e                   	pop    %esi
+ 2ec:	5f                   	pop    %edi
+ 2ed:	5d                   	pop    %ebp
+ 2ee:	c3                   	ret
+ 2ef:	90                   	nop
+
+000002f0 <show>:
+{
+ 2f0:	55                   	push   %ebp
+ 2f1:	89 e5                	mov    %esp,%ebp
+ 2f3:	57                   	push   %edi
+ 2f4:	56                   	push   %esi
+  if(getSchedAttr(pid, &a) < 0){
+ 2f5:	8d 45 d0             	lea    -0x30(%ebp),%eax
+{
+ 2f8:	53                   	push   %ebx
+ 2f9:	83 ec 34             	sub    $0x34,%esp
+  if(getSchedAttr(pid, &a) < 0){
+ 2fc:	50                   	push   %eax
+ 2fd:	ff 75 08             	push   0x8(%ebp)
+ 300:	e8 56 04 00 00       	call   75b <getSchedAttr>
+ 305:	83 c4 10             	add    $0x10,%esp
+ 308:	85 c0                	test   %eax,%eax
+ 30a:	0f 88 a8 00 00 00    	js     3b8 <show+0xc8>
+  printf(1, "%d: queue %d tickets %d priority %d.%d%d%d slice %d%s\n",
+ 310:	f6 45 e4 01          	testb  $0x1,-0x1c(%ebp)
+ 314:	ba 58 0b 00 00       	mov    $0xb58,%edx
+ 319:	b8 75 0b 00 00       	mov    $0xb75,%eax
+         a.priority / 10 % 10, a.priority % 10, a.quantum,
+ 31e:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  printf(1, "%d: queue %d tickets %d priority %d.%d%d%d slice %d%s\n",
+ 321:	0f 45 c2             	cmovne %edx,%eax
+ 324:	83 ec 04             	sub    $0x4,%esp
+ 327:	be 67 66 66 66       	mov    $0x66666667,%esi
+ 32c:	89 cf                	mov    %ecx,%edi
+ 32e:	50                   	push   %eax
+ 32f:	89 c8                	mov    %ecx,%eax
+ 331:	c1 ff 1f             	sar    $0x1f,%edi
+ 334:	f7 ee                	imul   %esi
+ 336:	ff 75 e0             	push   -0x20(%ebp)
+ 339:	c1 fa 02             	sar    $0x2,%edx
+ 33c:	89 d3                	mov    %edx,%ebx
+ 33e:	89 ca                	mov    %ecx,%edx
+ 340:	29 fb                	sub    %edi,%ebx
+ 342:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+ 345:	01 c0                	add    %eax,%eax
+ 347:	29 c2                	sub    %eax,%edx
+ 349:	89 d8                	mov    %ebx,%eax
+ 34b:	52                   	push   %edx
+ 34c:	f7 ee                	imul   %esi
+ 34e:	89 d8                	mov    %ebx,%eax
+ 350:	c1 f8 1f             	sar    $0x1f,%eax
+ 353:	c1 fa 02             	sar    $0x2,%edx
+ 356:	29 c2                	sub    %eax,%edx
+ 358:	8d 04 92             	lea    (%edx,%edx,4),%eax
+ 35b:	01 c0                	add    %eax,%eax
+ 35d:	29 c3                	sub    %eax,%ebx
+         pid, a.queue, a.tickets, a.priority / 1000, a.priority / 100 % 10,
+ 35f:	b8 1f 85 eb 51       	mov    $0x51eb851f,%eax
+ 364:	f7 e9                	imul   %ecx
+  printf(1, "%d: queue %d tickets %d priority %d.%d%d%d slice %d%s\n",
+ 366:	53                   	push   %ebx
+         pid, a.queue, a.tickets, a.priority / 1000, a.priority / 100 % 10,
+ 367:	89 d3                	mov    %edx,%ebx
+ 369:	c1 fb 05             	sar    $0x5,%ebx
+ 36c:	29 fb                	sub    %edi,%ebx
+  printf(1, "%d: queue %d tickets %d priority %d.%d%d%d slice %d%s\n",
+ 36e:	89 d8                	mov    %ebx,%eax
+ 370:	f7 ee                	imul   %esi
+ 372:	89 d8                	mov    %ebx,%eax
+ 374:	c1 f8 1f             	sar    $0x1f,%eax
+ 377:	89 d6                	mov    %edx,%esi
+ 379:	c1 fe 02             	sar    $0x2,%esi
+ 37c:	29 c6                	sub    %eax,%esi
+ 37e:	8d 04 b6             	lea    (%esi,%esi,4),%eax
+ 381:	01 c0                	add    %eax,%eax
+ 383:	29 c3                	sub    %eax,%ebx
+ 385:	b8 d3 4d 62 10       	mov    $0x10624dd3,%eax
+ 38a:	f7 e9                	imul   %ecx
+ 38c:	53                   	push   %ebx
+ 38d:	c1 fa 06             	sar    $0x6,%edx
+ 390:	29 fa                	sub    %edi,%edx
+ 392:	52                   	push   %edx
+ 393:	ff 75 d8             	push   -0x28(%ebp)
+ 396:	ff 75 d4             	push   -0x2c(%ebp)
+ 399:	ff 75 08             	push   0x8(%ebp)
+ 39c:	68 c0 0b 00 00       	push   $0xbc0
+ 3a1:	6a 01                	push   $0x1
+ 3a3:	e8 88 04 00 00       	call   830 <printf>
+ 3a8:	83 c4 30             	add    $0x30,%esp
+}
+ 3ab:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 3ae:	5b                   	pop    %ebx
+ 3af:	5e                   	pop    %esi
+ 3b0:	5f                   	pop    %edi
+ 3b1:	5d                   	pop    %ebp
+ 3b2:	c3                   	ret
+ 3b3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 3b7:	90                   	nop
+    printf(2, "runq: no process %d\n", pid);
+ 3b8:	83 ec 04             	sub    $0x4,%esp
+ 3bb:	ff 75 08             	push   0x8(%ebp)
+ 3be:	68 61 0b 00 00       	push   $0xb61
+ 3c3:	6a 02                	push   $0x2
+ 3c5:	e8 66 04 00 00       	call   830 <printf>
+ 3ca:	83 c4 10             	add    $0x10,%esp
+}
+ 3cd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 3d0:	5b                   	pop    %ebx
+ 3d1:	5e                   	pop    %esi
+ 3d2:	5f                   	pop    %edi
+ 3d3:	5d                   	pop    %ebp
+ 3d4:	c3                   	ret
+ 3d5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000003e0 <usage>:
+{
+ 3e0:	55                   	push   %ebp
+ 3e1:	89 e5                	mov    %esp,%ebp
+ 3e3:	83 ec 10             	sub    $0x10,%esp
+  printf(2, "usage: runq [-q queue] [-t tickets] [-p priority] [-s slice] [-n] command [arg...]\n");
+ 3e6:	68 f8 0b 00 00       	push   $0xbf8
+ 3eb:	6a 02                	push   $0x2
+ 3ed:	e8 3e 04 00 00       	call   830 <printf>
+  printf(2, "       runq [-q queue] [-t tickets] [-p priority] [-s slice] [-i|-n] -a pid...\n");
+ 3f2:	58                   	pop    %eax
+ 3f3:	5a                   	pop    %edx
+ 3f4:	68 4c 0c 00 00       	push   $0xc4c
+ 3f9:	6a 02                	push   $0x2
+ 3fb:	e8 30 04 00 00       	call   830 <printf>
+  printf(2, "       runq -g pid\n");
+ 400:	59                   	pop    %ecx
+ 401:	58                   	pop    %eax
+ 402:	68 76 0b 00 00       	push   $0xb76
+ 407:	6a 02                	push   $0x2
+ 409:	e8 22 04 00 00       	call   830 <printf>
+  exit();
+ 40e:	e8 50 02 00 00       	call   663 <exit>
+ 413:	66 90                	xchg   %ax,%ax
+ 415:	66 90                	xchg   %ax,%ax
+ 417:	66 90                	xchg   %ax,%ax
+ 419:	66 90                	xchg   %ax,%ax
+ 41b:	66 90                	xchg   %ax,%ax
+ 41d:	66 90                	xchg   %ax,%ax
+ 41f:	90                   	nop
+
+00000420 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 420:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 421:	31 c0                	xor    %eax,%eax
+{
+ 423:	89 e5                	mov    %esp,%ebp
+ 425:	53                   	push   %ebx
+ 426:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 429:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 42c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 430:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 434:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 437:	83 c0 01             	add    $0x1,%eax
+ 43a:	84 d2                	test   %dl,%dl
+ 43c:	75 f2                	jne    430 <strcpy+0x10>
+    ;
+  return os;
+}
+ 43e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 441:	89 c8                	mov    %ecx,%eax
+ 443:	c9                   	leave
+ 444:	c3                   	ret
+ 445:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 44c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000450 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 450:	55                   	push   %ebp
+ 451:	89 e5                	mov    %esp,%ebp
+ 453:	53                   	push   %ebx
+ 454:	8b 55 08             	mov    0x8(%ebp),%edx
+ 457:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 45a:	0f b6 02             	movzbl (%edx),%eax
+ 45d:	84 c0                	test   %al,%al
+ 45f:	75 17                	jne    478 <strcmp+0x28>
+ 461:	eb 3a                	jmp    49d <strcmp+0x4d>
+ 463:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 467:	90                   	nop
+ 468:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 46c:	83 c2 01             	add    $0x1,%edx
+ 46f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 472:	84 c0                	test   %al,%al
+ 474:	74 1a                	je     490 <strcmp+0x40>
+    p++, q++;
+ 476:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 478:	0f b6 19             	movzbl (%ecx),%ebx
+ 47b:	38 c3                	cmp    %al,%bl
+ 47d:	74 e9                	je     468 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 47f:	29 d8                	sub    %ebx,%eax
+}
+ 481:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 484:	c9                   	leave
+ 485:	c3                   	ret
+ 486:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 48d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 490:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 494:	31 c0                	xor    %eax,%eax
+ 496:	29 d8                	sub    %ebx,%eax
+}
+ 498:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 49b:	c9                   	leave
+ 49c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 49d:	0f b6 19             	movzbl (%ecx),%ebx
+ 4a0:	31 c0                	xor    %eax,%eax
+ 4a2:	eb db                	jmp    47f <strcmp+0x2f>
+ 4a4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 4af:	90                   	nop
+
+000004b0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 4b0:	55                   	push   %ebp
+ 4b1:	89 e5                	mov    %esp,%ebp
+ 4b3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 4b6:	80 3a 00             	cmpb   $0x0,(%edx)
+ 4b9:	74 15                	je     4d0 <strlen+0x20>
+ 4bb:	31 c0                	xor    %eax,%eax
+ 4bd:	8d 76 00             	lea    0x0(%esi),%esi
+ 4c0:	83 c0 01             	add    $0x1,%eax
+ 4c3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 4c7:	89 c1                	mov    %eax,%ecx
+ 4c9:	75 f5                	jne    4c0 <strlen+0x10>
+    ;
+  return n;
+}
+ 4cb:	89 c8                	mov    %ecx,%eax
+ 4cd:	5d                   	pop    %ebp
+ 4ce:	c3                   	ret
+ 4cf:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 4d0:	31 c9                	xor    %ecx,%ecx
+}
+ 4d2:	5d                   	pop    %ebp
+ 4d3:	89 c8                	mov    %ecx,%eax
+ 4d5:	c3                   	ret
+ 4d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4dd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000004e0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 4e0:	55                   	push   %ebp
+ 4e1:	89 e5                	mov    %esp,%ebp
+ 4e3:	57                   	push   %edi
+ 4e4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 4e7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 4ea:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 4ed:	89 d7                	mov    %edx,%edi
+ 4ef:	fc                   	cld
+ 4f0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 4f2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 4f5:	89 d0                	mov    %edx,%eax
+ 4f7:	c9                   	leave
+ 4f8:	c3                   	ret
+ 4f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000500 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 500:	55                   	push   %ebp
+ 501:	89 e5                	mov    %esp,%ebp
+ 503:	8b 45 08             	mov    0x8(%ebp),%eax
+ 506:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 50a:	0f b6 10             	movzbl (%eax),%edx
+ 50d:	84 d2                	test   %dl,%dl
+ 50f:	75 12                	jne    523 <strchr+0x23>
+ 511:	eb 1d                	jmp    530 <strchr+0x30>
+ 513:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 517:	90                   	nop
+ 518:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 51c:	83 c0 01             	add    $0x1,%eax
+ 51f:	84 d2                	test   %dl,%dl
+ 521:	74 0d                	je     530 <strchr+0x30>
+    if(*s == c)
+ 523:	38 d1                	cmp    %dl,%cl
+ 525:	75 f1                	jne    518 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 527:	5d                   	pop    %ebp
+ 528:	c3                   	ret
+ 529:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 530:	31 c0                	xor    %eax,%eax
+}
+ 532:	5d                   	pop    %ebp
+ 533:	c3                   	ret
+ 534:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 53b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 53f:	90                   	nop
+
+00000540 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 540:	55                   	push   %ebp
+ 541:	89 e5                	mov    %esp,%ebp
+ 543:	57                   	push   %edi
+ 544:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 545:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 548:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 549:	31 db                	xor    %ebx,%ebx
+{
+ 54b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 54e:	eb 27                	jmp    577 <gets+0x37>
+    cc = read(0, &c, 1);
+ 550:	83 ec 04             	sub    $0x4,%esp
+ 553:	6a 01                	push   $0x1
+ 555:	56                   	push   %esi
+ 556:	6a 00                	push   $0x0
+ 558:	e8 1e 01 00 00       	call   67b <read>
+    if(cc < 1)
+ 55d:	83 c4 10             	add    $0x10,%esp
+ 560:	85 c0                	test   %eax,%eax
+ 562:	7e 1d                	jle    581 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 564:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 568:	8b 55 08             	mov    0x8(%ebp),%edx
+ 56b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 56f:	3c 0a                	cmp    $0xa,%al
+ 571:	74 10                	je     583 <gets+0x43>
+ 573:	3c 0d                	cmp    $0xd,%al
+ 575:	74 0c                	je     583 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 577:	89 df                	mov    %ebx,%edi
+ 579:	83 c3 01             	add    $0x1,%ebx
+ 57c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 57f:	7c cf                	jl     550 <gets+0x10>
+ 581:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 583:	8b 45 08             	mov    0x8(%ebp),%eax
+ 586:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 58a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 58d:	5b                   	pop    %ebx
+ 58e:	5e                   	pop    %esi
+ 58f:	5f                   	pop    %edi
+ 590:	5d                   	pop    %ebp
+ 591:	c3                   	ret
+ 592:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 599:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000005a0 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 5a0:	55                   	push   %ebp
+ 5a1:	89 e5                	mov    %esp,%ebp
+ 5a3:	56                   	push   %esi
+ 5a4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 5a5:	83 ec 08             	sub    $0x8,%esp
+ 5a8:	6a 00                	push   $0x0
+ 5aa:	ff 75 08             	push   0x8(%ebp)
+ 5ad:	e8 f1 00 00 00       	call   6a3 <open>
+  if(fd < 0)
+ 5b2:	83 c4 10             	add    $0x10,%esp
+ 5b5:	85 c0                	test   %eax,%eax
+ 5b7:	78 27                	js     5e0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 5b9:	83 ec 08             	sub    $0x8,%esp
+ 5bc:	ff 75 0c             	push   0xc(%ebp)
+ 5bf:	89 c3                	mov    %eax,%ebx
+ 5c1:	50                   	push   %eax
+ 5c2:	e8 f4 00 00 00       	call   6bb <fstat>
+  close(fd);
+ 5c7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 5ca:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 5cc:	e8 ba 00 00 00       	call   68b <close>
+  return r;
+ 5d1:	83 c4 10             	add    $0x10,%esp
+}
+ 5d4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 5d7:	89 f0                	mov    %esi,%eax
+ 5d9:	5b                   	pop    %ebx
+ 5da:	5e                   	pop    %esi
+ 5db:	5d                   	pop    %ebp
+ 5dc:	c3                   	ret
+ 5dd:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 5e0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 5e5:	eb ed                	jmp    5d4 <stat+0x34>
+ 5e7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5ee:	66 90                	xchg   %ax,%ax
+
+000005f0 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 5f0:	55                   	push   %ebp
+ 5f1:	89 e5                	mov    %esp,%ebp
+ 5f3:	53                   	push   %ebx
+ 5f4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 5f7:	0f be 02             	movsbl (%edx),%eax
+ 5fa:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 5fd:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 600:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 605:	77 1e                	ja     625 <atoi+0x35>
+ 607:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 60e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 610:	83 c2 01             	add    $0x1,%edx
+ 613:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 616:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 61a:	0f be 02             	movsbl (%edx),%eax
+ 61d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 620:	80 fb 09             	cmp    $0x9,%bl
+ 623:	76 eb                	jbe    610 <atoi+0x20>
+  return n;
+}
+ 625:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 628:	89 c8                	mov    %ecx,%eax
+ 62a:	c9                   	leave
+ 62b:	c3                   	ret
+ 62c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000630 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 630:	55                   	push   %ebp
+ 631:	89 e5                	mov    %esp,%ebp
+ 633:	57                   	push   %edi
+ 634:	56                   	push   %esi
+ 635:	8b 45 10             	mov    0x10(%ebp),%eax
+ 638:	8b 55 08             	mov    0x8(%ebp),%edx
+ 63b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 63e:	85 c0                	test   %eax,%eax
+ 640:	7e 13                	jle    655 <memmove+0x25>
+ 642:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 644:	89 d7                	mov    %edx,%edi
+ 646:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 64d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 650:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 651:	39 f8                	cmp    %edi,%eax
+ 653:	75 fb                	jne    650 <memmove+0x20>
+  return vdst;
+}
+ 655:	5e                   	pop    %esi
+ 656:	89 d0                	mov    %edx,%eax
+ 658:	5f                   	pop    %edi
+ 659:	5d                   	pop    %ebp
+ 65a:	c3                   	ret
+
+0000065b <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 65b:	b8 01 00 00 00       	mov    $0x1,%eax
+ 660:	cd 40                	int    $0x40
+ 662:	c3                   	ret
+
+00000663 <exit>:
+SYSCALL(exit)
+ 663:	b8 02 00 00 00       	mov    $0x2,%eax
+ 668:	cd 40                	int    $0x40
+ 66a:	c3                   	ret
+
+0000066b <wait>:
+SYSCALL(wait)
+ 66b:	b8 03 00 00 00       	mov    $0x3,%eax
+ 670:	cd 40                	int    $0x40
+ 672:	c3                   	ret
+
+00000673 <pipe>:
+SYSCALL(pipe)
+ 673:	b8 04 00 00 00       	mov    $0x4,%eax
+ 678:	cd 40                	int    $0x40
+ 67a:	c3                   	ret
+
+0000067b <read>:
+SYSCALL(read)
+ 67b:	b8 05 00 00 00       	mov    $0x5,%eax
+ 680:	cd 40                	int    $0x40
+ 682:	c3                   	ret
+
+00000683 <write>:
+SYSCALL(write)
+ 683:	b8 10 00 00 00       	mov    $0x10,%eax
+ 688:	cd 40                	int    $0x40
+ 68a:	c3                   	ret
+
+0000068b <close>:
+SYSCALL(close)
+ 68b:	b8 15 00 00 00       	mov    $0x15,%eax
+ 690:	cd 40                	int    $0x40
+ 692:	c3                   	ret
+
+00000693 <kill>:
+SYSCALL(kill)
+ 693:	b8 06 00 00 00       	mov    $0x6,%eax
+ 698:	cd 40                	int    $0x40
+ 69a:	c3                   	ret
+
+0000069b <exec>:
+SYSCALL(exec)
+ 69b:	b8 07 00 00 00       	mov    $0x7,%eax
+ 6a0:	cd 40                	int    $0x40
+ 6a2:	c3                   	ret
+
+000006a3 <open>:
+SYSCALL(open)
+ 6a3:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 6a8:	cd 40                	int    $0x40
+ 6aa:	c3                   	ret
+
+000006ab <mknod>:
+SYSCALL(mknod)
+ 6ab:	b8 11 00 00 00       	mov    $0x11,%eax
+ 6b0:	cd 40                	int    $0x40
+ 6b2:	c3                   	ret
+
+000006b3 <unlink>:
+SYSCALL(unlink)
+ 6b3:	b8 12 00 00 00       	mov    $0x12,%eax
+ 6b8:	cd 40                	int    $0x40
+ 6ba:	c3                   	ret
+
+000006bb <fstat>:
+SYSCALL(fstat)
+ 6bb:	b8 08 00 00 00       	mov    $0x8,%eax
+ 6c0:	cd 40                	int    $0x40
+ 6c2:	c3                   	ret
+
+000006c3 <link>:
+SYSCALL(link)
+ 6c3:	b8 13 00 00 00       	mov    $0x13,%eax
+ 6c8:	cd 40                	int    $0x40
+ 6ca:	c3                   	ret
+
+000006cb <mkdir>:
+SYSCALL(mkdir)
+ 6cb:	b8 14 00 00 00       	mov    $0x14,%eax
+ 6d0:	cd 40                	int    $0x40
+ 6d2:	c3                   	ret
+
+000006d3 <chdir>:
+SYSCALL(chdir)
+ 6d3:	b8 09 00 00 00       	mov    $0x9,%eax
+ 6d8:	cd 40                	int    $0x40
+ 6da:	c3                   	ret
+
+000006db <dup>:
+SYSCALL(dup)
+ 6db:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 6e0:	cd 40                	int    $0x40
+ 6e2:	c3                   	ret
+
+000006e3 <getpid>:
+SYSCALL(getpid)
+ 6e3:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 6e8:	cd 40                	int    $0x40
+ 6ea:	c3                   	ret
+
+000006eb <sbrk>:
+SYSCALL(sbrk)
+ 6eb:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 6f0:	cd 40                	int    $0x40
+ 6f2:	c3                   	ret
+
+000006f3 <sleep>:
+SYSCALL(sleep)
+ 6f3:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 6f8:	cd 40                	int    $0x40
+ 6fa:	c3                   	ret
+
+000006fb <uptime>:
+SYSCALL(uptime)
+ 6fb:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 700:	cd 40                	int    $0x40
+ 702:	c3                   	ret
+
+00000703 <setTicket>:
+SYSCALL(setTicket)
+ 703:	b8 16 00 00 00       	mov    $0x16,%eax
+ 708:	cd 40                	int    $0x40
+ 70a:	c3                   	ret
+
+0000070b <changeQueue>:
+SYSCALL(changeQueue)
+ 70b:	b8 17 00 00 00       	mov    $0x17,%eax
+ 710:	cd 40                	int    $0x40
+ 712:	c3                   	ret
+
+00000713 <setLotteryTicket>:
+SYSCALL(setLotteryTicket)
+ 713:	b8 18 00 00 00       	mov    $0x18,%eax
+ 718:	cd 40                	int    $0x40
+ 71a:	c3                   	ret
+
+0000071b <setSRPFPriority>:
+SYSCALL(setSRPFPriority)
+ 71b:	b8 19 00 00 00       	mov    $0x19,%eax
+ 720:	cd 40                	int    $0x40
+ 722:	c3                   	ret
+
+00000723 <printInfo>:
+SYSCALL(printInfo)
+ 723:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 728:	cd 40                	int    $0x40
+ 72a:	c3                   	ret
+
+0000072b <configQueues>:
+SYSCALL(configQueues)
+ 72b:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 730:	cd 40                	int    $0x40
+ 732:	c3                   	ret
+
+00000733 <setQuantum>:
+SYSCALL(setQuantum)
+ 733:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 738:	cd 40                	int    $0x40
+ 73a:	c3                   	ret
+
+0000073b <getSchedStat>:
+SYSCALL(getSchedStat)
+ 73b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 740:	cd 40                	int    $0x40
+ 742:	c3                   	ret
+
+00000743 <schedTrace>:
+SYSCALL(schedTrace)
+ 743:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 748:	cd 40                	int    $0x40
+ 74a:	c3                   	ret
+
+0000074b <schedSeed>:
+SYSCALL(schedSeed)
+ 74b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 750:	cd 40                	int    $0x40
+ 752:	c3                   	ret
+
+00000753 <setSchedAttr>:
+SYSCALL(setSchedAttr)
+ 753:	b8 20 00 00 00       	mov    $0x20,%eax
+ 758:	cd 40                	int    $0x40
+ 75a:	c3                   	ret
+
+0000075b <getSchedAttr>:
+SYSCALL(getSchedAttr)
+ 75b:	b8 21 00 00 00       	mov    $0x21,%eax
+ 760:	cd 40                	int    $0x40
+ 762:	c3                   	ret
+
+00000763 <setAffinity>:
+SYSCALL(setAffinity)
+ 763:	b8 22 00 00 00       	mov    $0x22,%eax
+ 768:	cd 40                	int    $0x40
+ 76a:	c3                   	ret
+
+0000076b <getAffinity>:
+SYSCALL(getAffinity)
+ 76b:	b8 23 00 00 00       	mov    $0x23,%eax
+ 770:	cd 40                	int    $0x40
+ 772:	c3                   	ret
+
+00000773 <gangJoin>:
+SYSCALL(gangJoin)
+ 773:	b8 24 00 00 00       	mov    $0x24,%eax
+ 778:	cd 40                	int    $0x40
+ 77a:	c3                   	ret
+
+0000077b <setRealtime>:
+SYSCALL(setRealtime)
+ 77b:	b8 25 00 00 00       	mov    $0x25,%eax
+ 780:	cd 40                	int    $0x40
+ 782:	c3                   	ret
+ 783:	66 90                	xchg   %ax,%ax
+ 785:	66 90                	xchg   %ax,%ax
+ 787:	66 90                	xchg   %ax,%ax
+ 789:	66 90                	xchg   %ax,%ax
+ 78b:	66 90                	xchg   %ax,%ax
+ 78d:	66 90                	xchg   %ax,%ax
+ 78f:	90                   	nop
+
+00000790 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 790:	55                   	push   %ebp
+ 791:	89 e5                	mov    %esp,%ebp
+ 793:	57                   	push   %edi
+ 794:	56                   	push   %esi
+ 795:	53                   	push   %ebx
+ 796:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 798:	89 d1                	mov    %edx,%ecx
+{
+ 79a:	83 ec 3c             	sub    $0x3c,%esp
+ 79d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 7a0:	85 d2                	test   %edx,%edx
+ 7a2:	0f 89 80 00 00 00    	jns    828 <printint+0x98>
+ 7a8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 7ac:	74 7a                	je     828 <printint+0x98>
+    x = -xx;
+ 7ae:	f7 d9                	neg    %ecx
+    neg = 1;
+ 7b0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 7b5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 7b8:	31 f6                	xor    %esi,%esi
+ 7ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 7c0:	89 c8                	mov    %ecx,%eax
+ 7c2:	31 d2                	xor    %edx,%edx
+ 7c4:	89 f7                	mov    %esi,%edi
+ 7c6:	f7 f3                	div    %ebx
+ 7c8:	8d 76 01             	lea    0x1(%esi),%esi
+ 7cb:	0f b6 92 34 0d 00 00 	movzbl 0xd34(%edx),%edx
+ 7d2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 7d6:	89 ca                	mov    %ecx,%edx
+ 7d8:	89 c1                	mov    %eax,%ecx
+ 7da:	39 da                	cmp    %ebx,%edx
+ 7dc:	73 e2                	jae    7c0 <printint+0x30>
+  if(neg)
+ 7de:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 7e1:	85 c0                	test   %eax,%eax
+ 7e3:	74 07                	je     7ec <printint+0x5c>
+    buf[i++] = '-';
+ 7e5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 7ea:	89 f7                	mov    %esi,%edi
+ 7ec:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 7ef:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 7f2:	01 df                	add    %ebx,%edi
+ 7f4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 7f8:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 7fb:	83 ec 04             	sub    $0x4,%esp
+ 7fe:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 801:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 804:	6a 01                	push   $0x1
+ 806:	50                   	push   %eax
+ 807:	56                   	push   %esi
+ 808:	e8 76 fe ff ff       	call   683 <write>
+  while(--i >= 0)
+ 80d:	89 f8                	mov    %edi,%eax
+ 80f:	83 c4 10             	add    $0x10,%esp
+ 812:	83 ef 01             	sub    $0x1,%edi
+ 815:	39 d8                	cmp    %ebx,%eax
+ 817:	75 df                	jne    7f8 <printint+0x68>
+}
+ 819:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 81c:	5b                   	pop    %ebx
+ 81d:	5e                   	pop    %esi
+ 81e:	5f                   	pop    %edi
+ 81f:	5d                   	pop    %ebp
+ 820:	c3                   	ret
+ 821:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 828:	31 c0                	xor    %eax,%eax
+ 82a:	eb 89                	jmp    7b5 <printint+0x25>
+ 82c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000830 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 830:	55                   	push   %ebp
+ 831:	89 e5                	mov    %esp,%ebp
+ 833:	57                   	push   %edi
+ 834:	56                   	push   %esi
+ 835:	53                   	push   %ebx
+ 836:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 839:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 83c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 83f:	0f b6 1e             	movzbl (%esi),%ebx
+ 842:	83 c6 01             	add    $0x1,%esi
+ 845:	84 db                	test   %bl,%bl
+ 847:	74 67                	je     8b0 <printf+0x80>
+ 849:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 84c:	31 d2                	xor    %edx,%edx
+ 84e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 851:	eb 34                	jmp    887 <printf+0x57>
+ 853:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 857:	90                   	nop
+ 858:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 85b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 860:	83 f8 25             	cmp    $0x25,%eax
+ 863:	74 18                	je     87d <printf+0x4d>
+  write(fd, &c, 1);
+ 865:	83 ec 04             	sub    $0x4,%esp
+ 868:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 86b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 86e:	6a 01                	push   $0x1
+ 870:	50                   	push   %eax
+ 871:	57                   	push   %edi
+ 872:	e8 0c fe ff ff       	call   683 <write>
+ 877:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 87a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 87d:	0f b6 1e             	movzbl (%esi),%ebx
+ 880:	83 c6 01             	add    $0x1,%esi
+ 883:	84 db                	test   %bl,%bl
+ 885:	74 29                	je     8b0 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 887:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 88a:	85 d2                	test   %edx,%edx
+ 88c:	74 ca                	je     858 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 88e:	83 fa 25             	cmp    $0x25,%edx
+ 891:	75 ea                	jne    87d <printf+0x4d>
+      if(c == 'd'){
+ 893:	83 f8 25             	cmp    $0x25,%eax
+ 896:	0f 84 24 01 00 00    	je     9c0 <printf+0x190>
+ 89c:	83 e8 63             	sub    $0x63,%eax
+ 89f:	83 f8 15             	cmp    $0x15,%eax
+ 8a2:	77 1c                	ja     8c0 <printf+0x90>
+ 8a4:	ff 24 85 dc 0c 00 00 	jmp    *0xcdc(,%eax,4)
+ 8ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 8af:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 8b0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 8b3:	5b                   	pop    %ebx
+ 8b4:	5e                   	pop    %esi
+ 8b5:	5f                   	pop    %edi
+ 8b6:	5d                   	pop    %ebp
+ 8b7:	c3                   	ret
+ 8b8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8bf:	90                   	nop
+  write(fd, &c, 1);
+ 8c0:	83 ec 04             	sub    $0x4,%esp
+ 8c3:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 8c6:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 8ca:	6a 01                	push   $0x1
+ 8cc:	52                   	push   %edx
+ 8cd:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 8d0:	57                   	push   %edi
+ 8d1:	e8 ad fd ff ff       	call   683 <write>
+ 8d6:	83 c4 0c             	add    $0xc,%esp
+ 8d9:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 8dc:	6a 01                	push   $0x1
+ 8de:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 8e1:	52                   	push   %edx
+ 8e2:	57                   	push   %edi
+ 8e3:	e8 9b fd ff ff       	call   683 <write>
+        putc(fd, c);
+ 8e8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 8eb:	31 d2                	xor    %edx,%edx
+ 8ed:	eb 8e                	jmp    87d <printf+0x4d>
+ 8ef:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 8f0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 8f3:	83 ec 0c             	sub    $0xc,%esp
+ 8f6:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 8fb:	8b 13                	mov    (%ebx),%edx
+ 8fd:	6a 00                	push   $0x0
+ 8ff:	89 f8                	mov    %edi,%eax
+        ap++;
+ 901:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 904:	e8 87 fe ff ff       	call   790 <printint>
+        ap++;
+ 909:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 90c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 90f:	31 d2                	xor    %edx,%edx
+ 911:	e9 67 ff ff ff       	jmp    87d <printf+0x4d>
+ 916:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 91d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 920:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 923:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 925:	83 c0 04             	add    $0x4,%eax
+ 928:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 92b:	85 db                	test   %ebx,%ebx
+ 92d:	0f 84 9d 00 00 00    	je     9d0 <printf+0x1a0>
+        while(*s != 0){
+ 933:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 936:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 938:	84 c0                	test   %al,%al
+ 93a:	0f 84 3d ff ff ff    	je     87d <printf+0x4d>
+ 940:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 943:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 946:	89 de                	mov    %ebx,%esi
+ 948:	89 d3                	mov    %edx,%ebx
+ 94a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 950:	83 ec 04             	sub    $0x4,%esp
+ 953:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 956:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 959:	6a 01                	push   $0x1
+ 95b:	53                   	push   %ebx
+ 95c:	57                   	push   %edi
+ 95d:	e8 21 fd ff ff       	call   683 <write>
+        while(*s != 0){
+ 962:	0f b6 06             	movzbl (%esi),%eax
+ 965:	83 c4 10             	add    $0x10,%esp
+ 968:	84 c0                	test   %al,%al
+ 96a:	75 e4                	jne    950 <printf+0x120>
+      state = 0;
+ 96c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 96f:	31 d2                	xor    %edx,%edx
+ 971:	e9 07 ff ff ff       	jmp    87d <printf+0x4d>
+ 976:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 97d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 980:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 983:	83 ec 0c             	sub    $0xc,%esp
+ 986:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 98b:	8b 13                	mov    (%ebx),%edx
+ 98d:	6a 01                	push   $0x1
+ 98f:	e9 6b ff ff ff       	jmp    8ff <printf+0xcf>
+ 994:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 998:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 99b:	83 ec 04             	sub    $0x4,%esp
+ 99e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 9a1:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 9a3:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 9a6:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 9a9:	6a 01                	push   $0x1
+ 9ab:	52                   	push   %edx
+ 9ac:	57                   	push   %edi
+ 9ad:	e8 d1 fc ff ff       	call   683 <write>
+        ap++;
+ 9b2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 9b5:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 9b8:	31 d2                	xor    %edx,%edx
+ 9ba:	e9 be fe ff ff       	jmp    87d <printf+0x4d>
+ 9bf:	90                   	nop
+  write(fd, &c, 1);
+ 9c0:	83 ec 04             	sub    $0x4,%esp
+ 9c3:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 9c6:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 9c9:	6a 01                	push   $0x1
+ 9cb:	e9 11 ff ff ff       	jmp    8e1 <printf+0xb1>
+ 9d0:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 9d5:	bb d4 0c 00 00       	mov    $0xcd4,%ebx
+ 9da:	e9 61 ff ff ff       	jmp    940 <printf+0x110>
+ 9df:	90                   	nop
+
+000009e0 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 9e0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 9e1:	a1 64 10 00 00       	mov    0x1064,%eax
+{
+ 9e6:	89 e5                	mov    %esp,%ebp
+ 9e8:	57                   	push   %edi
+ 9e9:	56                   	push   %esi
+ 9ea:	53                   	push   %ebx
+ 9eb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ 9ee:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 9f1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 9f8:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 9fa:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 9fc:	39 ca                	cmp    %ecx,%edx
+ 9fe:	73 30                	jae    a30 <free+0x50>
+ a00:	39 c1                	cmp    %eax,%ecx
+ a02:	72 04                	jb     a08 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ a04:	39 c2                	cmp    %eax,%edx
+ a06:	72 f0                	jb     9f8 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ a08:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ a0b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ a0e:	39 f8                	cmp    %edi,%eax
+ a10:	74 2e                	je     a40 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ a12:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ a15:	8b 42 04             	mov    0x4(%edx),%eax
+ a18:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ a1b:	39 f1                	cmp    %esi,%ecx
+ a1d:	74 38                	je     a57 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ a1f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ a21:	5b                   	pop    %ebx
+  freep = p;
+ a22:	89 15 64 10 00 00    	mov    %edx,0x1064
+}
+ a28:	5e                   	pop    %esi
+ a29:	5f                   	pop    %edi
+ a2a:	5d                   	pop    %ebp
+ a2b:	c3                   	ret
+ a2c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ a30:	39 c1                	cmp    %eax,%ecx
+ a32:	72 d0                	jb     a04 <free+0x24>
+ a34:	eb c2                	jmp    9f8 <free+0x18>
+ a36:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a3d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ a40:	03 70 04             	add    0x4(%eax),%esi
+ a43:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ a46:	8b 02                	mov    (%edx),%eax
+ a48:	8b 00                	mov    (%eax),%eax
+ a4a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ a4d:	8b 42 04             	mov    0x4(%edx),%eax
+ a50:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ a53:	39 f1                	cmp    %esi,%ecx
+ a55:	75 c8                	jne    a1f <free+0x3f>
+    p->s.size += bp->s.size;
+ a57:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ a5a:	89 15 64 10 00 00    	mov    %edx,0x1064
+    p->s.size += bp->s.size;
+ a60:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ a63:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ a66:	89 0a                	mov    %ecx,(%edx)
+}
+ a68:	5b                   	pop    %ebx
+ a69:	5e                   	pop    %esi
+ a6a:	5f                   	pop    %edi
+ a6b:	5d                   	pop    %ebp
+ a6c:	c3                   	ret
+ a6d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000a70 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ a70:	55                   	push   %ebp
+ a71:	89 e5                	mov    %esp,%ebp
+ a73:	57                   	push   %edi
+ a74:	56                   	push   %esi
+ a75:	53                   	push   %ebx
+ a76:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ a79:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ a7c:	8b 15 64 10 00 00    	mov    0x1064,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ a82:	8d 78 07             	lea    0x7(%eax),%edi
+ a85:	c1 ef 03             	shr    $0x3,%edi
+ a88:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ a8b:	85 d2                	test   %edx,%edx
+ a8d:	0f 84 8d 00 00 00    	je     b20 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ a93:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ a95:	8b 48 04             	mov    0x4(%eax),%ecx
+ a98:	39 f9                	cmp    %edi,%ecx
+ a9a:	73 64                	jae    b00 <malloc+0x90>
+  if(nu < 4096)
+ a9c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ aa1:	39 df                	cmp    %ebx,%edi
+ aa3:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ aa6:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ aad:	eb 0a                	jmp    ab9 <malloc+0x49>
+ aaf:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ ab0:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ ab2:	8b 48 04             	mov    0x4(%eax),%ecx
+ ab5:	39 f9                	cmp    %edi,%ecx
+ ab7:	73 47                	jae    b00 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ ab9:	89 c2                	mov    %eax,%edx
+ abb:	39 05 64 10 00 00    	cmp    %eax,0x1064
+ ac1:	75 ed                	jne    ab0 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ ac3:	83 ec 0c             	sub    $0xc,%esp
+ ac6:	56                   	push   %esi
+ ac7:	e8 1f fc ff ff       	call   6eb <sbrk>
+  if(p == (char*)-1)
+ acc:	83 c4 10             	add    $0x10,%esp
+ acf:	83 f8 ff             	cmp    $0xffffffff,%eax
+ ad2:	74 1c                	je     af0 <malloc+0x80>
+  hp->s.size = nu;
+ ad4:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ ad7:	83 ec 0c             	sub    $0xc,%esp
+ ada:	83 c0 08             	add    $0x8,%eax
+ add:	50                   	push   %eax
+ ade:	e8 fd fe ff ff       	call   9e0 <free>
+  return freep;
+ ae3:	8b 15 64 10 00 00    	mov    0x1064,%edx
+      if((p = morecore(nunits)) == 0)
+ ae9:	83 c4 10             	add    $0x10,%esp
+ aec:	85 d2                	test   %edx,%edx
+ aee:	75 c0                	jne    ab0 <malloc+0x40>
+        return 0;
+  }
+}
+ af0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ af3:	31 c0                	xor    %eax,%eax
+}
+ af5:	5b                   	pop    %ebx
+ af6:	5e                   	pop    %esi
+ af7:	5f                   	pop    %edi
+ af8:	5d                   	pop    %ebp
+ af9:	c3                   	ret
+ afa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ b00:	39 cf                	cmp    %ecx,%edi
+ b02:	74 4c                	je     b50 <malloc+0xe0>
+        p->s.size -= nunits;
+ b04:	29 f9                	sub    %edi,%ecx
+ b06:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ b09:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ b0c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ b0f:	89 15 64 10 00 00    	mov    %edx,0x1064
+}
+ b15:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ b18:	83 c0 08             	add    $0x8,%eax
+}
+ b1b:	5b                   	pop    %ebx
+ b1c:	5e                   	pop    %esi
+ b1d:	5f                   	pop    %edi
+ b1e:	5d                   	pop    %ebp
+ b1f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ b20:	c7 05 64 10 00 00 68 	movl   $0x1068,0x1064
+ b27:	10 00 00 
+    base.s.size = 0;
+ b2a:	b8 68 10 00 00       	mov    $0x1068,%eax
+    base.s.ptr = freep = prevp = &base;
+ b2f:	c7 05 68 10 00 00 68 	movl   $0x1068,0x1068
+ b36:	10 00 00 
+    base.s.size = 0;
+ b39:	c7 05 6c 10 00 00 00 	movl   $0x0,0x106c
+ b40:	00 00 00 
+    if(p->s.size >= nunits){
+ b43:	e9 54 ff ff ff       	jmp    a9c <malloc+0x2c>
+ b48:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b4f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ b50:	8b 08                	mov    (%eax),%ecx
+ b52:	89 0a                	mov    %ecx,(%edx)
+ b54:	eb b9                	jmp    b0f <malloc+0x9f>
@@ -0,0 +1,123 @@
+// Run a command with its scheduling attributes already set,
+// or set or show those of running processes.
+// usage: runq [-q queue] [-t tickets] [-p priority] [-s slice] [-n] command [arg...]
+//        runq [-q queue] [-t tickets] [-p priority] [-s slice] [-i|-n] -a pid...
+//        runq -g pid
+// The command's children inherit its attributes unless -n is given.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "param.h"
+#include "sched.h"
+
+// Parse a decimal such as 2.5 into thousandths.
+int
+thousandths(char *s)
+{
+  int n, scale;
+
+  n = atoi(s) * 1000;
+  if((s = strchr(s, '.')) == 0)
+    return n;
+  for(s++, scale = 100; *s >= '0' && *s <= '9' && scale > 0; s++, scale /= 10)
+    n += (*s - '0') * scale;
+  return n;
+}
+
+void
+show(int pid)
+{
+  struct schedattr a;
+
+  if(getSchedAttr(pid, &a) < 0){
+    printf(2, "runq: no process %d\n", pid);
+    return;
+  }
+  printf(1, "%d: queue %d tickets %d priority %d.%d%d%d slice %d%s\n",
+         pid, a.queue, a.tickets, a.priority / 1000, a.priority / 100 % 10,
+         a.priority / 10 % 10, a.priority % 10, a.quantum,
+         (a.flags & SAF_INHERIT) ? " inherit" : "");
+}
+
+void
+usage(void)
+{
+  printf(2, "usage: runq [-q queue] [-t tickets] [-p priority] [-s slice] [-n] command [arg...]\n");
+  printf(2, "       runq [-q queue] [-t tickets] [-p priority] [-s slice] [-i|-n] -a pid...\n");
+  printf(2, "       runq -g pid\n");
+  exit();
+}
+
+int
+main(int argc, char *argv[])
+{
+  struct schedattr a;
+  int pids[NPROC];
+  int i, n, inherit;
+
+  memset(&a, 0, sizeof(a));
+  inherit = -1;
+  for(i = 1; i < argc && argv[i][0] == '-'; i++){
+    switch(argv[i][1]){
+    case 'n':
+      inherit = 0;
+      continue;
+    case 'i':
+      inherit = 1;
+      continue;
+    case 'a':
+      // Change running processes rather than start one.
+      if(inherit >= 0){
+        a.mask |= SA_FLAGS;
+        a.flags = inherit ? SAF_INHERIT : 0;
+      }
+      for(n = 0, i++; i < argc && n < NPROC; i++)
+        pids[n++] = atoi(argv[i]);
+      if(n == 0)
+        usage();
+      if(setSchedAttr(pids, n, &a) < 0)
+        printf(2, "runq: cannot set attributes\n");
+      exit();
+    }
+    if(i + 1 >= argc)
+      usage();
+    switch(argv[i][1]){
+    case 'g':
+      show(atoi(argv[i+1]));
+      exit();
+    case 'q':
+      a.mask |= SA_QUEUE;
+      a.queue = atoi(argv[++i]);
+      break;
+    case 't':
+      a.mask |= SA_TICKETS;
+      a.tickets = atoi(argv[++i]);
+      break;
+    case 'p':
+      a.mask |= SA_PRIORITY;
+      a.priority = thousandths(argv[++i]);
+      break;
+    case 's':
+      a.mask |= SA_QUANTUM;
+      a.quantum = atoi(argv[++i]);
+      break;
+    default:
+      usage();
+    }
+  }
+  if(i == argc)
+    usage();
+
+  // Set our own attributes and become the command.
+  a.mask |= SA_FLAGS;
+  a.flags = inherit == 0 ? 0 : SAF_INHERIT;
+  pids[0] = 0;
+  if(setSchedAttr(pids, 1, &a) < 0){
+    printf(2, "runq: cannot set attributes\n");
+    exit();
+  }
+  exec(argv[i], argv + i);
+  printf(2, "runq: exec %s failed\n", argv[i]);
+  exit();
+}
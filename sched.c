@@ -0,0 +1,875 @@
+// Scheduling classes for the MLFQ queues.
+//
+// Each queue of a CPU's run queue is bound to a scheduling
+// class, which decides which of the queue's RUNNABLE processes
+// runs next. The run queue code at the end of this file keeps
+// the queue ring and calls into the class as processes join
+// and leave it; a class keeps any index of its own in q->u.
+//
+// Nothing here touches hardware or the process table directly,
+// so this file also builds on the host, into schedsim.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "mmu.h"
+#include "proc.h"
+
+// Random numbers for the classes that draw. Each queue has its
+// own xorshift generator, guarded like the rest of the queue,
+// so CPUs never share state and a given seed replays the same
+// sequence of draws on every queue.
+
+static uint
+randnext(struct queue *q)
+{
+  uint x = q->rng;
+
+  x ^= x << 13;
+  x ^= x >> 17;
+  x ^= x << 5;
+  return q->rng = x;
+}
+
+// Uniform in [0, n), n > 0. Draws below 2^32 mod n are
+// rejected so that every result is equally likely.
+static uint
+randrange(struct queue *q, uint n)
+{
+  uint x, limit = -n % n;
+
+  do
+    x = randnext(q);
+  while(x < limit);
+  return x % n;
+}
+
+// Seed the generators of rq, the run queue of CPU cpu, from seed.
+void
+runqseed(struct runq *rq, int cpu, uint seed)
+{
+  uint x;
+  int i;
+
+  for(i = 0; i < NQUEUE; i++){
+    // Mix seed, cpu and queue so the streams differ.
+    x = seed ^ (cpu * 0x9e3779b9) ^ (i * 0x85ebca6b);
+    x ^= x >> 16;
+    x *= 0x7feb352d;
+    x ^= x >> 15;
+    x *= 0x846ca68b;
+    x ^= x >> 16;
+    rq->q[i].rng = x ? x : 1;
+  }
+}
+
+// Whether p is on a run queue, and so in its class's index.
+// A RUNNABLE process is briefly on none while being dispatched.
+static int
+queued(struct proc *p)
+{
+  return p->rqnext != 0;
+}
+
+// Response ratio of p at tick now, in fixed point: ticks
+// since arrival over the number of times it has been run.
+int
+hrrnratio(struct proc *p, uint now)
+{
+  uint waitingTime = now - p->mlfq.arrivalTime;
+  uint n = p->mlfq.executedCycleNumber;
+
+  return (waitingTime / n) * FIXSCALE + (waitingTime % n) * FIXSCALE / n;
+}
+
+//PAGEBREAK: 30
+// Round robin: the oldest process on the ring.
+// Used by the fallback queue 0.
+
+static struct proc*
+rrpick(struct queue *q)
+{
+  return q->head;
+}
+
+struct schedclass rrclass = {
+  .name = "rr",
+  .pick_next = rrpick,
+};
+
+//PAGEBREAK: 30
+// Lottery. The tickets of the queued processes are kept in
+// a binary indexed (Fenwick) tree keyed by process table slot,
+// so both a draw and a ticket change cost O(log NPROC).
+//
+// A process that blocks after using only a fraction f of its
+// time slice holds compensation tickets, 1/f times its own,
+// until it is next dispatched, so that giving up the CPU early
+// does not cost it its share.
+
+#define COMPMAX 20  // most a process's tickets are inflated by
+
+// Tickets p holds in the draw; non-positive counts never win.
+// With at most MAXTICKET tickets and comp at most COMPMAX*FIXSCALE
+// the product stays below 2^31, and NPROC weights sum within an int.
+static int
+lotteryweight(struct proc *p)
+{
+  int tickets = p->mlfq.lotteryTicket;
+  int comp = p->mlfq.comp;
+
+  if(tickets <= 0)
+    return 0;
+  if(tickets > MAXTICKET)
+    tickets = MAXTICKET;
+  if(comp > COMPMAX * FIXSCALE)
+    comp = COMPMAX * FIXSCALE;
+  if(comp > 0)
+    return tickets * comp / FIXSCALE;
+  return tickets;
+}
+
+// Add delta tickets to p's slot.
+static void
+lotteryadd(struct queue *q, struct proc *p, int delta)
+{
+  int i;
+
+  if(delta == 0)
+    return;
+  for(i = procslot(p) + 1; i <= NPROC; i += i & -i)
+    q->u.lottery.tickets[i] += delta;
+  q->u.lottery.sum += delta;
+}
+
+// Return the process holding ticket number t, 0 <= t < sum.
+static struct proc*
+lotteryfind(struct queue *q, int t)
+{
+  int pos, step;
+
+  pos = 0;
+  for(step = 1; step*2 <= NPROC; step *= 2)
+    ;
+  for(; step > 0; step /= 2){
+    if(pos + step <= NPROC && q->u.lottery.tickets[pos + step] <= t){
+      pos += step;
+      t -= q->u.lottery.tickets[pos];
+    }
+  }
+  return slotproc(pos);
+}
+
+static void
+lotteryenqueue(struct queue *q, struct proc *p)
+{
+  lotteryadd(q, p, lotteryweight(p));
+}
+
+static void
+lotterydequeue(struct queue *q, struct proc *p)
+{
+  lotteryadd(q, p, -lotteryweight(p));
+}
+
+static struct proc*
+lotterypick(struct queue *q)
+{
+  struct proc *p;
+
+  if(q->u.lottery.sum == 0)
+    return 0;
+  p = lotteryfind(q, randrange(q, q->u.lottery.sum));
+  p->mlfq.executedCycleNumber += 1;
+  return p;
+}
+
+static int
+lotterysetparam(struct queue *q, struct proc *p, int param, int value)
+{
+  if(param != SP_TICKETS || value < 1 || value > MAXTICKET)
+    return -1;
+  if(queued(p))
+    lotteryadd(q, p, -lotteryweight(p));
+  p->mlfq.lotteryTicket = value;
+  if(queued(p))
+    lotteryadd(q, p, lotteryweight(p));
+  return 0;
+}
+
+// p blocks before its slice is over: work out the fraction
+// of the slice it used, from the cycles since its dispatch.
+static void
+lotteryblock(struct queue *q, struct proc *p)
+{
+  uint64 used, slice;
+  uint f;
+
+  slice = tickcycles * slicelen(p);
+  used = cyclecount() - p->mlfq.runStart;
+  if(slice == 0 || used >= slice)
+    return;
+  // Scale down so the ratio fits a 32-bit division.
+  while(slice >= (1 << 20)){
+    slice >>= 1;
+    used >>= 1;
+  }
+  f = (uint)used * FIXSCALE / (uint)slice;
+  if(f < FIXSCALE / COMPMAX)
+    f = FIXSCALE / COMPMAX;
+  p->mlfq.comp = FIXSCALE * FIXSCALE / f;
+}
+
+struct schedclass lotteryclass = {
+  .name = "lottery",
+  .enqueue = lotteryenqueue,
+  .dequeue = lotterydequeue,
+  .pick_next = lotterypick,
+  .block = lotteryblock,
+  .set_param = lotterysetparam,
+};
+
+//PAGEBREAK: 30
+// Highest response ratio next, by a scan of the ring.
+
+static struct proc*
+hrrnpick(struct queue *q)
+{
+  struct proc *p;
+  struct proc *winner = 0;
+  int maxHRRN = -1;
+  int HRRN;
+  uint now = ticks;
+
+  if(q->head == 0)
+    return 0;
+
+  p = q->head;
+  do {
+    HRRN = hrrnratio(p, now);
+    if( HRRN > maxHRRN ){
+      maxHRRN = HRRN;
+      winner = p;
+    }
+    p = p->rqnext;
+  } while(p != q->head);
+
+  winner->mlfq.executedCycleNumber += 1;
+  return winner;
+}
+
+struct schedclass hrrnclass = {
+  .name = "hrrn",
+  .pick_next = hrrnpick,
+};
+
+//PAGEBREAK: 40
+// Process heaps. A class that picks the process with the
+// least key keeps a binary min-heap ordered by before(a, b),
+// "a's key is less than b's", and each queued process remembers
+// its heap index, so a key change is a sift in O(log n) rather
+// than a rescan.
+
+static void
+heapswap(struct procheap *h, int i, int j)
+{
+  struct proc *t = h->heap[i];
+
+  h->heap[i] = h->heap[j];
+  h->heap[j] = t;
+  h->heap[i]->heapidx = i;
+  h->heap[j]->heapidx = j;
+}
+
+// Restore heap order around index i after its key changed.
+static void
+heapsift(struct procheap *h, int i, int (*before)(struct proc*, struct proc*))
+{
+  struct proc **heap = h->heap;
+  int child;
+
+  while(i > 0 && before(heap[i], heap[(i-1)/2])){
+    heapswap(h, i, (i-1)/2);
+    i = (i-1)/2;
+  }
+  for(;;){
+    child = 2*i + 1;
+    if(child >= h->n)
+      break;
+    if(child+1 < h->n && before(heap[child+1], heap[child]))
+      child++;
+    if(!before(heap[child], heap[i]))
+      break;
+    heapswap(h, i, child);
+    i = child;
+  }
+}
+
+static void
+heapinsert(struct procheap *h, struct proc *p, int (*before)(struct proc*, struct proc*))
+{
+  p->heapidx = h->n++;
+  h->heap[p->heapidx] = p;
+  heapsift(h, p->heapidx, before);
+}
+
+static void
+heapremove(struct procheap *h, struct proc *p, int (*before)(struct proc*, struct proc*))
+{
+  int i = p->heapidx;
+
+  h->n--;
+  if(i != h->n){
+    heapswap(h, i, h->n);
+    heapsift(h, i, before);
+  }
+  h->heap[h->n] = 0;
+  p->heapidx = -1;
+}
+
+//PAGEBREAK: 30
+// Shortest remaining priority first, on a heap of
+// remainedPriority.
+
+static int
+srpfbefore(struct proc *a, struct proc *b)
+{
+  return a->mlfq.remainedPriority < b->mlfq.remainedPriority;
+}
+
+static void
+srpfenqueue(struct queue *q, struct proc *p)
+{
+  heapinsert(&q->u.srpf, p, srpfbefore);
+}
+
+static void
+srpfdequeue(struct queue *q, struct proc *p)
+{
+  heapremove(&q->u.srpf, p, srpfbefore);
+}
+
+// Change p's remaining priority, keeping the heap in step.
+static void
+srpfset(struct queue *q, struct proc *p, int newPriority)
+{
+  p->mlfq.remainedPriority = newPriority;
+  if(queued(p))
+    heapsift(&q->u.srpf, p->heapidx, srpfbefore);
+}
+
+static struct proc*
+srpfpick(struct queue *q)
+{
+  struct proc **heap = q->u.srpf.heap;
+  struct proc *p;
+  int ties[NPROC];
+  int i, c, n;
+  int minRemainedPriority;
+
+  if(q->u.srpf.n == 0)
+    return 0;
+
+  // Processes sharing the minimum form a subtree at the root of
+  // the heap; collect just that subtree and choose among it at random.
+  minRemainedPriority = heap[0]->mlfq.remainedPriority;
+  ties[0] = 0;
+  n = 1;
+  for(i = 0; i < n; i++){
+    for(c = 2*ties[i] + 1; c <= 2*ties[i] + 2 && c < q->u.srpf.n; c++)
+      if(heap[c]->mlfq.remainedPriority == minRemainedPriority)
+        ties[n++] = c;
+  }
+  p = n == 1 ? heap[0] : heap[ties[randrange(q, n)]];
+
+  p->mlfq.executedCycleNumber += 1;
+  if( (p->mlfq.remainedPriority - FIXSCALE/10) < 0)
+    srpfset(q, p, 0);
+  else
+    srpfset(q, p, p->mlfq.remainedPriority - FIXSCALE/10);
+  return p;
+}
+
+static int
+srpfsetparam(struct queue *q, struct proc *p, int param, int value)
+{
+  if(param != SP_PRIORITY)
+    return -1;
+  srpfset(q, p, value);
+  return 0;
+}
+
+struct schedclass srpfclass = {
+  .name = "srpf",
+  .enqueue = srpfenqueue,
+  .dequeue = srpfdequeue,
+  .pick_next = srpfpick,
+  .set_param = srpfsetparam,
+};
+
+//PAGEBREAK: 40
+// Stride scheduling: a deterministic counterpart of the lottery,
+// with the same tickets as weights. Each process advances its
+// pass by STRIDE1/tickets for every tick it runs, and the queued
+// process with the least pass runs next, from a heap on pass.
+// A process joining the queue starts no earlier than the pass
+// last picked, so time spent blocked is not banked as credit.
+// Passes wrap, so they are compared by signed difference.
+
+#define STRIDE1 (1 << 20)
+
+static int
+stridebefore(struct proc *a, struct proc *b)
+{
+  return (int)(a->mlfq.pass - b->mlfq.pass) < 0;
+}
+
+static void
+strideenqueue(struct queue *q, struct proc *p)
+{
+  p->heapidx = -1;
+  if(p->mlfq.lotteryTicket <= 0)
+    return;
+  if((int)(p->mlfq.pass - q->u.stride.pass) < 0)
+    p->mlfq.pass = q->u.stride.pass;
+  heapinsert(&q->u.stride.h, p, stridebefore);
+}
+
+static void
+stridedequeue(struct queue *q, struct proc *p)
+{
+  if(p->heapidx >= 0)
+    heapremove(&q->u.stride.h, p, stridebefore);
+}
+
+static struct proc*
+stridepick(struct queue *q)
+{
+  struct proc *p;
+
+  if(q->u.stride.h.n == 0)
+    return 0;
+  p = q->u.stride.h.heap[0];
+  q->u.stride.pass = p->mlfq.pass;
+  p->mlfq.executedCycleNumber += 1;
+  return p;
+}
+
+static void
+stridetick(struct queue *q, struct proc *p)
+{
+  if(p->mlfq.lotteryTicket > 0)
+    p->mlfq.pass += STRIDE1 / p->mlfq.lotteryTicket;
+}
+
+static int
+stridesetparam(struct queue *q, struct proc *p, int param, int value)
+{
+  if(param != SP_TICKETS || value < 1 || value > MAXTICKET)
+    return -1;
+  if(queued(p)){
+    stridedequeue(q, p);
+    p->mlfq.lotteryTicket = value;
+    strideenqueue(q, p);
+  } else
+    p->mlfq.lotteryTicket = value;
+  return 0;
+}
+
+struct schedclass strideclass = {
+  .name = "stride",
+  .enqueue = strideenqueue,
+  .dequeue = stridedequeue,
+  .pick_next = stridepick,
+  .tick = stridetick,
+  .set_param = stridesetparam,
+};
+
+//PAGEBREAK: 40
+// Earliest deadline first, for the real-time queue RTQUEUE.
+// Among the processes whose current job has been released,
+// the one with the earliest absolute deadline runs, for at
+// most the runtime left in its job. A job that uses up its
+// runtime ends there, and the process waits for its next
+// release, a period later, on the queue, while the MLFQ
+// levels run. A process that blocks ends its job early.
+// Ticks wrap, so they are compared by signed difference.
+
+static int
+edflate(struct proc *p)
+{
+  return (int)(ticks - p->edf.absdeadline) > 0;
+}
+
+// Release a job if p has none, no sooner than a period
+// after the last one.
+static void
+edfenqueue(struct queue *q, struct proc *p)
+{
+  uint next;
+
+  if(p->edf.left > 0)
+    return;
+  next = p->edf.release + p->edf.period;
+  p->edf.release = (int)(ticks - next) > 0 ? ticks : next;
+  p->edf.absdeadline = p->edf.release + p->edf.deadline;
+  p->edf.left = p->edf.runtime;
+}
+
+static struct proc*
+edfpick(struct queue *q)
+{
+  struct proc *p, *best;
+
+  best = 0;
+  p = q->head;
+  do {
+    if((int)(ticks - p->edf.release) >= 0 &&
+       (best == 0 || (int)(p->edf.absdeadline - best->edf.absdeadline) < 0))
+      best = p;
+    p = p->rqnext;
+  } while(p != q->head);
+  if(best)
+    best->mlfq.executedCycleNumber += 1;
+  return best;
+}
+
+// Charge a tick to the current job; when its runtime is used
+// up, end it and hold the next one back until a period later.
+static void
+edftick(struct queue *q, struct proc *p)
+{
+  if(p->edf.left <= 0 || --p->edf.left > 0)
+    return;
+  if(edflate(p))
+    p->edf.misses++;
+  p->edf.release += p->edf.period;
+  p->edf.absdeadline = p->edf.release + p->edf.deadline;
+  p->edf.left = p->edf.runtime;
+}
+
+static void
+edfblock(struct queue *q, struct proc *p)
+{
+  if(p->edf.left <= 0)
+    return;
+  if(edflate(p))
+    p->edf.misses++;
+  p->edf.left = 0;
+}
+
+struct schedclass edfclass = {
+  .name = "edf",
+  .enqueue = edfenqueue,
+  .pick_next = edfpick,
+  .tick = edftick,
+  .block = edfblock,
+};
+
+//PAGEBREAK: 20
+// Registered classes, by SCHED_* number.
+struct schedclass *schedclasses[NSCHEDCLASS] = {
+[SCHED_RR]      &rrclass,
+[SCHED_LOTTERY] &lotteryclass,
+[SCHED_HRRN]    &hrrnclass,
+[SCHED_SRPF]    &srpfclass,
+[SCHED_STRIDE]  &strideclass,
+};
+
+// Number of MLFQ levels and the class bound to each.
+// Queue 0 is the round-robin fallback for processes whose
+// queueNumber is outside 1..nqueue; it is always rrclass.
+// The real-time queue is always edfclass.
+int nqueue = 3;
+struct schedclass *queueclass[NQUEUE+1] = {
+  &rrclass,
+  STRIDE ? &strideclass : &lotteryclass,
+  &hrrnclass,
+  &srpfclass,
+  [RTQUEUE] &edfclass,
+};
+
+// Length of a timer tick in cyclecount() units, measured by
+// the kernel; 0 while unknown.
+uint64 tickcycles;
+
+// Time slice of each queue, in ticks: short for the
+// interactive lottery level, longer further down.
+int quantum[NQUEUE] = {
+  [0 ... NQUEUE-1] 4,
+  [1] 1,
+  [2] 2,
+};
+
+//PAGEBREAK: 40
+// Run queues. These work on one CPU's struct runq and leave
+// the locking and the choice of CPU to the caller: the kernel
+// calls them with the run queue's lock held, and the host simulator
+// schedsim links this file as it is.
+
+// Run queue index for p: RTQUEUE for real-time processes,
+// MLFQ levels 1..nqueue, and everything else goes to the
+// round-robin fallback queue 0.
+int
+runqindex(struct proc *p)
+{
+  int q = p->mlfq.queueNumber;
+
+  if(p->edf.runtime > 0)
+    return RTQUEUE;
+  if(q < 1 || q > nqueue)
+    return 0;
+  return q;
+}
+
+// Time slice of p in ticks: what is left of its job if it is
+// real-time, else its own if set, else its queue's.
+int
+slicelen(struct proc *p)
+{
+  if(runqindex(p) == RTQUEUE)
+    return p->edf.left;
+  if(p->mlfq.quantum > 0)
+    return p->mlfq.quantum;
+  return quantum[runqindex(p)];
+}
+
+// Append p to the tail of its queue in rq.
+void
+runqinsert(struct runq *rq, struct proc *p)
+{
+  int i = runqindex(p);
+  struct queue *q = &rq->q[i];
+
+  if(q->head == 0){
+    p->rqnext = p->rqprev = p;
+    q->head = p;
+  } else {
+    p->rqnext = q->head;
+    p->rqprev = q->head->rqprev;
+    q->head->rqprev->rqnext = p;
+    q->head->rqprev = p;
+  }
+  q->n++;
+  rq->nready++;
+  if(p->affinity != ~0)
+    rq->nbound++;
+  p->mlfq.enqueueTick = ticks;
+  if(queueclass[i]->enqueue)
+    queueclass[i]->enqueue(q, p);
+}
+
+// Unlink p from its queue in rq.
+void
+runqremove(struct runq *rq, struct proc *p)
+{
+  int i = runqindex(p);
+  struct queue *q = &rq->q[i];
+
+  if(queueclass[i]->dequeue)
+    queueclass[i]->dequeue(q, p);
+  if(p->rqnext == p)
+    q->head = 0;
+  else {
+    p->rqprev->rqnext = p->rqnext;
+    p->rqnext->rqprev = p->rqprev;
+    if(q->head == p)
+      q->head = p->rqnext;
+  }
+  p->rqnext = p->rqprev = 0;
+  q->n--;
+  rq->nready--;
+  if(p->affinity != ~0)
+    rq->nbound--;
+}
+
+// Ask cls to pick from q, accounting the time it takes.
+static struct proc*
+classpick(struct schedclass *cls, struct queue *q)
+{
+  struct proc *p;
+  uint64 t0;
+
+  t0 = cyclecount();
+  p = cls->pick_next(q);
+  cls->cycles += cyclecount() - t0;
+  cls->picks++;
+  return p;
+}
+
+// Ask the queues of rq in priority order for a process to run,
+// the real-time queue, the MLFQ levels and then the fallback
+// queue. As a last resort (say, only zero-ticket lottery
+// processes), run the oldest process on any MLFQ or fallback
+// queue; real-time processes waiting for their next release
+// are left waiting. The process stays queued.
+struct proc*
+runqpick(struct runq *rq)
+{
+  struct proc *p;
+  int i;
+
+  if(rq->nready == 0)
+    return 0;
+
+  if(rq->q[RTQUEUE].n > 0 && (p = classpick(queueclass[RTQUEUE], &rq->q[RTQUEUE])) != 0)
+    return p;
+  for(i = 1; i <= nqueue; i++)
+    if(rq->q[i].n > 0 && (p = classpick(queueclass[i], &rq->q[i])) != 0)
+      return p;
+  if(rq->q[0].n > 0 && (p = classpick(queueclass[0], &rq->q[0])) != 0)
+    return p;
+  for(i = 0; i <= nqueue; i++)
+    if(rq->q[i].head)
+      return rq->q[i].head;
+  return 0;
+}
+
+// Pick a process on rq, another CPU's run queue, for CPU cpu
+// to take over. Processes bound away from cpu are passed over;
+// while any are queued, take the oldest one that may move,
+// from the highest level, rather than asking the classes.
+struct proc*
+runqsteal(struct runq *rq, int cpu)
+{
+  struct proc *p;
+  int i, k;
+
+  if(rq->nbound == 0)
+    return runqpick(rq);
+  for(i = 1; i <= nqueue + 1; i++){
+    k = i <= nqueue ? i : 0;
+    if((p = rq->q[k].head) == 0)
+      continue;
+    do {
+      if(p->affinity & (1 << cpu))
+        return p;
+      p = p->rqnext;
+    } while(p != rq->q[k].head);
+  }
+  return 0;
+}
+
+// Whether p, just queued, should take the CPU from cur, which
+// is running: p's queue comes first in runqpick()'s order, or
+// both are real-time and p's released job is due sooner.
+int
+runqpreempts(struct proc *p, struct proc *cur)
+{
+  int i = runqindex(p), j = runqindex(cur);
+
+  if(i == RTQUEUE)
+    return (int)(ticks - p->edf.release) >= 0 && (j != RTQUEUE ||
+      (int)(p->edf.absdeadline - cur->edf.absdeadline) < 0);
+  if(j == RTQUEUE || i == 0)
+    return 0;
+  return j == 0 || i < j;
+}
+
+// Latency histogram bucket for a wait of n ticks:
+// 0, 1, 2-3, 4-7, ... with the last bucket open-ended.
+static int
+latbucket(uint n)
+{
+  int b;
+
+  for(b = 0; n > 0 && b < NLATBUCKET-1; b++)
+    n >>= 1;
+  return b;
+}
+
+// p, already off its queue, is about to run on the CPU of rq:
+// give it a fresh slice and account the dispatch.
+void
+runqdispatch(struct runq *rq, struct proc *p)
+{
+  struct queuestat *st = &rq->stat[runqindex(p)];
+
+  p->mlfq.sliceLeft = slicelen(p);
+  p->mlfq.comp = 0;
+  p->mlfq.runStart = cyclecount();
+  st->dispatches++;
+  st->latency[latbucket(ticks - p->mlfq.readyTick)]++;
+}
+
+//PAGEBREAK: 30
+// MLFQ feedback. A process that keeps running out its time
+// slice sinks one level every MLFQ_ALLOT slices, one that blocks
+// before its slice is over rises a level, and one left queued
+// for MLFQ_STARVE ticks is aged up a level. Only processes on
+// the MLFQ levels 1..nqueue move; the fallback queue is left alone.
+
+// A timer tick while p runs on the CPU of rq: let the class
+// of its queue account the tick and charge it against the time
+// slice. Returns 1 once the slice is used up and p should
+// yield, demoting CPU hogs on the way.
+int
+runqtick(struct runq *rq, struct proc *p)
+{
+  int i, expired;
+
+  i = runqindex(p);
+  if(queueclass[i]->tick)
+    queueclass[i]->tick(&rq->q[i], p);
+  expired = --p->mlfq.sliceLeft <= 0;
+  rq->stat[i].runticks++;
+  if(expired)
+    rq->stat[i].preemptions++;
+  if(expired && i > 0 && i <= nqueue && ++p->mlfq.fullSlices >= MLFQ_ALLOT){
+    p->mlfq.fullSlices = 0;
+    if(p->mlfq.queueNumber < nqueue){
+      p->mlfq.queueNumber++;
+      traceevent(EV_QUEUE, p, p->mlfq.queueNumber, EVR_DEMOTE);
+    }
+  }
+  return expired;
+}
+
+// p, last run from rq, is about to block before its slice is over.
+void
+runqblocked(struct runq *rq, struct proc *p)
+{
+  int i = runqindex(p);
+
+  if(queueclass[i]->block)
+    queueclass[i]->block(&rq->q[i], p);
+  rq->stat[i].yields++;
+  if(i > 1 && i <= nqueue){
+    p->mlfq.queueNumber--;
+    traceevent(EV_QUEUE, p, p->mlfq.queueNumber, EVR_PROMOTE);
+  }
+  p->mlfq.fullSlices = 0;
+}
+
+// Every MLFQ_AGEPERIOD ticks: sample the queue lengths of rq
+// and move processes that have waited MLFQ_STARVE ticks on
+// levels 2..nqueue up one level.
+void
+runqclock(struct runq *rq, uint now)
+{
+  struct queue *q;
+  struct proc *p, *next;
+  int i, k;
+
+  for(i = 0; i <= NQUEUE; i++){
+    if(i > nqueue && i != RTQUEUE)
+      continue;
+    rq->stat[i].lensum += rq->q[i].n;
+    if(rq->q[i].n > rq->stat[i].lenmax)
+      rq->stat[i].lenmax = rq->q[i].n;
+  }
+  // Upward, so that a process moves at most one level.
+  for(i = 2; i <= nqueue; i++){
+    q = &rq->q[i];
+    for(k = q->n, p = q->head; k > 0; k--, p = next){
+      next = p->rqnext;
+      if(now - p->mlfq.enqueueTick < MLFQ_STARVE)
+        continue;
+      runqremove(rq, p);
+      p->mlfq.queueNumber--;
+      p->mlfq.fullSlices = 0;
+      runqinsert(rq, p);
+      traceevent(EV_QUEUE, p, p->mlfq.queueNumber, EVR_AGE);
+    }
+  }
+}
@@ -0,0 +1,85 @@
+// Included by proc.h as well as directly, so guarded.
+#ifndef SCHED_H
+#define SCHED_H
+
+// Scheduling classes that can be bound to an MLFQ queue
+// with configQueues().
+#define SCHED_RR       0   // round robin
+#define SCHED_LOTTERY  1   // lottery on tickets
+#define SCHED_HRRN     2   // highest response ratio next
+#define SCHED_SRPF     3   // shortest remaining priority first
+#define SCHED_STRIDE   4   // stride scheduling on tickets
+#define NSCHEDCLASS    5
+
+// Scheduler statistics, see getSchedStat().
+#define NLATBUCKET 8   // wait-to-dispatch buckets: 0, 1, 2-3, 4-7, ... >=64 ticks
+
+struct queuestat {
+  uint dispatches;             // Processes dispatched from the queue
+  uint runticks;               // Timer ticks its processes ran for
+  uint preemptions;            // Slices ended by the timer
+  uint yields;                 // Slices given up early by blocking
+  uint lensum;                 // Sum of queue-length samples
+  uint lenmax;                 // Longest queue seen in a sample
+  uint latency[NLATBUCKET];    // Histogram of ticks from RUNNABLE to dispatch
+};
+
+struct schedstat {
+  uint ticks;                  // When the snapshot was taken
+  uint samples;                // Queue-length samples taken so far
+  int nqueue;                  // MLFQ levels in use
+  int cls[NQUEUE];             // SCHED_* class of each queue
+  struct queuestat q[NQUEUE];  // Summed over CPUs; q[0] is the fallback
+  struct queuestat rt;         // The real-time queue, summed over CPUs
+};
+
+// Scheduling attributes of a process, see setSchedAttr().
+#define SA_QUEUE     0x01  // fields of struct schedattr to set
+#define SA_TICKETS   0x02
+#define SA_PRIORITY  0x04
+#define SA_QUANTUM   0x08
+#define SA_FLAGS     0x10
+
+#define SAF_INHERIT  0x01  // children start with the parent's attributes
+
+struct schedattr {
+  int mask;                    // SA_* fields to set; getSchedAttr fills all
+  int queue;                   // MLFQ level
+  int tickets;                 // Lottery and stride tickets
+  int priority;                // SRPF remaining priority, in thousandths
+  int quantum;                 // Time slice in ticks, 0 for the queue's own
+  int flags;                   // SAF_*
+};
+
+// Scheduler trace events, drained with schedTrace().
+#define EV_DISPATCH  1   // pid starts running on cpu
+#define EV_DESCHED   2   // pid leaves cpu, for reason
+#define EV_WAKEUP    3   // pid made RUNNABLE by wakeup or kill
+#define EV_QUEUE     4   // pid moved to queue arg, for reason
+#define EV_TICKET    5   // pid's lottery tickets set to arg
+#define EV_PRIORITY  6   // pid's SRPF priority set to arg (fixed point)
+#define EV_FORK      7   // pid created by parent arg
+
+#define EVR_PREEMPT  1   // EV_DESCHED: slice over
+#define EVR_SLEEP    2   // EV_DESCHED: blocked
+#define EVR_EXIT     3   // EV_DESCHED: exited
+#define EVR_MANUAL   4   // EV_QUEUE: changeQueue
+#define EVR_DEMOTE   5   // EV_QUEUE: MLFQ feedback, used up its slices
+#define EVR_PROMOTE  6   // EV_QUEUE: MLFQ feedback, blocked early
+#define EVR_AGE      7   // EV_QUEUE: MLFQ aging
+
+// No 64-bit fields, so that the layout is the same for
+// the host-side traceanalyze.
+struct schedevent {
+  uint tsclo;                  // Time-stamp counter, low half
+  uint tschi;                  // and high half
+  uint tick;                   // ticks at the event
+  int pid;
+  int arg;                     // Depends on type, see EV_*
+  uchar cpu;
+  uchar type;                  // EV_*
+  uchar queue;                 // pid's queueNumber at the event
+  uchar reason;                // EVR_*, or 0
+};
+
+#endif // SCHED_H
@@ -0,0 +1,2951 @@
+
+_schedbench:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  }
+}
+
+int
+main(int argc, char *argv[])
+{
+       0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+       4:	83 e4 f0             	and    $0xfffffff0,%esp
+       7:	ff 71 fc             	push   -0x4(%ecx)
+       a:	55                   	push   %ebp
+       b:	89 e5                	mov    %esp,%ebp
+       d:	57                   	push   %edi
+       e:	56                   	push   %esi
+       f:	53                   	push   %ebx
+      10:	51                   	push   %ecx
+      11:	83 ec 48             	sub    $0x48,%esp
+      14:	8b 19                	mov    (%ecx),%ebx
+      16:	8b 71 04             	mov    0x4(%ecx),%esi
+  struct result r;
+  char *text, name[16];
+  int res[2], ticks, timer, pid, i, j, l, failed;
+  uint start, elapsed;
+
+  ticks = argc > 1 ? atoi(argv[1]) : 1000;
+      19:	83 fb 01             	cmp    $0x1,%ebx
+      1c:	0f 8f 9c 00 00 00    	jg     be <main+0xbe>
+  text = defspec;
+  if(argc > 2 && strcmp(argv[2], "-") != 0 && (text = readspec(argv[2])) == 0){
+    printf(2, "schedbench: cannot read %s\n", argv[2]);
+    exit();
+  }
+  if(getSchedStat(&st) < 0)
+      22:	83 ec 0c             	sub    $0xc,%esp
+  text = defspec;
+      25:	8b 3d a0 1f 00 00    	mov    0x1fa0,%edi
+  if(getSchedStat(&st) < 0)
+      2b:	68 c0 62 00 00       	push   $0x62c0
+      30:	e8 86 13 00 00       	call   13bb <getSchedStat>
+      35:	83 c4 10             	add    $0x10,%esp
+      38:	85 c0                	test   %eax,%eax
+      3a:	0f 88 d8 00 00 00    	js     118 <main+0x118>
+    exit();
+  maxqueue = st.nqueue;
+      40:	a1 c8 62 00 00       	mov    0x62c8,%eax
+  ticks = argc > 1 ? atoi(argv[1]) : 1000;
+      45:	c7 45 b4 e8 03 00 00 	movl   $0x3e8,-0x4c(%ebp)
+  maxqueue = st.nqueue;
+      4c:	a3 c0 1f 00 00       	mov    %eax,0x1fc0
+  if(ticks < 1 || parsespec(text) < 0 || nspec == 0)
+      51:	83 ec 0c             	sub    $0xc,%esp
+      54:	57                   	push   %edi
+      55:	e8 56 0c 00 00       	call   cb0 <parsespec>
+      5a:	83 c4 10             	add    $0x10,%esp
+      5d:	85 c0                	test   %eax,%eax
+      5f:	0f 88 b3 00 00 00    	js     118 <main+0x118>
+      65:	8b 0d 20 21 00 00    	mov    0x2120,%ecx
+      6b:	85 c9                	test   %ecx,%ecx
+      6d:	0f 84 a5 00 00 00    	je     118 <main+0x118>
+    exit();
+  for(i = 0; i < nspec; i++)
+      73:	8b 15 e0 1f 00 00    	mov    0x1fe0,%edx
+      79:	7e 22                	jle    9d <main+0x9d>
+      7b:	69 c9 30 08 00 00    	imul   $0x830,%ecx,%ecx
+      81:	31 c0                	xor    %eax,%eax
+      83:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      87:	90                   	nop
+    nlive += specs[i].count;
+      88:	03 90 44 21 00 00    	add    0x2144(%eax),%edx
+  for(i = 0; i < nspec; i++)
+      8e:	05 30 08 00 00       	add    $0x830,%eax
+      93:	39 c1                	cmp    %eax,%ecx
+      95:	75 f1                	jne    88 <main+0x88>
+      97:	89 15 e0 1f 00 00    	mov    %edx,0x1fe0
+  if(nlive > MAXLIVE){
+      9d:	83 3d e0 1f 00 00 18 	cmpl   $0x18,0x1fe0
+      a4:	0f 8e 9c 00 00 00    	jle    146 <main+0x146>
+    printf(2, "schedbench: at most %d jobs at once\n", MAXLIVE);
+      aa:	50                   	push   %eax
+      ab:	6a 18                	push   $0x18
+      ad:	68 24 19 00 00       	push   $0x1924
+      b2:	6a 02                	push   $0x2
+      b4:	e8 f7 13 00 00       	call   14b0 <printf>
+    exit();
+      b9:	e8 25 12 00 00       	call   12e3 <exit>
+  ticks = argc > 1 ? atoi(argv[1]) : 1000;
+      be:	83 ec 0c             	sub    $0xc,%esp
+      c1:	ff 76 04             	push   0x4(%esi)
+      c4:	e8 a7 11 00 00       	call   1270 <atoi>
+  text = defspec;
+      c9:	8b 3d a0 1f 00 00    	mov    0x1fa0,%edi
+  if(argc > 2 && strcmp(argv[2], "-") != 0 && (text = readspec(argv[2])) == 0){
+      cf:	83 c4 10             	add    $0x10,%esp
+  ticks = argc > 1 ? atoi(argv[1]) : 1000;
+      d2:	89 45 b4             	mov    %eax,-0x4c(%ebp)
+  if(argc > 2 && strcmp(argv[2], "-") != 0 && (text = readspec(argv[2])) == 0){
+      d5:	83 fb 02             	cmp    $0x2,%ebx
+      d8:	74 16                	je     f0 <main+0xf0>
+      da:	50                   	push   %eax
+      db:	50                   	push   %eax
+      dc:	68 42 18 00 00       	push   $0x1842
+      e1:	ff 76 08             	push   0x8(%esi)
+      e4:	e8 e7 0f 00 00       	call   10d0 <strcmp>
+      e9:	83 c4 10             	add    $0x10,%esp
+      ec:	85 c0                	test   %eax,%eax
+      ee:	75 2d                	jne    11d <main+0x11d>
+  if(getSchedStat(&st) < 0)
+      f0:	83 ec 0c             	sub    $0xc,%esp
+      f3:	68 c0 62 00 00       	push   $0x62c0
+      f8:	e8 be 12 00 00       	call   13bb <getSchedStat>
+      fd:	83 c4 10             	add    $0x10,%esp
+     100:	85 c0                	test   %eax,%eax
+     102:	78 14                	js     118 <main+0x118>
+  maxqueue = st.nqueue;
+     104:	a1 c8 62 00 00       	mov    0x62c8,%eax
+  if(ticks < 1 || parsespec(text) < 0 || nspec == 0)
+     109:	83 7d b4 00          	cmpl   $0x0,-0x4c(%ebp)
+  maxqueue = st.nqueue;
+     10d:	a3 c0 1f 00 00       	mov    %eax,0x1fc0
+  if(ticks < 1 || parsespec(text) < 0 || nspec == 0)
+     112:	0f 8f 39 ff ff ff    	jg     51 <main+0x51>
+    exit();
+     118:	e8 c6 11 00 00       	call   12e3 <exit>
+  if(argc > 2 && strcmp(argv[2], "-") != 0 && (text = readspec(argv[2])) == 0){
+     11d:	83 ec 0c             	sub    $0xc,%esp
+     120:	ff 76 08             	push   0x8(%esi)
+     123:	e8 28 0c 00 00       	call   d50 <readspec>
+     128:	83 c4 10             	add    $0x10,%esp
+     12b:	89 c7                	mov    %eax,%edi
+     12d:	85 c0                	test   %eax,%eax
+     12f:	75 bf                	jne    f0 <main+0xf0>
+    printf(2, "schedbench: cannot read %s\n", argv[2]);
+     131:	50                   	push   %eax
+     132:	ff 76 08             	push   0x8(%esi)
+     135:	68 44 18 00 00       	push   $0x1844
+     13a:	6a 02                	push   $0x2
+     13c:	e8 6f 13 00 00       	call   14b0 <printf>
+    exit();
+     141:	e8 9d 11 00 00       	call   12e3 <exit>
+  }
+
+  calibrate();
+     146:	e8 35 03 00 00       	call   480 <calibrate>
+  if(getSchedAttr(0, &self) < 0)
+     14b:	57                   	push   %edi
+     14c:	57                   	push   %edi
+     14d:	68 c4 1f 00 00       	push   $0x1fc4
+     152:	6a 00                	push   $0x0
+     154:	e8 82 12 00 00       	call   13db <getSchedAttr>
+     159:	83 c4 10             	add    $0x10,%esp
+     15c:	85 c0                	test   %eax,%eax
+     15e:	78 b8                	js     118 <main+0x118>
+    exit();
+  if(argc > 3)
+     160:	83 fb 03             	cmp    $0x3,%ebx
+     163:	0f 8f 8b 01 00 00    	jg     2f4 <main+0x2f4>
+    schedSeed(atoi(argv[3]));
+  if(pipe(res) < 0)
+     169:	83 ec 0c             	sub    $0xc,%esp
+     16c:	8d 45 bc             	lea    -0x44(%ebp),%eax
+     16f:	50                   	push   %eax
+     170:	e8 7e 11 00 00       	call   12f3 <pipe>
+     175:	83 c4 10             	add    $0x10,%esp
+     178:	85 c0                	test   %eax,%eax
+     17a:	78 9c                	js     118 <main+0x118>
+    exit();
+
+  start = uptime();
+     17c:	e8 fa 11 00 00       	call   137b <uptime>
+     181:	89 45 b0             	mov    %eax,-0x50(%ebp)
+  if((timer = fork()) == 0){
+     184:	e8 52 11 00 00       	call   12db <fork>
+     189:	85 c0                	test   %eax,%eax
+     18b:	0f 84 41 02 00 00    	je     3d2 <main+0x3d2>
+    sleep(ticks);
+    r.cls = -1;
+    write(res[1], &r, sizeof(r));
+    exit();
+  }
+  if(timer < 0){
+     191:	0f 88 6c 02 00 00    	js     403 <main+0x403>
+     197:	89 45 ac             	mov    %eax,-0x54(%ebp)
+     19a:	b9 40 21 00 00       	mov    $0x2140,%ecx
+    printf(2, "schedbench: fork failed\n");
+    exit();
+  }
+  failed = 0;
+     19f:	31 db                	xor    %ebx,%ebx
+  l = 0;
+     1a1:	31 f6                	xor    %esi,%esi
+  for(i = 0; i < nspec && !failed; i++)
+     1a3:	31 ff                	xor    %edi,%edi
+     1a5:	39 35 20 21 00 00    	cmp    %esi,0x2120
+     1ab:	7e 76                	jle    223 <main+0x223>
+     1ad:	85 db                	test   %ebx,%ebx
+     1af:	75 72                	jne    223 <main+0x223>
+    for(j = 0; j < specs[i].count && !failed; j++)
+     1b1:	83 79 04 00          	cmpl   $0x0,0x4(%ecx)
+     1b5:	7e 43                	jle    1fa <main+0x1fa>
+     1b7:	89 f8                	mov    %edi,%eax
+     1b9:	89 4d b4             	mov    %ecx,-0x4c(%ebp)
+     1bc:	89 df                	mov    %ebx,%edi
+     1be:	89 c3                	mov    %eax,%ebx
+     1c0:	eb 0e                	jmp    1d0 <main+0x1d0>
+     1c2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+     1c8:	85 c0                	test   %eax,%eax
+     1ca:	0f 88 16 01 00 00    	js     2e6 <main+0x2e6>
+      failed = launch(l++, i, res[1]) < 0;
+     1d0:	83 ec 04             	sub    $0x4,%esp
+     1d3:	89 d8                	mov    %ebx,%eax
+     1d5:	ff 75 c0             	push   -0x40(%ebp)
+     1d8:	83 c3 01             	add    $0x1,%ebx
+     1db:	56                   	push   %esi
+    for(j = 0; j < specs[i].count && !failed; j++)
+     1dc:	83 c7 01             	add    $0x1,%edi
+      failed = launch(l++, i, res[1]) < 0;
+     1df:	50                   	push   %eax
+     1e0:	e8 0b 07 00 00       	call   8f0 <launch>
+    for(j = 0; j < specs[i].count && !failed; j++)
+     1e5:	8b 55 b4             	mov    -0x4c(%ebp),%edx
+     1e8:	83 c4 10             	add    $0x10,%esp
+     1eb:	39 7a 04             	cmp    %edi,0x4(%edx)
+     1ee:	7f d8                	jg     1c8 <main+0x1c8>
+      failed = launch(l++, i, res[1]) < 0;
+     1f0:	c1 e8 1f             	shr    $0x1f,%eax
+     1f3:	8b 4d b4             	mov    -0x4c(%ebp),%ecx
+     1f6:	89 df                	mov    %ebx,%edi
+     1f8:	89 c3                	mov    %eax,%ebx
+  for(i = 0; i < nspec && !failed; i++)
+     1fa:	83 c6 01             	add    $0x1,%esi
+     1fd:	81 c1 30 08 00 00    	add    $0x830,%ecx
+     203:	eb a0                	jmp    1a5 <main+0x1a5>
+    if((l = slot(r.pid)) < 0)
+      continue;
+    while(!live[l].reaped && (pid = wait()) > 0)
+      if((j = slot(pid)) >= 0)
+        live[j].reaped = 1;
+    failed = launch(l, live[l].cls, res[1]) < 0;
+     205:	8b 75 b4             	mov    -0x4c(%ebp),%esi
+     208:	51                   	push   %ecx
+     209:	ff 75 c0             	push   -0x40(%ebp)
+     20c:	6b c6 0c             	imul   $0xc,%esi,%eax
+     20f:	ff b0 04 20 00 00    	push   0x2004(%eax)
+     215:	56                   	push   %esi
+     216:	e8 d5 06 00 00       	call   8f0 <launch>
+     21b:	83 c4 10             	add    $0x10,%esp
+     21e:	c1 e8 1f             	shr    $0x1f,%eax
+     221:	89 c3                	mov    %eax,%ebx
+  while(!failed && read(res[0], &r, sizeof(r)) == sizeof(r) && r.cls >= 0){
+     223:	85 db                	test   %ebx,%ebx
+     225:	0f 85 eb 01 00 00    	jne    416 <main+0x416>
+     22b:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+     22e:	52                   	push   %edx
+     22f:	6a 14                	push   $0x14
+     231:	50                   	push   %eax
+     232:	ff 75 bc             	push   -0x44(%ebp)
+     235:	e8 c1 10 00 00       	call   12fb <read>
+     23a:	83 c4 10             	add    $0x10,%esp
+     23d:	83 f8 14             	cmp    $0x14,%eax
+     240:	0f 85 c9 00 00 00    	jne    30f <main+0x30f>
+     246:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+     24a:	0f 88 bf 00 00 00    	js     30f <main+0x30f>
+    record(&r);
+     250:	83 ec 0c             	sub    $0xc,%esp
+     253:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+     256:	50                   	push   %eax
+     257:	e8 64 0b 00 00       	call   dc0 <record>
+  for(l = 0; l < nlive; l++)
+     25c:	8b 15 e0 1f 00 00    	mov    0x1fe0,%edx
+    if((l = slot(r.pid)) < 0)
+     262:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  for(l = 0; l < nlive; l++)
+     265:	83 c4 10             	add    $0x10,%esp
+     268:	85 d2                	test   %edx,%edx
+     26a:	7e bf                	jle    22b <main+0x22b>
+     26c:	31 f6                	xor    %esi,%esi
+     26e:	eb 07                	jmp    277 <main+0x277>
+     270:	83 c6 01             	add    $0x1,%esi
+     273:	39 d6                	cmp    %edx,%esi
+     275:	74 b4                	je     22b <main+0x22b>
+    if(live[l].pid == pid)
+     277:	8d 04 76             	lea    (%esi,%esi,2),%eax
+     27a:	8d 3c 85 00 00 00 00 	lea    0x0(,%eax,4),%edi
+     281:	3b 0c 85 00 20 00 00 	cmp    0x2000(,%eax,4),%ecx
+     288:	75 e6                	jne    270 <main+0x270>
+     28a:	89 75 b4             	mov    %esi,-0x4c(%ebp)
+    while(!live[l].reaped && (pid = wait()) > 0)
+     28d:	81 c7 00 20 00 00    	add    $0x2000,%edi
+     293:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     297:	90                   	nop
+     298:	8b 5f 08             	mov    0x8(%edi),%ebx
+     29b:	85 db                	test   %ebx,%ebx
+     29d:	0f 85 62 ff ff ff    	jne    205 <main+0x205>
+     2a3:	e8 43 10 00 00       	call   12eb <wait>
+     2a8:	89 c2                	mov    %eax,%edx
+     2aa:	85 c0                	test   %eax,%eax
+     2ac:	0f 8e 53 ff ff ff    	jle    205 <main+0x205>
+  for(l = 0; l < nlive; l++)
+     2b2:	8b 0d e0 1f 00 00    	mov    0x1fe0,%ecx
+     2b8:	85 c9                	test   %ecx,%ecx
+     2ba:	7f 0b                	jg     2c7 <main+0x2c7>
+     2bc:	eb da                	jmp    298 <main+0x298>
+     2be:	66 90                	xchg   %ax,%ax
+     2c0:	83 c3 01             	add    $0x1,%ebx
+     2c3:	39 cb                	cmp    %ecx,%ebx
+     2c5:	74 d1                	je     298 <main+0x298>
+    if(live[l].pid == pid)
+     2c7:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+     2ca:	8d 34 85 00 00 00 00 	lea    0x0(,%eax,4),%esi
+     2d1:	3b 14 85 00 20 00 00 	cmp    0x2000(,%eax,4),%edx
+     2d8:	75 e6                	jne    2c0 <main+0x2c0>
+        live[j].reaped = 1;
+     2da:	c7 86 08 20 00 00 01 	movl   $0x1,0x2008(%esi)
+     2e1:	00 00 00 
+     2e4:	eb b2                	jmp    298 <main+0x298>
+     2e6:	89 df                	mov    %ebx,%edi
+     2e8:	89 d1                	mov    %edx,%ecx
+     2ea:	bb 01 00 00 00       	mov    $0x1,%ebx
+     2ef:	e9 06 ff ff ff       	jmp    1fa <main+0x1fa>
+    schedSeed(atoi(argv[3]));
+     2f4:	83 ec 0c             	sub    $0xc,%esp
+     2f7:	ff 76 0c             	push   0xc(%esi)
+     2fa:	e8 71 0f 00 00       	call   1270 <atoi>
+     2ff:	89 04 24             	mov    %eax,(%esp)
+     302:	e8 c4 10 00 00       	call   13cb <schedSeed>
+     307:	83 c4 10             	add    $0x10,%esp
+     30a:	e9 5a fe ff ff       	jmp    169 <main+0x169>
+  }
+  elapsed = uptime() - start;
+     30f:	e8 67 10 00 00       	call   137b <uptime>
+     314:	89 45 ac             	mov    %eax,-0x54(%ebp)
+  for(l = 0; l < nlive; l++)
+     317:	bf 00 20 00 00       	mov    $0x2000,%edi
+     31c:	31 f6                	xor    %esi,%esi
+     31e:	eb 06                	jmp    326 <main+0x326>
+
+  if(failed)
+    kill(timer);
+  for(l = 0; l < nlive; l++)
+     320:	83 c6 01             	add    $0x1,%esi
+     323:	83 c7 0c             	add    $0xc,%edi
+     326:	39 35 e0 1f 00 00    	cmp    %esi,0x1fe0
+     32c:	7e 1a                	jle    348 <main+0x348>
+    if(live[l].pid > 0 && !live[l].reaped)
+     32e:	8b 07                	mov    (%edi),%eax
+     330:	85 c0                	test   %eax,%eax
+     332:	7e ec                	jle    320 <main+0x320>
+     334:	83 7f 08 00          	cmpl   $0x0,0x8(%edi)
+     338:	75 e6                	jne    320 <main+0x320>
+      kill(live[l].pid);
+     33a:	83 ec 0c             	sub    $0xc,%esp
+     33d:	50                   	push   %eax
+     33e:	e8 d0 0f 00 00       	call   1313 <kill>
+     343:	83 c4 10             	add    $0x10,%esp
+     346:	eb d8                	jmp    320 <main+0x320>
+     348:	89 5d a8             	mov    %ebx,-0x58(%ebp)
+  while((pid = wait()) > 0){
+    for(l = 0; l < nlive; l++)
+      if(live[l].pid == pid && specs[live[l].cls].kind >= K_FILE){
+        filename(name, pid);
+     34b:	8d 7d c4             	lea    -0x3c(%ebp),%edi
+  while((pid = wait()) > 0){
+     34e:	e8 98 0f 00 00       	call   12eb <wait>
+     353:	89 c1                	mov    %eax,%ecx
+     355:	85 c0                	test   %eax,%eax
+     357:	7e 55                	jle    3ae <main+0x3ae>
+    for(l = 0; l < nlive; l++)
+     359:	31 db                	xor    %ebx,%ebx
+     35b:	83 3d e0 1f 00 00 00 	cmpl   $0x0,0x1fe0
+     362:	be 00 20 00 00       	mov    $0x2000,%esi
+     367:	7f 15                	jg     37e <main+0x37e>
+     369:	eb e3                	jmp    34e <main+0x34e>
+     36b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     36f:	90                   	nop
+     370:	83 c3 01             	add    $0x1,%ebx
+     373:	83 c6 0c             	add    $0xc,%esi
+     376:	39 1d e0 1f 00 00    	cmp    %ebx,0x1fe0
+     37c:	7e d0                	jle    34e <main+0x34e>
+      if(live[l].pid == pid && specs[live[l].cls].kind >= K_FILE){
+     37e:	39 0e                	cmp    %ecx,(%esi)
+     380:	75 ee                	jne    370 <main+0x370>
+     382:	69 46 04 30 08 00 00 	imul   $0x830,0x4(%esi),%eax
+     389:	83 b8 40 21 00 00 01 	cmpl   $0x1,0x2140(%eax)
+     390:	7e de                	jle    370 <main+0x370>
+        filename(name, pid);
+     392:	50                   	push   %eax
+     393:	50                   	push   %eax
+     394:	51                   	push   %ecx
+     395:	89 4d b4             	mov    %ecx,-0x4c(%ebp)
+     398:	57                   	push   %edi
+     399:	e8 72 01 00 00       	call   510 <filename>
+        unlink(name);
+     39e:	89 3c 24             	mov    %edi,(%esp)
+     3a1:	e8 8d 0f 00 00       	call   1333 <unlink>
+     3a6:	8b 4d b4             	mov    -0x4c(%ebp),%ecx
+     3a9:	83 c4 10             	add    $0x10,%esp
+     3ac:	eb c2                	jmp    370 <main+0x370>
+      }
+  }
+  if(!failed)
+     3ae:	8b 5d a8             	mov    -0x58(%ebp),%ebx
+     3b1:	85 db                	test   %ebx,%ebx
+     3b3:	0f 85 5f fd ff ff    	jne    118 <main+0x118>
+  elapsed = uptime() - start;
+     3b9:	8b 45 ac             	mov    -0x54(%ebp),%eax
+     3bc:	8b 7d b0             	mov    -0x50(%ebp),%edi
+    report(elapsed);
+     3bf:	83 ec 0c             	sub    $0xc,%esp
+  elapsed = uptime() - start;
+     3c2:	29 f8                	sub    %edi,%eax
+    report(elapsed);
+     3c4:	50                   	push   %eax
+     3c5:	e8 36 0b 00 00       	call   f00 <report>
+     3ca:	83 c4 10             	add    $0x10,%esp
+     3cd:	e9 46 fd ff ff       	jmp    118 <main+0x118>
+    close(res[0]);
+     3d2:	83 ec 0c             	sub    $0xc,%esp
+     3d5:	ff 75 bc             	push   -0x44(%ebp)
+     3d8:	e8 2e 0f 00 00       	call   130b <close>
+    sleep(ticks);
+     3dd:	5e                   	pop    %esi
+     3de:	ff 75 b4             	push   -0x4c(%ebp)
+     3e1:	e8 8d 0f 00 00       	call   1373 <sleep>
+    write(res[1], &r, sizeof(r));
+     3e6:	83 c4 0c             	add    $0xc,%esp
+     3e9:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+    r.cls = -1;
+     3ec:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+    write(res[1], &r, sizeof(r));
+     3f3:	6a 14                	push   $0x14
+     3f5:	50                   	push   %eax
+     3f6:	ff 75 c0             	push   -0x40(%ebp)
+     3f9:	e8 05 0f 00 00       	call   1303 <write>
+    exit();
+     3fe:	e8 e0 0e 00 00       	call   12e3 <exit>
+    printf(2, "schedbench: fork failed\n");
+     403:	53                   	push   %ebx
+     404:	53                   	push   %ebx
+     405:	68 d8 17 00 00       	push   $0x17d8
+     40a:	6a 02                	push   $0x2
+     40c:	e8 9f 10 00 00       	call   14b0 <printf>
+    exit();
+     411:	e8 cd 0e 00 00       	call   12e3 <exit>
+  elapsed = uptime() - start;
+     416:	8b 55 ac             	mov    -0x54(%ebp),%edx
+     419:	89 55 b4             	mov    %edx,-0x4c(%ebp)
+     41c:	e8 5a 0f 00 00       	call   137b <uptime>
+    kill(timer);
+     421:	8b 55 b4             	mov    -0x4c(%ebp),%edx
+     424:	83 ec 0c             	sub    $0xc,%esp
+  elapsed = uptime() - start;
+     427:	89 45 ac             	mov    %eax,-0x54(%ebp)
+    kill(timer);
+     42a:	52                   	push   %edx
+     42b:	e8 e3 0e 00 00       	call   1313 <kill>
+     430:	83 c4 10             	add    $0x10,%esp
+     433:	e9 df fe ff ff       	jmp    317 <main+0x317>
+     438:	66 90                	xchg   %ax,%ax
+     43a:	66 90                	xchg   %ax,%ax
+     43c:	66 90                	xchg   %ax,%ax
+     43e:	66 90                	xchg   %ax,%ax
+
+00000440 <spin>:
+{
+     440:	55                   	push   %ebp
+     441:	89 e5                	mov    %esp,%ebp
+     443:	83 ec 10             	sub    $0x10,%esp
+  uint total = n * loopspertick;
+     446:	8b 55 08             	mov    0x8(%ebp),%edx
+     449:	0f af 15 dc 1f 00 00 	imul   0x1fdc,%edx
+  for(i = 0; i < total; i++)
+     450:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+     457:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     45a:	39 d0                	cmp    %edx,%eax
+     45c:	73 12                	jae    470 <spin+0x30>
+     45e:	66 90                	xchg   %ax,%ax
+     460:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     463:	83 c0 01             	add    $0x1,%eax
+     466:	89 45 fc             	mov    %eax,-0x4(%ebp)
+     469:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     46c:	39 d0                	cmp    %edx,%eax
+     46e:	72 f0                	jb     460 <spin+0x20>
+}
+     470:	c9                   	leave
+     471:	c3                   	ret
+     472:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     479:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000480 <calibrate>:
+{
+     480:	55                   	push   %ebp
+     481:	89 e5                	mov    %esp,%ebp
+     483:	56                   	push   %esi
+     484:	53                   	push   %ebx
+     485:	83 ec 10             	sub    $0x10,%esp
+  t0 = uptime();
+     488:	e8 ee 0e 00 00       	call   137b <uptime>
+     48d:	89 c3                	mov    %eax,%ebx
+  while(uptime() == t0)
+     48f:	90                   	nop
+     490:	e8 e6 0e 00 00       	call   137b <uptime>
+     495:	39 c3                	cmp    %eax,%ebx
+     497:	74 f7                	je     490 <calibrate+0x10>
+  t0 = uptime();
+     499:	e8 dd 0e 00 00       	call   137b <uptime>
+  n = 0;
+     49e:	31 db                	xor    %ebx,%ebx
+  while(uptime() < t0 + 10){
+     4a0:	8d 70 0a             	lea    0xa(%eax),%esi
+     4a3:	e8 d3 0e 00 00       	call   137b <uptime>
+     4a8:	39 f0                	cmp    %esi,%eax
+     4aa:	73 3e                	jae    4ea <calibrate+0x6a>
+     4ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    for(i = 0; i < 1000; i++)
+     4b0:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     4b7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     4ba:	3d e7 03 00 00       	cmp    $0x3e7,%eax
+     4bf:	77 1a                	ja     4db <calibrate+0x5b>
+     4c1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     4c8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     4cb:	83 c0 01             	add    $0x1,%eax
+     4ce:	89 45 f4             	mov    %eax,-0xc(%ebp)
+     4d1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     4d4:	3d e7 03 00 00       	cmp    $0x3e7,%eax
+     4d9:	76 ed                	jbe    4c8 <calibrate+0x48>
+    n += 1000;
+     4db:	81 c3 e8 03 00 00    	add    $0x3e8,%ebx
+  while(uptime() < t0 + 10){
+     4e1:	e8 95 0e 00 00       	call   137b <uptime>
+     4e6:	39 f0                	cmp    %esi,%eax
+     4e8:	72 c6                	jb     4b0 <calibrate+0x30>
+  loopspertick = n / 10;
+     4ea:	b8 cd cc cc cc       	mov    $0xcccccccd,%eax
+     4ef:	f7 e3                	mul    %ebx
+     4f1:	c1 ea 03             	shr    $0x3,%edx
+     4f4:	89 15 dc 1f 00 00    	mov    %edx,0x1fdc
+}
+     4fa:	83 c4 10             	add    $0x10,%esp
+     4fd:	5b                   	pop    %ebx
+     4fe:	5e                   	pop    %esi
+     4ff:	5d                   	pop    %ebp
+     500:	c3                   	ret
+     501:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     508:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     50f:	90                   	nop
+
+00000510 <filename>:
+{
+     510:	55                   	push   %ebp
+     511:	89 e5                	mov    %esp,%ebp
+     513:	57                   	push   %edi
+     514:	56                   	push   %esi
+  n = 0;
+     515:	31 f6                	xor    %esi,%esi
+{
+     517:	53                   	push   %ebx
+     518:	83 ec 10             	sub    $0x10,%esp
+     51b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+     51e:	66 90                	xchg   %ax,%ax
+    digits[n++] = '0' + pid % 10;
+     520:	b8 67 66 66 66       	mov    $0x66666667,%eax
+     525:	89 f3                	mov    %esi,%ebx
+     527:	83 c6 01             	add    $0x1,%esi
+     52a:	f7 e9                	imul   %ecx
+     52c:	89 c8                	mov    %ecx,%eax
+     52e:	c1 f8 1f             	sar    $0x1f,%eax
+     531:	c1 fa 02             	sar    $0x2,%edx
+     534:	29 c2                	sub    %eax,%edx
+     536:	89 c8                	mov    %ecx,%eax
+     538:	8d 3c 92             	lea    (%edx,%edx,4),%edi
+     53b:	01 ff                	add    %edi,%edi
+     53d:	29 f8                	sub    %edi,%eax
+     53f:	83 c0 30             	add    $0x30,%eax
+     542:	88 44 35 e7          	mov    %al,-0x19(%ebp,%esi,1)
+    pid /= 10;
+     546:	89 c8                	mov    %ecx,%eax
+     548:	89 d1                	mov    %edx,%ecx
+  } while(pid > 0);
+     54a:	83 f8 09             	cmp    $0x9,%eax
+     54d:	7f d1                	jg     520 <filename+0x10>
+  *name++ = 's';
+     54f:	8b 7d 08             	mov    0x8(%ebp),%edi
+     552:	0f b7 05 d8 19 00 00 	movzwl 0x19d8,%eax
+     559:	66 89 07             	mov    %ax,(%edi)
+  while(n > 0)
+     55c:	8d 45 e8             	lea    -0x18(%ebp),%eax
+  *name++ = 'b';
+     55f:	8d 57 02             	lea    0x2(%edi),%edx
+     562:	01 c3                	add    %eax,%ebx
+     564:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    *name++ = digits[--n];
+     568:	0f b6 03             	movzbl (%ebx),%eax
+  while(n > 0)
+     56b:	8d 4d e8             	lea    -0x18(%ebp),%ecx
+    *name++ = digits[--n];
+     56e:	83 c2 01             	add    $0x1,%edx
+     571:	88 42 ff             	mov    %al,-0x1(%edx)
+  while(n > 0)
+     574:	89 d8                	mov    %ebx,%eax
+     576:	83 eb 01             	sub    $0x1,%ebx
+     579:	39 c1                	cmp    %eax,%ecx
+     57b:	75 eb                	jne    568 <filename+0x58>
+  *name = 0;
+     57d:	c6 44 37 02 00       	movb   $0x0,0x2(%edi,%esi,1)
+}
+     582:	83 c4 10             	add    $0x10,%esp
+     585:	5b                   	pop    %ebx
+     586:	5e                   	pop    %esi
+     587:	5f                   	pop    %edi
+     588:	5d                   	pop    %ebp
+     589:	c3                   	ret
+     58a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000590 <echo>:
+{
+     590:	55                   	push   %ebp
+     591:	89 e5                	mov    %esp,%ebp
+     593:	57                   	push   %edi
+     594:	56                   	push   %esi
+     595:	53                   	push   %ebx
+     596:	8d 5d e7             	lea    -0x19(%ebp),%ebx
+     599:	83 ec 1c             	sub    $0x1c,%esp
+     59c:	8b 75 08             	mov    0x8(%ebp),%esi
+     59f:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  while(read(in, &c, 1) == 1){
+     5a2:	eb 1e                	jmp    5c2 <echo+0x32>
+     5a4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    sleep(io);
+     5a8:	83 ec 0c             	sub    $0xc,%esp
+     5ab:	ff 75 10             	push   0x10(%ebp)
+     5ae:	e8 c0 0d 00 00       	call   1373 <sleep>
+    write(out, &c, 1);
+     5b3:	83 c4 0c             	add    $0xc,%esp
+     5b6:	6a 01                	push   $0x1
+     5b8:	53                   	push   %ebx
+     5b9:	57                   	push   %edi
+     5ba:	e8 44 0d 00 00       	call   1303 <write>
+     5bf:	83 c4 10             	add    $0x10,%esp
+  while(read(in, &c, 1) == 1){
+     5c2:	83 ec 04             	sub    $0x4,%esp
+     5c5:	6a 01                	push   $0x1
+     5c7:	53                   	push   %ebx
+     5c8:	56                   	push   %esi
+     5c9:	e8 2d 0d 00 00       	call   12fb <read>
+     5ce:	83 c4 10             	add    $0x10,%esp
+     5d1:	83 f8 01             	cmp    $0x1,%eax
+     5d4:	74 d2                	je     5a8 <echo+0x18>
+  exit();
+     5d6:	e8 08 0d 00 00       	call   12e3 <exit>
+     5db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     5df:	90                   	nop
+
+000005e0 <job>:
+{
+     5e0:	55                   	push   %ebp
+     5e1:	89 e5                	mov    %esp,%ebp
+     5e3:	57                   	push   %edi
+     5e4:	56                   	push   %esi
+     5e5:	53                   	push   %ebx
+     5e6:	81 ec 5c 02 00 00    	sub    $0x25c,%esp
+  r.cls = cls;
+     5ec:	8b 45 08             	mov    0x8(%ebp),%eax
+     5ef:	89 85 d4 fd ff ff    	mov    %eax,-0x22c(%ebp)
+  r.pid = getpid();
+     5f5:	e8 69 0d 00 00       	call   1363 <getpid>
+     5fa:	89 85 d8 fd ff ff    	mov    %eax,-0x228(%ebp)
+  r.arrival = arrival;
+     600:	8b 45 0c             	mov    0xc(%ebp),%eax
+     603:	89 85 dc fd ff ff    	mov    %eax,-0x224(%ebp)
+  r.first = uptime();
+     609:	e8 6d 0d 00 00       	call   137b <uptime>
+     60e:	89 85 e0 fd ff ff    	mov    %eax,-0x220(%ebp)
+  if(s->kind == K_PIPE || s->kind == K_MIX){
+     614:	69 45 08 30 08 00 00 	imul   $0x830,0x8(%ebp),%eax
+     61b:	8d b0 40 21 00 00    	lea    0x2140(%eax),%esi
+     621:	8b 80 40 21 00 00    	mov    0x2140(%eax),%eax
+     627:	83 e0 fd             	and    $0xfffffffd,%eax
+     62a:	83 f8 01             	cmp    $0x1,%eax
+     62d:	75 35                	jne    664 <job+0x84>
+    if(pipe(to) < 0 || pipe(from) < 0)
+     62f:	83 ec 0c             	sub    $0xc,%esp
+     632:	8d 85 b4 fd ff ff    	lea    -0x24c(%ebp),%eax
+     638:	50                   	push   %eax
+     639:	e8 b5 0c 00 00       	call   12f3 <pipe>
+     63e:	83 c4 10             	add    $0x10,%esp
+     641:	85 c0                	test   %eax,%eax
+     643:	78 1a                	js     65f <job+0x7f>
+     645:	83 ec 0c             	sub    $0xc,%esp
+     648:	8d 85 bc fd ff ff    	lea    -0x244(%ebp),%eax
+     64e:	50                   	push   %eax
+     64f:	e8 9f 0c 00 00       	call   12f3 <pipe>
+     654:	83 c4 10             	add    $0x10,%esp
+     657:	85 c0                	test   %eax,%eax
+     659:	0f 89 ef 01 00 00    	jns    84e <job+0x26e>
+      exit();
+     65f:	e8 7f 0c 00 00       	call   12e3 <exit>
+  filename(name, getpid());
+     664:	e8 fa 0c 00 00       	call   1363 <getpid>
+     669:	52                   	push   %edx
+     66a:	52                   	push   %edx
+     66b:	50                   	push   %eax
+     66c:	8d 85 c4 fd ff ff    	lea    -0x23c(%ebp),%eax
+     672:	89 85 a0 fd ff ff    	mov    %eax,-0x260(%ebp)
+     678:	50                   	push   %eax
+     679:	e8 92 fe ff ff       	call   510 <filename>
+  memset(buf, 'x', sizeof(buf));
+     67e:	83 c4 0c             	add    $0xc,%esp
+     681:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+     687:	68 00 02 00 00       	push   $0x200
+     68c:	6a 78                	push   $0x78
+     68e:	89 85 a4 fd ff ff    	mov    %eax,-0x25c(%ebp)
+     694:	50                   	push   %eax
+     695:	e8 c6 0a 00 00       	call   1160 <memset>
+  for(i = 0; i < s->rounds; i++){
+     69a:	83 c4 10             	add    $0x10,%esp
+     69d:	83 7e 1c 00          	cmpl   $0x0,0x1c(%esi)
+  helper = -1;
+     6a1:	c7 85 9c fd ff ff ff 	movl   $0xffffffff,-0x264(%ebp)
+     6a8:	ff ff ff 
+  for(i = 0; i < s->rounds; i++){
+     6ab:	0f 8e 9b 00 00 00    	jle    74c <job+0x16c>
+    spin(s->burst);
+     6b1:	69 7d 08 30 08 00 00 	imul   $0x830,0x8(%ebp),%edi
+  for(i = 0; i < s->rounds; i++){
+     6b8:	31 f6                	xor    %esi,%esi
+    spin(s->burst);
+     6ba:	81 c7 40 21 00 00    	add    $0x2140,%edi
+  for(i = 0; i < total; i++)
+     6c0:	c7 85 b0 fd ff ff 00 	movl   $0x0,-0x250(%ebp)
+     6c7:	00 00 00 
+  uint total = n * loopspertick;
+     6ca:	8b 57 14             	mov    0x14(%edi),%edx
+     6cd:	0f af 15 dc 1f 00 00 	imul   0x1fdc,%edx
+  for(i = 0; i < total; i++)
+     6d4:	8b 85 b0 fd ff ff    	mov    -0x250(%ebp),%eax
+     6da:	39 d0                	cmp    %edx,%eax
+     6dc:	73 1b                	jae    6f9 <job+0x119>
+     6de:	66 90                	xchg   %ax,%ax
+     6e0:	8b 85 b0 fd ff ff    	mov    -0x250(%ebp),%eax
+     6e6:	83 c0 01             	add    $0x1,%eax
+     6e9:	89 85 b0 fd ff ff    	mov    %eax,-0x250(%ebp)
+     6ef:	8b 85 b0 fd ff ff    	mov    -0x250(%ebp),%eax
+     6f5:	39 d0                	cmp    %edx,%eax
+     6f7:	72 e7                	jb     6e0 <job+0x100>
+    if(s->kind == K_PIPE || (s->kind == K_MIX && i % 2 == 0)){
+     6f9:	8b 07                	mov    (%edi),%eax
+     6fb:	83 f8 01             	cmp    $0x1,%eax
+     6fe:	0f 84 8c 00 00 00    	je     790 <job+0x1b0>
+     704:	83 f8 03             	cmp    $0x3,%eax
+     707:	0f 84 bb 00 00 00    	je     7c8 <job+0x1e8>
+    } else if(s->kind == K_FILE || s->kind == K_MIX){
+     70d:	83 e8 02             	sub    $0x2,%eax
+     710:	83 f8 01             	cmp    $0x1,%eax
+     713:	0f 86 b7 00 00 00    	jbe    7d0 <job+0x1f0>
+  for(i = 0; i < s->rounds; i++){
+     719:	83 c6 01             	add    $0x1,%esi
+     71c:	39 77 1c             	cmp    %esi,0x1c(%edi)
+     71f:	7f 9f                	jg     6c0 <job+0xe0>
+  if(helper > 0){
+     721:	83 bd 9c fd ff ff 00 	cmpl   $0x0,-0x264(%ebp)
+     728:	7e 22                	jle    74c <job+0x16c>
+    close(to[1]);
+     72a:	83 ec 0c             	sub    $0xc,%esp
+     72d:	ff b5 b8 fd ff ff    	push   -0x248(%ebp)
+     733:	e8 d3 0b 00 00       	call   130b <close>
+    close(from[0]);
+     738:	5b                   	pop    %ebx
+     739:	ff b5 bc fd ff ff    	push   -0x244(%ebp)
+     73f:	e8 c7 0b 00 00       	call   130b <close>
+    wait();
+     744:	e8 a2 0b 00 00       	call   12eb <wait>
+     749:	83 c4 10             	add    $0x10,%esp
+  if(s->kind == K_FILE || s->kind == K_MIX)
+     74c:	69 45 08 30 08 00 00 	imul   $0x830,0x8(%ebp),%eax
+     753:	8b 80 40 21 00 00    	mov    0x2140(%eax),%eax
+     759:	83 e8 02             	sub    $0x2,%eax
+     75c:	83 f8 01             	cmp    $0x1,%eax
+     75f:	0f 86 d3 00 00 00    	jbe    838 <job+0x258>
+  r.end = uptime();
+     765:	e8 11 0c 00 00       	call   137b <uptime>
+     76a:	89 85 e4 fd ff ff    	mov    %eax,-0x21c(%ebp)
+  write(resfd, &r, sizeof(r));
+     770:	8d 85 d4 fd ff ff    	lea    -0x22c(%ebp),%eax
+     776:	51                   	push   %ecx
+     777:	6a 14                	push   $0x14
+     779:	50                   	push   %eax
+     77a:	ff 75 10             	push   0x10(%ebp)
+     77d:	e8 81 0b 00 00       	call   1303 <write>
+  exit();
+     782:	e8 5c 0b 00 00       	call   12e3 <exit>
+     787:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     78e:	66 90                	xchg   %ax,%ax
+      write(to[1], "x", 1);
+     790:	83 ec 04             	sub    $0x4,%esp
+     793:	6a 01                	push   $0x1
+     795:	68 70 18 00 00       	push   $0x1870
+     79a:	ff b5 b8 fd ff ff    	push   -0x248(%ebp)
+     7a0:	e8 5e 0b 00 00       	call   1303 <write>
+      read(from[0], &c, 1);
+     7a5:	83 c4 0c             	add    $0xc,%esp
+     7a8:	8d 85 af fd ff ff    	lea    -0x251(%ebp),%eax
+     7ae:	6a 01                	push   $0x1
+     7b0:	50                   	push   %eax
+     7b1:	ff b5 bc fd ff ff    	push   -0x244(%ebp)
+     7b7:	e8 3f 0b 00 00       	call   12fb <read>
+     7bc:	83 c4 10             	add    $0x10,%esp
+     7bf:	e9 55 ff ff ff       	jmp    719 <job+0x139>
+     7c4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(s->kind == K_PIPE || (s->kind == K_MIX && i % 2 == 0)){
+     7c8:	f7 c6 01 00 00 00    	test   $0x1,%esi
+     7ce:	74 c0                	je     790 <job+0x1b0>
+      if((fd = open(name, O_CREATE | O_WRONLY)) < 0)
+     7d0:	83 ec 08             	sub    $0x8,%esp
+     7d3:	68 01 02 00 00       	push   $0x201
+     7d8:	ff b5 a0 fd ff ff    	push   -0x260(%ebp)
+     7de:	e8 40 0b 00 00       	call   1323 <open>
+     7e3:	83 c4 10             	add    $0x10,%esp
+     7e6:	85 c0                	test   %eax,%eax
+     7e8:	0f 88 71 fe ff ff    	js     65f <job+0x7f>
+      for(k = 0; k < s->io; k++)
+     7ee:	83 7f 18 00          	cmpl   $0x0,0x18(%edi)
+     7f2:	7e 33                	jle    827 <job+0x247>
+     7f4:	89 b5 98 fd ff ff    	mov    %esi,-0x268(%ebp)
+     7fa:	31 db                	xor    %ebx,%ebx
+     7fc:	89 c6                	mov    %eax,%esi
+     7fe:	66 90                	xchg   %ax,%ax
+        write(fd, buf, sizeof(buf));
+     800:	83 ec 04             	sub    $0x4,%esp
+      for(k = 0; k < s->io; k++)
+     803:	83 c3 01             	add    $0x1,%ebx
+        write(fd, buf, sizeof(buf));
+     806:	68 00 02 00 00       	push   $0x200
+     80b:	ff b5 a4 fd ff ff    	push   -0x25c(%ebp)
+     811:	56                   	push   %esi
+     812:	e8 ec 0a 00 00       	call   1303 <write>
+      for(k = 0; k < s->io; k++)
+     817:	83 c4 10             	add    $0x10,%esp
+     81a:	39 5f 18             	cmp    %ebx,0x18(%edi)
+     81d:	7f e1                	jg     800 <job+0x220>
+     81f:	89 f0                	mov    %esi,%eax
+     821:	8b b5 98 fd ff ff    	mov    -0x268(%ebp),%esi
+      close(fd);
+     827:	83 ec 0c             	sub    $0xc,%esp
+     82a:	50                   	push   %eax
+     82b:	e8 db 0a 00 00       	call   130b <close>
+     830:	83 c4 10             	add    $0x10,%esp
+     833:	e9 e1 fe ff ff       	jmp    719 <job+0x139>
+    unlink(name);
+     838:	83 ec 0c             	sub    $0xc,%esp
+     83b:	ff b5 a0 fd ff ff    	push   -0x260(%ebp)
+     841:	e8 ed 0a 00 00       	call   1333 <unlink>
+     846:	83 c4 10             	add    $0x10,%esp
+     849:	e9 17 ff ff ff       	jmp    765 <job+0x185>
+    if((helper = fork()) == 0){
+     84e:	e8 88 0a 00 00       	call   12db <fork>
+     853:	89 85 9c fd ff ff    	mov    %eax,-0x264(%ebp)
+     859:	85 c0                	test   %eax,%eax
+     85b:	75 31                	jne    88e <job+0x2ae>
+      close(to[1]);
+     85d:	83 ec 0c             	sub    $0xc,%esp
+     860:	ff b5 b8 fd ff ff    	push   -0x248(%ebp)
+     866:	e8 a0 0a 00 00       	call   130b <close>
+      close(from[0]);
+     86b:	5b                   	pop    %ebx
+     86c:	ff b5 bc fd ff ff    	push   -0x244(%ebp)
+     872:	e8 94 0a 00 00       	call   130b <close>
+      echo(to[0], from[1], s->io);
+     877:	83 c4 0c             	add    $0xc,%esp
+     87a:	ff 76 18             	push   0x18(%esi)
+     87d:	ff b5 c0 fd ff ff    	push   -0x240(%ebp)
+     883:	ff b5 b4 fd ff ff    	push   -0x24c(%ebp)
+     889:	e8 02 fd ff ff       	call   590 <echo>
+    close(to[0]);
+     88e:	83 ec 0c             	sub    $0xc,%esp
+     891:	ff b5 b4 fd ff ff    	push   -0x24c(%ebp)
+     897:	e8 6f 0a 00 00       	call   130b <close>
+    close(from[1]);
+     89c:	5f                   	pop    %edi
+     89d:	ff b5 c0 fd ff ff    	push   -0x240(%ebp)
+     8a3:	e8 63 0a 00 00       	call   130b <close>
+  filename(name, getpid());
+     8a8:	e8 b6 0a 00 00       	call   1363 <getpid>
+     8ad:	5a                   	pop    %edx
+     8ae:	59                   	pop    %ecx
+     8af:	50                   	push   %eax
+     8b0:	8d 85 c4 fd ff ff    	lea    -0x23c(%ebp),%eax
+     8b6:	89 85 a0 fd ff ff    	mov    %eax,-0x260(%ebp)
+     8bc:	50                   	push   %eax
+     8bd:	e8 4e fc ff ff       	call   510 <filename>
+  memset(buf, 'x', sizeof(buf));
+     8c2:	83 c4 0c             	add    $0xc,%esp
+     8c5:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+     8cb:	68 00 02 00 00       	push   $0x200
+     8d0:	6a 78                	push   $0x78
+     8d2:	89 85 a4 fd ff ff    	mov    %eax,-0x25c(%ebp)
+     8d8:	50                   	push   %eax
+     8d9:	e8 82 08 00 00       	call   1160 <memset>
+  for(i = 0; i < s->rounds; i++){
+     8de:	83 c4 10             	add    $0x10,%esp
+     8e1:	83 7e 1c 00          	cmpl   $0x0,0x1c(%esi)
+     8e5:	0f 8f c6 fd ff ff    	jg     6b1 <job+0xd1>
+     8eb:	e9 31 fe ff ff       	jmp    721 <job+0x141>
+
+000008f0 <launch>:
+{
+     8f0:	55                   	push   %ebp
+     8f1:	89 e5                	mov    %esp,%ebp
+     8f3:	57                   	push   %edi
+     8f4:	56                   	push   %esi
+     8f5:	53                   	push   %ebx
+  if(setSchedAttr(&me, 1, &a) < 0){
+     8f6:	8d 5d cc             	lea    -0x34(%ebp),%ebx
+{
+     8f9:	83 ec 30             	sub    $0x30,%esp
+  a.queue = s->queue;
+     8fc:	69 75 0c 30 08 00 00 	imul   $0x830,0xc(%ebp),%esi
+{
+     903:	8b 7d 08             	mov    0x8(%ebp),%edi
+  a.mask = SA_QUEUE | SA_TICKETS | SA_PRIORITY | SA_QUANTUM | SA_FLAGS;
+     906:	c7 45 d0 1f 00 00 00 	movl   $0x1f,-0x30(%ebp)
+  a.quantum = 0;
+     90d:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%ebp)
+  a.flags = SAF_INHERIT;
+     914:	c7 45 e4 01 00 00 00 	movl   $0x1,-0x1c(%ebp)
+  a.queue = s->queue;
+     91b:	8b 86 48 21 00 00    	mov    0x2148(%esi),%eax
+  me = 0;
+     921:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%ebp)
+  a.queue = s->queue;
+     928:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  a.tickets = s->tickets;
+     92b:	8b 86 4c 21 00 00    	mov    0x214c(%esi),%eax
+     931:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  a.priority = s->priority;
+     934:	8b 86 50 21 00 00    	mov    0x2150(%esi),%eax
+  a.queue = s->queue;
+     93a:	81 c6 40 21 00 00    	add    $0x2140,%esi
+  a.priority = s->priority;
+     940:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  if(setSchedAttr(&me, 1, &a) < 0){
+     943:	8d 45 d0             	lea    -0x30(%ebp),%eax
+     946:	50                   	push   %eax
+     947:	6a 01                	push   $0x1
+     949:	53                   	push   %ebx
+     94a:	e8 84 0a 00 00       	call   13d3 <setSchedAttr>
+     94f:	83 c4 10             	add    $0x10,%esp
+     952:	85 c0                	test   %eax,%eax
+     954:	78 56                	js     9ac <launch+0xbc>
+  arrival = uptime();
+     956:	e8 20 0a 00 00       	call   137b <uptime>
+     95b:	89 c6                	mov    %eax,%esi
+  if((pid = fork()) == 0)
+     95d:	e8 79 09 00 00       	call   12db <fork>
+     962:	85 c0                	test   %eax,%eax
+     964:	0f 84 8c 00 00 00    	je     9f6 <launch+0x106>
+  if(pid < 0){
+     96a:	78 62                	js     9ce <launch+0xde>
+  live[l].pid = pid;
+     96c:	8d 14 7f             	lea    (%edi,%edi,2),%edx
+  if(setSchedAttr(&me, 1, &self) < 0){
+     96f:	83 ec 04             	sub    $0x4,%esp
+  live[l].pid = pid;
+     972:	c1 e2 02             	shl    $0x2,%edx
+     975:	89 82 00 20 00 00    	mov    %eax,0x2000(%edx)
+  live[l].cls = cls;
+     97b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  live[l].reaped = 0;
+     97e:	c7 82 08 20 00 00 00 	movl   $0x0,0x2008(%edx)
+     985:	00 00 00 
+  live[l].cls = cls;
+     988:	89 82 04 20 00 00    	mov    %eax,0x2004(%edx)
+  if(setSchedAttr(&me, 1, &self) < 0){
+     98e:	68 c4 1f 00 00       	push   $0x1fc4
+     993:	6a 01                	push   $0x1
+     995:	53                   	push   %ebx
+     996:	e8 38 0a 00 00       	call   13d3 <setSchedAttr>
+     99b:	83 c4 10             	add    $0x10,%esp
+     99e:	85 c0                	test   %eax,%eax
+     9a0:	78 40                	js     9e2 <launch+0xf2>
+  return 0;
+     9a2:	31 c0                	xor    %eax,%eax
+}
+     9a4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     9a7:	5b                   	pop    %ebx
+     9a8:	5e                   	pop    %esi
+     9a9:	5f                   	pop    %edi
+     9aa:	5d                   	pop    %ebp
+     9ab:	c3                   	ret
+    printf(2, "schedbench: spec line %d: cannot set queue %d, %d tickets\n",
+     9ac:	83 ec 0c             	sub    $0xc,%esp
+     9af:	ff 76 0c             	push   0xc(%esi)
+     9b2:	ff 76 08             	push   0x8(%esi)
+     9b5:	ff 76 20             	push   0x20(%esi)
+     9b8:	68 74 18 00 00       	push   $0x1874
+     9bd:	6a 02                	push   $0x2
+     9bf:	e8 ec 0a 00 00       	call   14b0 <printf>
+    return -1;
+     9c4:	83 c4 20             	add    $0x20,%esp
+     9c7:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     9cc:	eb d6                	jmp    9a4 <launch+0xb4>
+    printf(2, "schedbench: fork failed\n");
+     9ce:	83 ec 08             	sub    $0x8,%esp
+     9d1:	68 d8 17 00 00       	push   $0x17d8
+     9d6:	6a 02                	push   $0x2
+     9d8:	e8 d3 0a 00 00       	call   14b0 <printf>
+    return -1;
+     9dd:	83 c4 10             	add    $0x10,%esp
+     9e0:	eb e5                	jmp    9c7 <launch+0xd7>
+    printf(2, "schedbench: cannot restore own attributes\n");
+     9e2:	83 ec 08             	sub    $0x8,%esp
+     9e5:	68 b0 18 00 00       	push   $0x18b0
+     9ea:	6a 02                	push   $0x2
+     9ec:	e8 bf 0a 00 00       	call   14b0 <printf>
+    return -1;
+     9f1:	83 c4 10             	add    $0x10,%esp
+     9f4:	eb d1                	jmp    9c7 <launch+0xd7>
+    job(cls, arrival, resfd);
+     9f6:	50                   	push   %eax
+     9f7:	ff 75 10             	push   0x10(%ebp)
+     9fa:	56                   	push   %esi
+     9fb:	ff 75 0c             	push   0xc(%ebp)
+     9fe:	e8 dd fb ff ff       	call   5e0 <job>
+     a03:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     a0a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000a10 <slot>:
+{
+     a10:	55                   	push   %ebp
+     a11:	89 e5                	mov    %esp,%ebp
+     a13:	53                   	push   %ebx
+  for(l = 0; l < nlive; l++)
+     a14:	8b 0d e0 1f 00 00    	mov    0x1fe0,%ecx
+{
+     a1a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  for(l = 0; l < nlive; l++)
+     a1d:	85 c9                	test   %ecx,%ecx
+     a1f:	7e 1f                	jle    a40 <slot+0x30>
+     a21:	31 c0                	xor    %eax,%eax
+     a23:	eb 0a                	jmp    a2f <slot+0x1f>
+     a25:	8d 76 00             	lea    0x0(%esi),%esi
+     a28:	83 c0 01             	add    $0x1,%eax
+     a2b:	39 c8                	cmp    %ecx,%eax
+     a2d:	74 11                	je     a40 <slot+0x30>
+    if(live[l].pid == pid)
+     a2f:	8d 14 40             	lea    (%eax,%eax,2),%edx
+     a32:	39 1c 95 00 20 00 00 	cmp    %ebx,0x2000(,%edx,4)
+     a39:	75 ed                	jne    a28 <slot+0x18>
+}
+     a3b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     a3e:	c9                   	leave
+     a3f:	c3                   	ret
+     a40:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  return -1;
+     a43:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+     a48:	c9                   	leave
+     a49:	c3                   	ret
+     a4a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000a50 <thousandths>:
+{
+     a50:	55                   	push   %ebp
+     a51:	89 e5                	mov    %esp,%ebp
+     a53:	57                   	push   %edi
+     a54:	56                   	push   %esi
+     a55:	53                   	push   %ebx
+     a56:	83 ec 18             	sub    $0x18,%esp
+     a59:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  n = atoi(s) * 1000;
+     a5c:	53                   	push   %ebx
+     a5d:	e8 0e 08 00 00       	call   1270 <atoi>
+     a62:	69 f0 e8 03 00 00    	imul   $0x3e8,%eax,%esi
+  if((s = strchr(s, '.')) == 0)
+     a68:	58                   	pop    %eax
+     a69:	5a                   	pop    %edx
+     a6a:	6a 2e                	push   $0x2e
+     a6c:	53                   	push   %ebx
+     a6d:	e8 0e 07 00 00       	call   1180 <strchr>
+     a72:	83 c4 10             	add    $0x10,%esp
+     a75:	85 c0                	test   %eax,%eax
+     a77:	74 3c                	je     ab5 <thousandths+0x65>
+  for(s++, scale = 100; *s >= '0' && *s <= '9' && scale > 0; s++, scale /= 10)
+     a79:	0f b6 48 01          	movzbl 0x1(%eax),%ecx
+     a7d:	8d 51 d0             	lea    -0x30(%ecx),%edx
+     a80:	80 fa 09             	cmp    $0x9,%dl
+     a83:	77 30                	ja     ab5 <thousandths+0x65>
+     a85:	8d 58 01             	lea    0x1(%eax),%ebx
+     a88:	ba 64 00 00 00       	mov    $0x64,%edx
+     a8d:	bf cd cc cc cc       	mov    $0xcccccccd,%edi
+    n += (*s - '0') * scale;
+     a92:	83 e9 30             	sub    $0x30,%ecx
+  for(s++, scale = 100; *s >= '0' && *s <= '9' && scale > 0; s++, scale /= 10)
+     a95:	89 d0                	mov    %edx,%eax
+     a97:	83 c3 01             	add    $0x1,%ebx
+    n += (*s - '0') * scale;
+     a9a:	0f be c9             	movsbl %cl,%ecx
+     a9d:	0f af ca             	imul   %edx,%ecx
+  for(s++, scale = 100; *s >= '0' && *s <= '9' && scale > 0; s++, scale /= 10)
+     aa0:	f7 e7                	mul    %edi
+    n += (*s - '0') * scale;
+     aa2:	01 ce                	add    %ecx,%esi
+  for(s++, scale = 100; *s >= '0' && *s <= '9' && scale > 0; s++, scale /= 10)
+     aa4:	0f b6 0b             	movzbl (%ebx),%ecx
+     aa7:	c1 ea 03             	shr    $0x3,%edx
+     aaa:	8d 41 d0             	lea    -0x30(%ecx),%eax
+     aad:	3c 09                	cmp    $0x9,%al
+     aaf:	77 04                	ja     ab5 <thousandths+0x65>
+     ab1:	85 d2                	test   %edx,%edx
+     ab3:	75 dd                	jne    a92 <thousandths+0x42>
+}
+     ab5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     ab8:	89 f0                	mov    %esi,%eax
+     aba:	5b                   	pop    %ebx
+     abb:	5e                   	pop    %esi
+     abc:	5f                   	pop    %edi
+     abd:	5d                   	pop    %ebp
+     abe:	c3                   	ret
+     abf:	90                   	nop
+
+00000ac0 <word>:
+{
+     ac0:	55                   	push   %ebp
+     ac1:	89 e5                	mov    %esp,%ebp
+     ac3:	53                   	push   %ebx
+     ac4:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  char *s = *sp, *w;
+     ac7:	8b 13                	mov    (%ebx),%edx
+  while(*s == ' ' || *s == '\t')
+     ac9:	0f b6 02             	movzbl (%edx),%eax
+     acc:	3c 09                	cmp    $0x9,%al
+     ace:	74 08                	je     ad8 <word+0x18>
+     ad0:	3c 20                	cmp    $0x20,%al
+     ad2:	75 13                	jne    ae7 <word+0x27>
+     ad4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     ad8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    s++;
+     adc:	83 c2 01             	add    $0x1,%edx
+  while(*s == ' ' || *s == '\t')
+     adf:	3c 20                	cmp    $0x20,%al
+     ae1:	74 f5                	je     ad8 <word+0x18>
+     ae3:	3c 09                	cmp    $0x9,%al
+     ae5:	74 f1                	je     ad8 <word+0x18>
+  while(*s && *s != ' ' && *s != '\t')
+     ae7:	89 d1                	mov    %edx,%ecx
+     ae9:	a8 df                	test   $0xdf,%al
+     aeb:	75 0e                	jne    afb <word+0x3b>
+     aed:	eb 31                	jmp    b20 <word+0x60>
+     aef:	90                   	nop
+     af0:	0f b6 41 01          	movzbl 0x1(%ecx),%eax
+    s++;
+     af4:	83 c1 01             	add    $0x1,%ecx
+  while(*s && *s != ' ' && *s != '\t')
+     af7:	a8 df                	test   $0xdf,%al
+     af9:	74 25                	je     b20 <word+0x60>
+     afb:	3c 09                	cmp    $0x9,%al
+     afd:	75 f1                	jne    af0 <word+0x30>
+    *s++ = 0;
+     aff:	c6 01 00             	movb   $0x0,(%ecx)
+     b02:	83 c1 01             	add    $0x1,%ecx
+  *sp = s;
+     b05:	89 0b                	mov    %ecx,(%ebx)
+  return *w ? w : 0;
+     b07:	31 c0                	xor    %eax,%eax
+     b09:	80 3a 00             	cmpb   $0x0,(%edx)
+     b0c:	0f 44 d0             	cmove  %eax,%edx
+}
+     b0f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     b12:	c9                   	leave
+     b13:	89 d0                	mov    %edx,%eax
+     b15:	c3                   	ret
+     b16:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     b1d:	8d 76 00             	lea    0x0(%esi),%esi
+  if(*s)
+     b20:	84 c0                	test   %al,%al
+     b22:	74 e1                	je     b05 <word+0x45>
+     b24:	eb d9                	jmp    aff <word+0x3f>
+     b26:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     b2d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000b30 <parseline>:
+{
+     b30:	55                   	push   %ebp
+     b31:	89 e5                	mov    %esp,%ebp
+     b33:	57                   	push   %edi
+     b34:	56                   	push   %esi
+  for(i = 0; i < 8; i++)
+     b35:	31 f6                	xor    %esi,%esi
+{
+     b37:	53                   	push   %ebx
+    if((w[i] = word(&line)) == 0)
+     b38:	8d 5d 08             	lea    0x8(%ebp),%ebx
+{
+     b3b:	83 ec 2c             	sub    $0x2c,%esp
+     b3e:	66 90                	xchg   %ax,%ax
+    if((w[i] = word(&line)) == 0)
+     b40:	83 ec 0c             	sub    $0xc,%esp
+     b43:	53                   	push   %ebx
+     b44:	e8 77 ff ff ff       	call   ac0 <word>
+     b49:	83 c4 10             	add    $0x10,%esp
+     b4c:	89 44 b5 c8          	mov    %eax,-0x38(%ebp,%esi,4)
+     b50:	85 c0                	test   %eax,%eax
+     b52:	0f 84 38 01 00 00    	je     c90 <parseline+0x160>
+  for(i = 0; i < 8; i++)
+     b58:	83 c6 01             	add    $0x1,%esi
+     b5b:	83 fe 08             	cmp    $0x8,%esi
+     b5e:	75 e0                	jne    b40 <parseline+0x10>
+  if(i == 0 || w[0][0] == '#')
+     b60:	8b 75 c8             	mov    -0x38(%ebp),%esi
+     b63:	80 3e 23             	cmpb   $0x23,(%esi)
+     b66:	0f 84 15 01 00 00    	je     c81 <parseline+0x151>
+  if(i < 8 || nspec == NCLASS)
+     b6c:	8b 1d 20 21 00 00    	mov    0x2120,%ebx
+     b72:	83 fb 08             	cmp    $0x8,%ebx
+     b75:	0f 84 21 01 00 00    	je     c9c <parseline+0x16c>
+  for(s->kind = 0; s->kind < 4; s->kind++)
+     b7b:	69 fb 30 08 00 00    	imul   $0x830,%ebx,%edi
+     b81:	31 c0                	xor    %eax,%eax
+     b83:	c7 87 40 21 00 00 00 	movl   $0x0,0x2140(%edi)
+     b8a:	00 00 00 
+     b8d:	eb 15                	jmp    ba4 <parseline+0x74>
+     b8f:	90                   	nop
+     b90:	8b 87 40 21 00 00    	mov    0x2140(%edi),%eax
+     b96:	83 c0 01             	add    $0x1,%eax
+     b99:	89 87 40 21 00 00    	mov    %eax,0x2140(%edi)
+     b9f:	83 f8 03             	cmp    $0x3,%eax
+     ba2:	7f 23                	jg     bc7 <parseline+0x97>
+    if(strcmp(w[0], kinds[s->kind]) == 0)
+     ba4:	83 ec 08             	sub    $0x8,%esp
+     ba7:	ff 34 85 a4 1f 00 00 	push   0x1fa4(,%eax,4)
+     bae:	56                   	push   %esi
+     baf:	e8 1c 05 00 00       	call   10d0 <strcmp>
+     bb4:	83 c4 10             	add    $0x10,%esp
+     bb7:	85 c0                	test   %eax,%eax
+     bb9:	75 d5                	jne    b90 <parseline+0x60>
+  for(s->kind = 0; s->kind < 4; s->kind++)
+     bbb:	69 c3 30 08 00 00    	imul   $0x830,%ebx,%eax
+     bc1:	8b 80 40 21 00 00    	mov    0x2140(%eax),%eax
+  if(s->kind == 4)
+     bc7:	83 f8 04             	cmp    $0x4,%eax
+     bca:	0f 84 cc 00 00 00    	je     c9c <parseline+0x16c>
+  s->count = atoi(w[1]);
+     bd0:	83 ec 0c             	sub    $0xc,%esp
+     bd3:	ff 75 cc             	push   -0x34(%ebp)
+     bd6:	69 db 30 08 00 00    	imul   $0x830,%ebx,%ebx
+     bdc:	e8 8f 06 00 00       	call   1270 <atoi>
+     be1:	89 83 44 21 00 00    	mov    %eax,0x2144(%ebx)
+  s->queue = atoi(w[2]);
+     be7:	58                   	pop    %eax
+     be8:	ff 75 d0             	push   -0x30(%ebp)
+     beb:	e8 80 06 00 00       	call   1270 <atoi>
+     bf0:	89 83 48 21 00 00    	mov    %eax,0x2148(%ebx)
+  s->tickets = atoi(w[3]);
+     bf6:	5a                   	pop    %edx
+     bf7:	ff 75 d4             	push   -0x2c(%ebp)
+     bfa:	e8 71 06 00 00       	call   1270 <atoi>
+     bff:	89 83 4c 21 00 00    	mov    %eax,0x214c(%ebx)
+  s->priority = thousandths(w[4]);
+     c05:	59                   	pop    %ecx
+     c06:	ff 75 d8             	push   -0x28(%ebp)
+     c09:	e8 42 fe ff ff       	call   a50 <thousandths>
+     c0e:	89 83 50 21 00 00    	mov    %eax,0x2150(%ebx)
+  s->burst = atoi(w[5]);
+     c14:	5e                   	pop    %esi
+     c15:	ff 75 dc             	push   -0x24(%ebp)
+     c18:	e8 53 06 00 00       	call   1270 <atoi>
+     c1d:	89 83 54 21 00 00    	mov    %eax,0x2154(%ebx)
+  s->io = atoi(w[6]);
+     c23:	5f                   	pop    %edi
+     c24:	ff 75 e0             	push   -0x20(%ebp)
+     c27:	e8 44 06 00 00       	call   1270 <atoi>
+     c2c:	89 83 58 21 00 00    	mov    %eax,0x2158(%ebx)
+  s->rounds = atoi(w[7]);
+     c32:	58                   	pop    %eax
+     c33:	ff 75 e4             	push   -0x1c(%ebp)
+     c36:	e8 35 06 00 00       	call   1270 <atoi>
+  s->line = n;
+     c3b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  if(s->count < 1 || s->rounds < 1 || s->tickets < 1 ||
+     c3e:	83 c4 10             	add    $0x10,%esp
+  s->rounds = atoi(w[7]);
+     c41:	89 83 5c 21 00 00    	mov    %eax,0x215c(%ebx)
+  s->line = n;
+     c47:	89 93 60 21 00 00    	mov    %edx,0x2160(%ebx)
+  s->count = atoi(w[1]);
+     c4d:	81 c3 40 21 00 00    	add    $0x2140,%ebx
+  if(s->count < 1 || s->rounds < 1 || s->tickets < 1 ||
+     c53:	8b 53 04             	mov    0x4(%ebx),%edx
+     c56:	85 d2                	test   %edx,%edx
+     c58:	7e 42                	jle    c9c <parseline+0x16c>
+     c5a:	85 c0                	test   %eax,%eax
+     c5c:	7e 3e                	jle    c9c <parseline+0x16c>
+     c5e:	8b 43 0c             	mov    0xc(%ebx),%eax
+     c61:	83 e8 01             	sub    $0x1,%eax
+     c64:	3d ff f9 00 00       	cmp    $0xf9ff,%eax
+     c69:	77 31                	ja     c9c <parseline+0x16c>
+     s->tickets > MAXTICKET || s->queue < 0 || s->queue > maxqueue)
+     c6b:	8b 43 08             	mov    0x8(%ebx),%eax
+     c6e:	85 c0                	test   %eax,%eax
+     c70:	78 2a                	js     c9c <parseline+0x16c>
+     c72:	3b 05 c0 1f 00 00    	cmp    0x1fc0,%eax
+     c78:	7f 22                	jg     c9c <parseline+0x16c>
+  nspec++;
+     c7a:	83 05 20 21 00 00 01 	addl   $0x1,0x2120
+    return 0;
+     c81:	31 c0                	xor    %eax,%eax
+}
+     c83:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     c86:	5b                   	pop    %ebx
+     c87:	5e                   	pop    %esi
+     c88:	5f                   	pop    %edi
+     c89:	5d                   	pop    %ebp
+     c8a:	c3                   	ret
+     c8b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     c8f:	90                   	nop
+  if(i == 0 || w[0][0] == '#')
+     c90:	85 f6                	test   %esi,%esi
+     c92:	74 ed                	je     c81 <parseline+0x151>
+     c94:	8b 45 c8             	mov    -0x38(%ebp),%eax
+     c97:	80 38 23             	cmpb   $0x23,(%eax)
+     c9a:	74 e5                	je     c81 <parseline+0x151>
+    return -1;
+     c9c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     ca1:	eb e0                	jmp    c83 <parseline+0x153>
+     ca3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     caa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000cb0 <parsespec>:
+{
+     cb0:	55                   	push   %ebp
+     cb1:	89 e5                	mov    %esp,%ebp
+     cb3:	57                   	push   %edi
+     cb4:	56                   	push   %esi
+     cb5:	53                   	push   %ebx
+     cb6:	83 ec 0c             	sub    $0xc,%esp
+     cb9:	8b 75 08             	mov    0x8(%ebp),%esi
+  for(n = 1, line = text; *line; n++, line = nl){
+     cbc:	80 3e 00             	cmpb   $0x0,(%esi)
+     cbf:	74 57                	je     d18 <parsespec+0x68>
+     cc1:	bb 01 00 00 00       	mov    $0x1,%ebx
+     cc6:	eb 29                	jmp    cf1 <parsespec+0x41>
+     cc8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     ccf:	90                   	nop
+      *nl++ = 0;
+     cd0:	c6 00 00             	movb   $0x0,(%eax)
+     cd3:	8d 78 01             	lea    0x1(%eax),%edi
+    if(parseline(line, n) < 0){
+     cd6:	83 ec 08             	sub    $0x8,%esp
+     cd9:	53                   	push   %ebx
+     cda:	56                   	push   %esi
+     cdb:	e8 50 fe ff ff       	call   b30 <parseline>
+     ce0:	83 c4 10             	add    $0x10,%esp
+     ce3:	85 c0                	test   %eax,%eax
+     ce5:	78 41                	js     d28 <parsespec+0x78>
+  for(n = 1, line = text; *line; n++, line = nl){
+     ce7:	83 c3 01             	add    $0x1,%ebx
+     cea:	80 3f 00             	cmpb   $0x0,(%edi)
+     ced:	74 29                	je     d18 <parsespec+0x68>
+     cef:	89 fe                	mov    %edi,%esi
+    if((nl = strchr(line, '\n')) != 0)
+     cf1:	83 ec 08             	sub    $0x8,%esp
+     cf4:	6a 0a                	push   $0xa
+     cf6:	56                   	push   %esi
+     cf7:	e8 84 04 00 00       	call   1180 <strchr>
+     cfc:	83 c4 10             	add    $0x10,%esp
+     cff:	85 c0                	test   %eax,%eax
+     d01:	75 cd                	jne    cd0 <parsespec+0x20>
+      nl = line + strlen(line);
+     d03:	83 ec 0c             	sub    $0xc,%esp
+     d06:	56                   	push   %esi
+     d07:	e8 24 04 00 00       	call   1130 <strlen>
+     d0c:	83 c4 10             	add    $0x10,%esp
+     d0f:	8d 3c 06             	lea    (%esi,%eax,1),%edi
+     d12:	eb c2                	jmp    cd6 <parsespec+0x26>
+     d14:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+}
+     d18:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  return 0;
+     d1b:	31 c0                	xor    %eax,%eax
+}
+     d1d:	5b                   	pop    %ebx
+     d1e:	5e                   	pop    %esi
+     d1f:	5f                   	pop    %edi
+     d20:	5d                   	pop    %ebp
+     d21:	c3                   	ret
+     d22:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      printf(2, "schedbench: bad spec line %d\n", n);
+     d28:	83 ec 04             	sub    $0x4,%esp
+     d2b:	53                   	push   %ebx
+     d2c:	68 f1 17 00 00       	push   $0x17f1
+     d31:	6a 02                	push   $0x2
+     d33:	e8 78 07 00 00       	call   14b0 <printf>
+      return -1;
+     d38:	83 c4 10             	add    $0x10,%esp
+}
+     d3b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return -1;
+     d3e:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+     d43:	5b                   	pop    %ebx
+     d44:	5e                   	pop    %esi
+     d45:	5f                   	pop    %edi
+     d46:	5d                   	pop    %ebp
+     d47:	c3                   	ret
+     d48:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     d4f:	90                   	nop
+
+00000d50 <readspec>:
+{
+     d50:	55                   	push   %ebp
+     d51:	89 e5                	mov    %esp,%ebp
+     d53:	56                   	push   %esi
+     d54:	53                   	push   %ebx
+  if((fd = open(file, O_RDONLY)) < 0)
+     d55:	83 ec 08             	sub    $0x8,%esp
+     d58:	6a 00                	push   $0x0
+     d5a:	ff 75 08             	push   0x8(%ebp)
+     d5d:	e8 c1 05 00 00       	call   1323 <open>
+     d62:	83 c4 10             	add    $0x10,%esp
+     d65:	85 c0                	test   %eax,%eax
+     d67:	78 3f                	js     da8 <readspec+0x58>
+  n = read(fd, text, sizeof(text) - 1);
+     d69:	83 ec 04             	sub    $0x4,%esp
+     d6c:	89 c3                	mov    %eax,%ebx
+     d6e:	68 ff 07 00 00       	push   $0x7ff
+     d73:	68 00 65 00 00       	push   $0x6500
+     d78:	50                   	push   %eax
+     d79:	e8 7d 05 00 00       	call   12fb <read>
+  close(fd);
+     d7e:	89 1c 24             	mov    %ebx,(%esp)
+  n = read(fd, text, sizeof(text) - 1);
+     d81:	89 c6                	mov    %eax,%esi
+  close(fd);
+     d83:	e8 83 05 00 00       	call   130b <close>
+  if(n < 0)
+     d88:	83 c4 10             	add    $0x10,%esp
+     d8b:	85 f6                	test   %esi,%esi
+     d8d:	78 19                	js     da8 <readspec+0x58>
+  text[n] = 0;
+     d8f:	c6 86 00 65 00 00 00 	movb   $0x0,0x6500(%esi)
+}
+     d96:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  return text;
+     d99:	b8 00 65 00 00       	mov    $0x6500,%eax
+}
+     d9e:	5b                   	pop    %ebx
+     d9f:	5e                   	pop    %esi
+     da0:	5d                   	pop    %ebp
+     da1:	c3                   	ret
+     da2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+     da8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    return 0;
+     dab:	31 c0                	xor    %eax,%eax
+}
+     dad:	5b                   	pop    %ebx
+     dae:	5e                   	pop    %esi
+     daf:	5d                   	pop    %ebp
+     db0:	c3                   	ret
+     db1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     db8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     dbf:	90                   	nop
+
+00000dc0 <record>:
+{
+     dc0:	55                   	push   %ebp
+     dc1:	89 e5                	mov    %esp,%ebp
+     dc3:	56                   	push   %esi
+     dc4:	53                   	push   %ebx
+     dc5:	8b 45 08             	mov    0x8(%ebp),%eax
+  struct spec *s = &specs[r->cls];
+     dc8:	8b 10                	mov    (%eax),%edx
+  turn = r->end - r->arrival;
+     dca:	8b 70 08             	mov    0x8(%eax),%esi
+     dcd:	8b 58 10             	mov    0x10(%eax),%ebx
+  resp = r->first - r->arrival;
+     dd0:	8b 48 0c             	mov    0xc(%eax),%ecx
+  s->turnsum += turn;
+     dd3:	69 c2 30 08 00 00    	imul   $0x830,%edx,%eax
+  turn = r->end - r->arrival;
+     dd9:	29 f3                	sub    %esi,%ebx
+  resp = r->first - r->arrival;
+     ddb:	29 f1                	sub    %esi,%ecx
+  s->turnsum += turn;
+     ddd:	01 98 68 21 00 00    	add    %ebx,0x2168(%eax)
+  s->respsum += resp;
+     de3:	01 88 6c 21 00 00    	add    %ecx,0x216c(%eax)
+  if(s->done < NSAMPLE){
+     de9:	8b 80 64 21 00 00    	mov    0x2164(%eax),%eax
+     def:	3d ff 00 00 00       	cmp    $0xff,%eax
+     df4:	7f 16                	jg     e0c <record+0x4c>
+    s->turn[s->done] = turn;
+     df6:	69 f2 0c 02 00 00    	imul   $0x20c,%edx,%esi
+     dfc:	01 c6                	add    %eax,%esi
+     dfe:	89 1c b5 70 21 00 00 	mov    %ebx,0x2170(,%esi,4)
+    s->resp[s->done] = resp;
+     e05:	89 0c b5 70 25 00 00 	mov    %ecx,0x2570(,%esi,4)
+  s->done++;
+     e0c:	69 d2 30 08 00 00    	imul   $0x830,%edx,%edx
+     e12:	83 c0 01             	add    $0x1,%eax
+}
+     e15:	5b                   	pop    %ebx
+     e16:	5e                   	pop    %esi
+     e17:	5d                   	pop    %ebp
+  s->done++;
+     e18:	89 82 64 21 00 00    	mov    %eax,0x2164(%edx)
+}
+     e1e:	c3                   	ret
+     e1f:	90                   	nop
+
+00000e20 <p99>:
+{
+     e20:	55                   	push   %ebp
+  if(n > NSAMPLE)
+     e21:	ba 00 01 00 00       	mov    $0x100,%edx
+{
+     e26:	89 e5                	mov    %esp,%ebp
+     e28:	57                   	push   %edi
+     e29:	56                   	push   %esi
+     e2a:	53                   	push   %ebx
+     e2b:	83 ec 04             	sub    $0x4,%esp
+     e2e:	8b 45 0c             	mov    0xc(%ebp),%eax
+     e31:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(n > NSAMPLE)
+     e34:	39 d0                	cmp    %edx,%eax
+     e36:	0f 4e d0             	cmovle %eax,%edx
+     e39:	89 55 f0             	mov    %edx,-0x10(%ebp)
+  for(i = 1; i < n; i++){
+     e3c:	83 f8 01             	cmp    $0x1,%eax
+     e3f:	7e 3b                	jle    e7c <p99+0x5c>
+     e41:	bf 01 00 00 00       	mov    $0x1,%edi
+     e46:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     e4d:	8d 76 00             	lea    0x0(%esi),%esi
+    x = v[i];
+     e50:	8b 34 bb             	mov    (%ebx,%edi,4),%esi
+    for(j = i; j > 0 && v[j-1] > x; j--)
+     e53:	8d 04 bb             	lea    (%ebx,%edi,4),%eax
+     e56:	eb 11                	jmp    e69 <p99+0x49>
+     e58:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     e5f:	90                   	nop
+      v[j] = v[j-1];
+     e60:	89 10                	mov    %edx,(%eax)
+    for(j = i; j > 0 && v[j-1] > x; j--)
+     e62:	8d 41 fc             	lea    -0x4(%ecx),%eax
+     e65:	39 c3                	cmp    %eax,%ebx
+     e67:	74 37                	je     ea0 <p99+0x80>
+     e69:	8b 50 fc             	mov    -0x4(%eax),%edx
+     e6c:	89 c1                	mov    %eax,%ecx
+     e6e:	39 d6                	cmp    %edx,%esi
+     e70:	72 ee                	jb     e60 <p99+0x40>
+    v[j] = x;
+     e72:	89 31                	mov    %esi,(%ecx)
+  for(i = 1; i < n; i++){
+     e74:	83 c7 01             	add    $0x1,%edi
+     e77:	39 7d f0             	cmp    %edi,-0x10(%ebp)
+     e7a:	7f d4                	jg     e50 <p99+0x30>
+  return v[n * 99 / 100];
+     e7c:	6b 4d f0 63          	imul   $0x63,-0x10(%ebp),%ecx
+     e80:	b8 1f 85 eb 51       	mov    $0x51eb851f,%eax
+     e85:	f7 e9                	imul   %ecx
+     e87:	c1 f9 1f             	sar    $0x1f,%ecx
+     e8a:	c1 fa 05             	sar    $0x5,%edx
+     e8d:	29 ca                	sub    %ecx,%edx
+     e8f:	8b 04 93             	mov    (%ebx,%edx,4),%eax
+}
+     e92:	83 c4 04             	add    $0x4,%esp
+     e95:	5b                   	pop    %ebx
+     e96:	5e                   	pop    %esi
+     e97:	5f                   	pop    %edi
+     e98:	5d                   	pop    %ebp
+     e99:	c3                   	ret
+     e9a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+     ea0:	89 d9                	mov    %ebx,%ecx
+  for(i = 1; i < n; i++){
+     ea2:	83 c7 01             	add    $0x1,%edi
+    v[j] = x;
+     ea5:	89 31                	mov    %esi,(%ecx)
+  for(i = 1; i < n; i++){
+     ea7:	39 7d f0             	cmp    %edi,-0x10(%ebp)
+     eaa:	7f a4                	jg     e50 <p99+0x30>
+     eac:	eb ce                	jmp    e7c <p99+0x5c>
+     eae:	66 90                	xchg   %ax,%ax
+
+00000eb0 <printavg>:
+{
+     eb0:	55                   	push   %ebp
+  printf(1, "%d.%d", a / b, a * 10 / b % 10);
+     eb1:	31 d2                	xor    %edx,%edx
+{
+     eb3:	89 e5                	mov    %esp,%ebp
+     eb5:	56                   	push   %esi
+     eb6:	53                   	push   %ebx
+     eb7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     eba:	8b 75 0c             	mov    0xc(%ebp),%esi
+  printf(1, "%d.%d", a / b, a * 10 / b % 10);
+     ebd:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+     ec0:	01 c0                	add    %eax,%eax
+     ec2:	f7 f6                	div    %esi
+     ec4:	ba cd cc cc cc       	mov    $0xcccccccd,%edx
+     ec9:	89 c1                	mov    %eax,%ecx
+     ecb:	f7 e2                	mul    %edx
+     ecd:	c1 ea 03             	shr    $0x3,%edx
+     ed0:	8d 04 92             	lea    (%edx,%edx,4),%eax
+     ed3:	31 d2                	xor    %edx,%edx
+     ed5:	01 c0                	add    %eax,%eax
+     ed7:	29 c1                	sub    %eax,%ecx
+     ed9:	89 d8                	mov    %ebx,%eax
+     edb:	f7 f6                	div    %esi
+     edd:	51                   	push   %ecx
+     ede:	50                   	push   %eax
+     edf:	68 0f 18 00 00       	push   $0x180f
+     ee4:	6a 01                	push   $0x1
+     ee6:	e8 c5 05 00 00       	call   14b0 <printf>
+}
+     eeb:	83 c4 10             	add    $0x10,%esp
+     eee:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     ef1:	5b                   	pop    %ebx
+     ef2:	5e                   	pop    %esi
+     ef3:	5d                   	pop    %ebp
+     ef4:	c3                   	ret
+     ef5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     efc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000f00 <report>:
+{
+     f00:	55                   	push   %ebp
+     f01:	89 e5                	mov    %esp,%ebp
+     f03:	57                   	push   %edi
+     f04:	56                   	push   %esi
+     f05:	53                   	push   %ebx
+     f06:	83 ec 10             	sub    $0x10,%esp
+  printf(1, "%d ticks\n", elapsed);
+     f09:	ff 75 08             	push   0x8(%ebp)
+     f0c:	68 15 18 00 00       	push   $0x1815
+     f11:	6a 01                	push   $0x1
+     f13:	e8 98 05 00 00       	call   14b0 <printf>
+  printf(1, "class kind  jobs  jobs/1000t  turnaround mean/p99  response mean/p99\n");
+     f18:	5a                   	pop    %edx
+     f19:	59                   	pop    %ecx
+     f1a:	68 dc 18 00 00       	push   $0x18dc
+     f1f:	6a 01                	push   $0x1
+     f21:	e8 8a 05 00 00       	call   14b0 <printf>
+  for(i = 0; i < nspec; i++){
+     f26:	8b 1d 20 21 00 00    	mov    0x2120,%ebx
+     f2c:	83 c4 10             	add    $0x10,%esp
+     f2f:	85 db                	test   %ebx,%ebx
+     f31:	0f 8e 61 01 00 00    	jle    1098 <report+0x198>
+     f37:	bb 70 21 00 00       	mov    $0x2170,%ebx
+     f3c:	31 ff                	xor    %edi,%edi
+     f3e:	e9 d4 00 00 00       	jmp    1017 <report+0x117>
+     f43:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     f47:	90                   	nop
+    printf(1, "  ");
+     f48:	83 ec 08             	sub    $0x8,%esp
+     f4b:	68 2c 18 00 00       	push   $0x182c
+     f50:	6a 01                	push   $0x1
+     f52:	e8 59 05 00 00       	call   14b0 <printf>
+    printavg(s->turnsum, s->done);
+     f57:	8b 73 f8             	mov    -0x8(%ebx),%esi
+  printf(1, "%d.%d", a / b, a * 10 / b % 10);
+     f5a:	31 d2                	xor    %edx,%edx
+     f5c:	8d 04 b6             	lea    (%esi,%esi,4),%eax
+     f5f:	01 c0                	add    %eax,%eax
+     f61:	f7 73 f4             	divl   -0xc(%ebx)
+     f64:	89 c1                	mov    %eax,%ecx
+     f66:	b8 cd cc cc cc       	mov    $0xcccccccd,%eax
+     f6b:	f7 e1                	mul    %ecx
+     f6d:	c1 ea 03             	shr    $0x3,%edx
+     f70:	8d 04 92             	lea    (%edx,%edx,4),%eax
+     f73:	31 d2                	xor    %edx,%edx
+     f75:	01 c0                	add    %eax,%eax
+     f77:	29 c1                	sub    %eax,%ecx
+     f79:	89 f0                	mov    %esi,%eax
+     f7b:	51                   	push   %ecx
+     f7c:	f7 73 f4             	divl   -0xc(%ebx)
+     f7f:	50                   	push   %eax
+     f80:	68 0f 18 00 00       	push   $0x180f
+     f85:	6a 01                	push   $0x1
+     f87:	e8 24 05 00 00       	call   14b0 <printf>
+    printf(1, "/%d  ", p99(s->turn, s->done));
+     f8c:	83 c4 18             	add    $0x18,%esp
+     f8f:	ff 73 f4             	push   -0xc(%ebx)
+     f92:	53                   	push   %ebx
+     f93:	e8 88 fe ff ff       	call   e20 <p99>
+     f98:	83 c4 0c             	add    $0xc,%esp
+     f9b:	50                   	push   %eax
+     f9c:	68 37 18 00 00       	push   $0x1837
+     fa1:	6a 01                	push   $0x1
+     fa3:	e8 08 05 00 00       	call   14b0 <printf>
+    printavg(s->respsum, s->done);
+     fa8:	8b 73 fc             	mov    -0x4(%ebx),%esi
+  printf(1, "%d.%d", a / b, a * 10 / b % 10);
+     fab:	31 d2                	xor    %edx,%edx
+     fad:	8d 04 b6             	lea    (%esi,%esi,4),%eax
+     fb0:	01 c0                	add    %eax,%eax
+     fb2:	f7 73 f4             	divl   -0xc(%ebx)
+     fb5:	89 c1                	mov    %eax,%ecx
+     fb7:	b8 cd cc cc cc       	mov    $0xcccccccd,%eax
+     fbc:	f7 e1                	mul    %ecx
+     fbe:	c1 ea 03             	shr    $0x3,%edx
+     fc1:	8d 04 92             	lea    (%edx,%edx,4),%eax
+     fc4:	31 d2                	xor    %edx,%edx
+     fc6:	01 c0                	add    %eax,%eax
+     fc8:	29 c1                	sub    %eax,%ecx
+     fca:	89 f0                	mov    %esi,%eax
+     fcc:	51                   	push   %ecx
+     fcd:	f7 73 f4             	divl   -0xc(%ebx)
+     fd0:	50                   	push   %eax
+     fd1:	68 0f 18 00 00       	push   $0x180f
+     fd6:	6a 01                	push   $0x1
+     fd8:	e8 d3 04 00 00       	call   14b0 <printf>
+    printf(1, "/%d\n", p99(s->resp, s->done));
+     fdd:	83 c4 18             	add    $0x18,%esp
+     fe0:	8d 83 00 04 00 00    	lea    0x400(%ebx),%eax
+     fe6:	ff 73 f4             	push   -0xc(%ebx)
+     fe9:	50                   	push   %eax
+     fea:	e8 31 fe ff ff       	call   e20 <p99>
+     fef:	83 c4 0c             	add    $0xc,%esp
+     ff2:	50                   	push   %eax
+     ff3:	68 3d 18 00 00       	push   $0x183d
+     ff8:	6a 01                	push   $0x1
+     ffa:	e8 b1 04 00 00       	call   14b0 <printf>
+     fff:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < nspec; i++){
+    1002:	83 c7 01             	add    $0x1,%edi
+    1005:	81 c3 30 08 00 00    	add    $0x830,%ebx
+    100b:	39 3d 20 21 00 00    	cmp    %edi,0x2120
+    1011:	0f 8e 81 00 00 00    	jle    1098 <report+0x198>
+    printf(1, "%d     %s  %d  ", i, kinds[s->kind], s->done);
+    1017:	83 ec 0c             	sub    $0xc,%esp
+    101a:	ff 73 f4             	push   -0xc(%ebx)
+    101d:	8b 43 d0             	mov    -0x30(%ebx),%eax
+    1020:	ff 34 85 a4 1f 00 00 	push   0x1fa4(,%eax,4)
+    1027:	57                   	push   %edi
+    1028:	68 1f 18 00 00       	push   $0x181f
+    102d:	6a 01                	push   $0x1
+    102f:	e8 7c 04 00 00       	call   14b0 <printf>
+    printavg(s->done * 1000, elapsed);
+    1034:	69 73 f4 e8 03 00 00 	imul   $0x3e8,-0xc(%ebx),%esi
+  printf(1, "%d.%d", a / b, a * 10 / b % 10);
+    103b:	31 d2                	xor    %edx,%edx
+    103d:	83 c4 20             	add    $0x20,%esp
+    1040:	8d 04 b6             	lea    (%esi,%esi,4),%eax
+    1043:	01 c0                	add    %eax,%eax
+    1045:	f7 75 08             	divl   0x8(%ebp)
+    1048:	89 c1                	mov    %eax,%ecx
+    104a:	b8 cd cc cc cc       	mov    $0xcccccccd,%eax
+    104f:	f7 e1                	mul    %ecx
+    1051:	c1 ea 03             	shr    $0x3,%edx
+    1054:	8d 04 92             	lea    (%edx,%edx,4),%eax
+    1057:	31 d2                	xor    %edx,%edx
+    1059:	01 c0                	add    %eax,%eax
+    105b:	29 c1                	sub    %eax,%ecx
+    105d:	89 f0                	mov    %esi,%eax
+    105f:	51                   	push   %ecx
+    1060:	f7 75 08             	divl   0x8(%ebp)
+    1063:	50                   	push   %eax
+    1064:	68 0f 18 00 00       	push   $0x180f
+    1069:	6a 01                	push   $0x1
+    106b:	e8 40 04 00 00       	call   14b0 <printf>
+    if(s->done == 0){
+    1070:	8b 43 f4             	mov    -0xc(%ebx),%eax
+    1073:	83 c4 10             	add    $0x10,%esp
+    1076:	85 c0                	test   %eax,%eax
+    1078:	0f 85 ca fe ff ff    	jne    f48 <report+0x48>
+      printf(1, "  -  -\n");
+    107e:	83 ec 08             	sub    $0x8,%esp
+    1081:	68 2f 18 00 00       	push   $0x182f
+    1086:	6a 01                	push   $0x1
+    1088:	e8 23 04 00 00       	call   14b0 <printf>
+      continue;
+    108d:	83 c4 10             	add    $0x10,%esp
+    1090:	e9 6d ff ff ff       	jmp    1002 <report+0x102>
+    1095:	8d 76 00             	lea    0x0(%esi),%esi
+}
+    1098:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    109b:	5b                   	pop    %ebx
+    109c:	5e                   	pop    %esi
+    109d:	5f                   	pop    %edi
+    109e:	5d                   	pop    %ebp
+    109f:	c3                   	ret
+
+000010a0 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+    10a0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+    10a1:	31 c0                	xor    %eax,%eax
+{
+    10a3:	89 e5                	mov    %esp,%ebp
+    10a5:	53                   	push   %ebx
+    10a6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+    10a9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+    10ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+    10b0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+    10b4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+    10b7:	83 c0 01             	add    $0x1,%eax
+    10ba:	84 d2                	test   %dl,%dl
+    10bc:	75 f2                	jne    10b0 <strcpy+0x10>
+    ;
+  return os;
+}
+    10be:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    10c1:	89 c8                	mov    %ecx,%eax
+    10c3:	c9                   	leave
+    10c4:	c3                   	ret
+    10c5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    10cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000010d0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+    10d0:	55                   	push   %ebp
+    10d1:	89 e5                	mov    %esp,%ebp
+    10d3:	53                   	push   %ebx
+    10d4:	8b 55 08             	mov    0x8(%ebp),%edx
+    10d7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+    10da:	0f b6 02             	movzbl (%edx),%eax
+    10dd:	84 c0                	test   %al,%al
+    10df:	75 17                	jne    10f8 <strcmp+0x28>
+    10e1:	eb 3a                	jmp    111d <strcmp+0x4d>
+    10e3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    10e7:	90                   	nop
+    10e8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+    10ec:	83 c2 01             	add    $0x1,%edx
+    10ef:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+    10f2:	84 c0                	test   %al,%al
+    10f4:	74 1a                	je     1110 <strcmp+0x40>
+    p++, q++;
+    10f6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+    10f8:	0f b6 19             	movzbl (%ecx),%ebx
+    10fb:	38 c3                	cmp    %al,%bl
+    10fd:	74 e9                	je     10e8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+    10ff:	29 d8                	sub    %ebx,%eax
+}
+    1101:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1104:	c9                   	leave
+    1105:	c3                   	ret
+    1106:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    110d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+    1110:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+    1114:	31 c0                	xor    %eax,%eax
+    1116:	29 d8                	sub    %ebx,%eax
+}
+    1118:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    111b:	c9                   	leave
+    111c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+    111d:	0f b6 19             	movzbl (%ecx),%ebx
+    1120:	31 c0                	xor    %eax,%eax
+    1122:	eb db                	jmp    10ff <strcmp+0x2f>
+    1124:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    112b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    112f:	90                   	nop
+
+00001130 <strlen>:
+
+uint
+strlen(const char *s)
+{
+    1130:	55                   	push   %ebp
+    1131:	89 e5                	mov    %esp,%ebp
+    1133:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+    1136:	80 3a 00             	cmpb   $0x0,(%edx)
+    1139:	74 15                	je     1150 <strlen+0x20>
+    113b:	31 c0                	xor    %eax,%eax
+    113d:	8d 76 00             	lea    0x0(%esi),%esi
+    1140:	83 c0 01             	add    $0x1,%eax
+    1143:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+    1147:	89 c1                	mov    %eax,%ecx
+    1149:	75 f5                	jne    1140 <strlen+0x10>
+    ;
+  return n;
+}
+    114b:	89 c8                	mov    %ecx,%eax
+    114d:	5d                   	pop    %ebp
+    114e:	c3                   	ret
+    114f:	90                   	nop
+  for(n = 0; s[n]; n++)
+    1150:	31 c9                	xor    %ecx,%ecx
+}
+    1152:	5d                   	pop    %ebp
+    1153:	89 c8                	mov    %ecx,%eax
+    1155:	c3                   	ret
+    1156:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    115d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001160 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+    1160:	55                   	push   %ebp
+    1161:	89 e5                	mov    %esp,%ebp
+    1163:	57                   	push   %edi
+    1164:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+    1167:	8b 4d 10             	mov    0x10(%ebp),%ecx
+    116a:	8b 45 0c             	mov    0xc(%ebp),%eax
+    116d:	89 d7                	mov    %edx,%edi
+    116f:	fc                   	cld
+    1170:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+    1172:	8b 7d fc             	mov    -0x4(%ebp),%edi
+    1175:	89 d0                	mov    %edx,%eax
+    1177:	c9                   	leave
+    1178:	c3                   	ret
+    1179:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001180 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+    1180:	55                   	push   %ebp
+    1181:	89 e5                	mov    %esp,%ebp
+    1183:	8b 45 08             	mov    0x8(%ebp),%eax
+    1186:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+    118a:	0f b6 10             	movzbl (%eax),%edx
+    118d:	84 d2                	test   %dl,%dl
+    118f:	75 12                	jne    11a3 <strchr+0x23>
+    1191:	eb 1d                	jmp    11b0 <strchr+0x30>
+    1193:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1197:	90                   	nop
+    1198:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+    119c:	83 c0 01             	add    $0x1,%eax
+    119f:	84 d2                	test   %dl,%dl
+    11a1:	74 0d                	je     11b0 <strchr+0x30>
+    if(*s == c)
+    11a3:	38 d1                	cmp    %dl,%cl
+    11a5:	75 f1                	jne    1198 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+    11a7:	5d                   	pop    %ebp
+    11a8:	c3                   	ret
+    11a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+    11b0:	31 c0                	xor    %eax,%eax
+}
+    11b2:	5d                   	pop    %ebp
+    11b3:	c3                   	ret
+    11b4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    11bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    11bf:	90                   	nop
+
+000011c0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+    11c0:	55                   	push   %ebp
+    11c1:	89 e5                	mov    %esp,%ebp
+    11c3:	57                   	push   %edi
+    11c4:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+    11c5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+    11c8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+    11c9:	31 db                	xor    %ebx,%ebx
+{
+    11cb:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+    11ce:	eb 27                	jmp    11f7 <gets+0x37>
+    cc = read(0, &c, 1);
+    11d0:	83 ec 04             	sub    $0x4,%esp
+    11d3:	6a 01                	push   $0x1
+    11d5:	56                   	push   %esi
+    11d6:	6a 00                	push   $0x0
+    11d8:	e8 1e 01 00 00       	call   12fb <read>
+    if(cc < 1)
+    11dd:	83 c4 10             	add    $0x10,%esp
+    11e0:	85 c0                	test   %eax,%eax
+    11e2:	7e 1d                	jle    1201 <gets+0x41>
+      break;
+    buf[i++] = c;
+    11e4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+    11e8:	8b 55 08             	mov    0x8(%ebp),%edx
+    11eb:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+    11ef:	3c 0a                	cmp    $0xa,%al
+    11f1:	74 10                	je     1203 <gets+0x43>
+    11f3:	3c 0d                	cmp    $0xd,%al
+    11f5:	74 0c                	je     1203 <gets+0x43>
+  for(i=0; i+1 < max; ){
+    11f7:	89 df                	mov    %ebx,%edi
+    11f9:	83 c3 01             	add    $0x1,%ebx
+    11fc:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+    11ff:	7c cf                	jl     11d0 <gets+0x10>
+    1201:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+    1203:	8b 45 08             	mov    0x8(%ebp),%eax
+    1206:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+    120a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    120d:	5b                   	pop    %ebx
+    120e:	5e                   	pop    %esi
+    120f:	5f                   	pop    %edi
+    1210:	5d                   	pop    %ebp
+    1211:	c3                   	ret
+    1212:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1219:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001220 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+    1220:	55                   	push   %ebp
+    1221:	89 e5                	mov    %esp,%ebp
+    1223:	56                   	push   %esi
+    1224:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+    1225:	83 ec 08             	sub    $0x8,%esp
+    1228:	6a 00                	push   $0x0
+    122a:	ff 75 08             	push   0x8(%ebp)
+    122d:	e8 f1 00 00 00       	call   1323 <open>
+  if(fd < 0)
+    1232:	83 c4 10             	add    $0x10,%esp
+    1235:	85 c0                	test   %eax,%eax
+    1237:	78 27                	js     1260 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+    1239:	83 ec 08             	sub    $0x8,%esp
+    123c:	ff 75 0c             	push   0xc(%ebp)
+    123f:	89 c3                	mov    %eax,%ebx
+    1241:	50                   	push   %eax
+    1242:	e8 f4 00 00 00       	call   133b <fstat>
+  close(fd);
+    1247:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+    124a:	89 c6                	mov    %eax,%esi
+  close(fd);
+    124c:	e8 ba 00 00 00       	call   130b <close>
+  return r;
+    1251:	83 c4 10             	add    $0x10,%esp
+}
+    1254:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1257:	89 f0                	mov    %esi,%eax
+    1259:	5b                   	pop    %ebx
+    125a:	5e                   	pop    %esi
+    125b:	5d                   	pop    %ebp
+    125c:	c3                   	ret
+    125d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+    1260:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    1265:	eb ed                	jmp    1254 <stat+0x34>
+    1267:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    126e:	66 90                	xchg   %ax,%ax
+
+00001270 <atoi>:
+
+int
+atoi(const char *s)
+{
+    1270:	55                   	push   %ebp
+    1271:	89 e5                	mov    %esp,%ebp
+    1273:	53                   	push   %ebx
+    1274:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+    1277:	0f be 02             	movsbl (%edx),%eax
+    127a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+    127d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+    1280:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+    1285:	77 1e                	ja     12a5 <atoi+0x35>
+    1287:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    128e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+    1290:	83 c2 01             	add    $0x1,%edx
+    1293:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+    1296:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+    129a:	0f be 02             	movsbl (%edx),%eax
+    129d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+    12a0:	80 fb 09             	cmp    $0x9,%bl
+    12a3:	76 eb                	jbe    1290 <atoi+0x20>
+  return n;
+}
+    12a5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    12a8:	89 c8                	mov    %ecx,%eax
+    12aa:	c9                   	leave
+    12ab:	c3                   	ret
+    12ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000012b0 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+    12b0:	55                   	push   %ebp
+    12b1:	89 e5                	mov    %esp,%ebp
+    12b3:	57                   	push   %edi
+    12b4:	56                   	push   %esi
+    12b5:	8b 45 10             	mov    0x10(%ebp),%eax
+    12b8:	8b 55 08             	mov    0x8(%ebp),%edx
+    12bb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+    12be:	85 c0                	test   %eax,%eax
+    12c0:	7e 13                	jle    12d5 <memmove+0x25>
+    12c2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+    12c4:	89 d7                	mov    %edx,%edi
+    12c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    12cd:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+    12d0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+    12d1:	39 f8                	cmp    %edi,%eax
+    12d3:	75 fb                	jne    12d0 <memmove+0x20>
+  return vdst;
+}
+    12d5:	5e                   	pop    %esi
+    12d6:	89 d0                	mov    %edx,%eax
+    12d8:	5f                   	pop    %edi
+    12d9:	5d                   	pop    %ebp
+    12da:	c3                   	ret
+
+000012db <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+    12db:	b8 01 00 00 00       	mov    $0x1,%eax
+    12e0:	cd 40                	int    $0x40
+    12e2:	c3                   	ret
+
+000012e3 <exit>:
+SYSCALL(exit)
+    12e3:	b8 02 00 00 00       	mov    $0x2,%eax
+    12e8:	cd 40                	int    $0x40
+    12ea:	c3                   	ret
+
+000012eb <wait>:
+SYSCALL(wait)
+    12eb:	b8 03 00 00 00       	mov    $0x3,%eax
+    12f0:	cd 40                	int    $0x40
+    12f2:	c3                   	ret
+
+000012f3 <pipe>:
+SYSCALL(pipe)
+    12f3:	b8 04 00 00 00       	mov    $0x4,%eax
+    12f8:	cd 40                	int    $0x40
+    12fa:	c3                   	ret
+
+000012fb <read>:
+SYSCALL(read)
+    12fb:	b8 05 00 00 00       	mov    $0x5,%eax
+    1300:	cd 40                	int    $0x40
+    1302:	c3                   	ret
+
+00001303 <write>:
+SYSCALL(write)
+    1303:	b8 10 00 00 00       	mov    $0x10,%eax
+    1308:	cd 40                	int    $0x40
+    130a:	c3                   	ret
+
+0000130b <close>:
+SYSCALL(close)
+    130b:	b8 15 00 00 00       	mov    $0x15,%eax
+    1310:	cd 40                	int    $0x40
+    1312:	c3                   	ret
+
+00001313 <kill>:
+SYSCALL(kill)
+    1313:	b8 06 00 00 00       	mov    $0x6,%eax
+    1318:	cd 40                	int    $0x40
+    131a:	c3                   	ret
+
+0000131b <exec>:
+SYSCALL(exec)
+    131b:	b8 07 00 00 00       	mov    $0x7,%eax
+    1320:	cd 40                	int    $0x40
+    1322:	c3                   	ret
+
+00001323 <open>:
+SYSCALL(open)
+    1323:	b8 0f 00 00 00       	mov    $0xf,%eax
+    1328:	cd 40                	int    $0x40
+    132a:	c3                   	ret
+
+0000132b <mknod>:
+SYSCALL(mknod)
+    132b:	b8 11 00 00 00       	mov    $0x11,%eax
+    1330:	cd 40                	int    $0x40
+    1332:	c3                   	ret
+
+00001333 <unlink>:
+SYSCALL(unlink)
+    1333:	b8 12 00 00 00       	mov    $0x12,%eax
+    1338:	cd 40                	int    $0x40
+    133a:	c3                   	ret
+
+0000133b <fstat>:
+SYSCALL(fstat)
+    133b:	b8 08 00 00 00       	mov    $0x8,%eax
+    1340:	cd 40                	int    $0x40
+    1342:	c3                   	ret
+
+00001343 <link>:
+SYSCALL(link)
+    1343:	b8 13 00 00 00       	mov    $0x13,%eax
+    1348:	cd 40                	int    $0x40
+    134a:	c3                   	ret
+
+0000134b <mkdir>:
+SYSCALL(mkdir)
+    134b:	b8 14 00 00 00       	mov    $0x14,%eax
+    1350:	cd 40                	int    $0x40
+    1352:	c3                   	ret
+
+00001353 <chdir>:
+SYSCALL(chdir)
+    1353:	b8 09 00 00 00       	mov    $0x9,%eax
+    1358:	cd 40                	int    $0x40
+    135a:	c3                   	ret
+
+0000135b <dup>:
+SYSCALL(dup)
+    135b:	b8 0a 00 00 00       	mov    $0xa,%eax
+    1360:	cd 40                	int    $0x40
+    1362:	c3                   	ret
+
+00001363 <getpid>:
+SYSCALL(getpid)
+    1363:	b8 0b 00 00 00       	mov    $0xb,%eax
+    1368:	cd 40                	int    $0x40
+    136a:	c3                   	ret
+
+0000136b <sbrk>:
+SYSCALL(sbrk)
+    136b:	b8 0c 00 00 00       	mov    $0xc,%eax
+    1370:	cd 40                	int    $0x40
+    1372:	c3                   	ret
+
+00001373 <sleep>:
+SYSCALL(sleep)
+    1373:	b8 0d 00 00 00       	mov    $0xd,%eax
+    1378:	cd 40                	int    $0x40
+    137a:	c3                   	ret
+
+0000137b <uptime>:
+SYSCALL(uptime)
+    137b:	b8 0e 00 00 00       	mov    $0xe,%eax
+    1380:	cd 40                	int    $0x40
+    1382:	c3                   	ret
+
+00001383 <setTicket>:
+SYSCALL(setTicket)
+    1383:	b8 16 00 00 00       	mov    $0x16,%eax
+    1388:	cd 40                	int    $0x40
+    138a:	c3                   	ret
+
+0000138b <changeQueue>:
+SYSCALL(changeQueue)
+    138b:	b8 17 00 00 00       	mov    $0x17,%eax
+    1390:	cd 40                	int    $0x40
+    1392:	c3                   	ret
+
+00001393 <setLotteryTicket>:
+SYSCALL(setLotteryTicket)
+    1393:	b8 18 00 00 00       	mov    $0x18,%eax
+    1398:	cd 40                	int    $0x40
+    139a:	c3                   	ret
+
+0000139b <setSRPFPriority>:
+SYSCALL(setSRPFPriority)
+    139b:	b8 19 00 00 00       	mov    $0x19,%eax
+    13a0:	cd 40                	int    $0x40
+    13a2:	c3                   	ret
+
+000013a3 <printInfo>:
+SYSCALL(printInfo)
+    13a3:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    13a8:	cd 40                	int    $0x40
+    13aa:	c3                   	ret
+
+000013ab <configQueues>:
+SYSCALL(configQueues)
+    13ab:	b8 1b 00 00 00       	mov    $0x1b,%eax
+    13b0:	cd 40                	int    $0x40
+    13b2:	c3                   	ret
+
+000013b3 <setQuantum>:
+SYSCALL(setQuantum)
+    13b3:	b8 1c 00 00 00       	mov    $0x1c,%eax
+    13b8:	cd 40                	int    $0x40
+    13ba:	c3                   	ret
+
+000013bb <getSchedStat>:
+SYSCALL(getSchedStat)
+    13bb:	b8 1d 00 00 00       	mov    $0x1d,%eax
+    13c0:	cd 40                	int    $0x40
+    13c2:	c3                   	ret
+
+000013c3 <schedTrace>:
+SYSCALL(schedTrace)
+    13c3:	b8 1e 00 00 00       	mov    $0x1e,%eax
+    13c8:	cd 40                	int    $0x40
+    13ca:	c3                   	ret
+
+000013cb <schedSeed>:
+SYSCALL(schedSeed)
+    13cb:	b8 1f 00 00 00       	mov    $0x1f,%eax
+    13d0:	cd 40                	int    $0x40
+    13d2:	c3                   	ret
+
+000013d3 <setSchedAttr>:
+SYSCALL(setSchedAttr)
+    13d3:	b8 20 00 00 00       	mov    $0x20,%eax
+    13d8:	cd 40                	int    $0x40
+    13da:	c3                   	ret
+
+000013db <getSchedAttr>:
+SYSCALL(getSchedAttr)
+    13db:	b8 21 00 00 00       	mov    $0x21,%eax
+    13e0:	cd 40                	int    $0x40
+    13e2:	c3                   	ret
+
+000013e3 <setAffinity>:
+SYSCALL(setAffinity)
+    13e3:	b8 22 00 00 00       	mov    $0x22,%eax
+    13e8:	cd 40                	int    $0x40
+    13ea:	c3                   	ret
+
+000013eb <getAffinity>:
+SYSCALL(getAffinity)
+    13eb:	b8 23 00 00 00       	mov    $0x23,%eax
+    13f0:	cd 40                	int    $0x40
+    13f2:	c3                   	ret
+
+000013f3 <gangJoin>:
+SYSCALL(gangJoin)
+    13f3:	b8 24 00 00 00       	mov    $0x24,%eax
+    13f8:	cd 40                	int    $0x40
+    13fa:	c3                   	ret
+
+000013fb <setRealtime>:
+SYSCALL(setRealtime)
+    13fb:	b8 25 00 00 00       	mov    $0x25,%eax
+    1400:	cd 40                	int    $0x40
+    1402:	c3                   	ret
+    1403:	66 90                	xchg   %ax,%ax
+    1405:	66 90                	xchg   %ax,%ax
+    1407:	66 90                	xchg   %ax,%ax
+    1409:	66 90                	xchg   %ax,%ax
+    140b:	66 90                	xchg   %ax,%ax
+    140d:	66 90                	xchg   %ax,%ax
+    140f:	90                   	nop
+
+00001410 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+    1410:	55                   	push   %ebp
+    1411:	89 e5                	mov    %esp,%ebp
+    1413:	57                   	push   %edi
+    1414:	56                   	push   %esi
+    1415:	53                   	push   %ebx
+    1416:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+    1418:	89 d1                	mov    %edx,%ecx
+{
+    141a:	83 ec 3c             	sub    $0x3c,%esp
+    141d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+    1420:	85 d2                	test   %edx,%edx
+    1422:	0f 89 80 00 00 00    	jns    14a8 <printint+0x98>
+    1428:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+    142c:	74 7a                	je     14a8 <printint+0x98>
+    x = -xx;
+    142e:	f7 d9                	neg    %ecx
+    neg = 1;
+    1430:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+    1435:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+    1438:	31 f6                	xor    %esi,%esi
+    143a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+    1440:	89 c8                	mov    %ecx,%eax
+    1442:	31 d2                	xor    %edx,%edx
+    1444:	89 f7                	mov    %esi,%edi
+    1446:	f7 f3                	div    %ebx
+    1448:	8d 76 01             	lea    0x1(%esi),%esi
+    144b:	0f b6 92 3c 1a 00 00 	movzbl 0x1a3c(%edx),%edx
+    1452:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+    1456:	89 ca                	mov    %ecx,%edx
+    1458:	89 c1                	mov    %eax,%ecx
+    145a:	39 da                	cmp    %ebx,%edx
+    145c:	73 e2                	jae    1440 <printint+0x30>
+  if(neg)
+    145e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+    1461:	85 c0                	test   %eax,%eax
+    1463:	74 07                	je     146c <printint+0x5c>
+    buf[i++] = '-';
+    1465:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+    146a:	89 f7                	mov    %esi,%edi
+    146c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+    146f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+    1472:	01 df                	add    %ebx,%edi
+    1474:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+    1478:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+    147b:	83 ec 04             	sub    $0x4,%esp
+    147e:	88 45 d7             	mov    %al,-0x29(%ebp)
+    1481:	8d 45 d7             	lea    -0x29(%ebp),%eax
+    1484:	6a 01                	push   $0x1
+    1486:	50                   	push   %eax
+    1487:	56                   	push   %esi
+    1488:	e8 76 fe ff ff       	call   1303 <write>
+  while(--i >= 0)
+    148d:	89 f8                	mov    %edi,%eax
+    148f:	83 c4 10             	add    $0x10,%esp
+    1492:	83 ef 01             	sub    $0x1,%edi
+    1495:	39 d8                	cmp    %ebx,%eax
+    1497:	75 df                	jne    1478 <printint+0x68>
+}
+    1499:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    149c:	5b                   	pop    %ebx
+    149d:	5e                   	pop    %esi
+    149e:	5f                   	pop    %edi
+    149f:	5d                   	pop    %ebp
+    14a0:	c3                   	ret
+    14a1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+    14a8:	31 c0                	xor    %eax,%eax
+    14aa:	eb 89                	jmp    1435 <printint+0x25>
+    14ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000014b0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+    14b0:	55                   	push   %ebp
+    14b1:	89 e5                	mov    %esp,%ebp
+    14b3:	57                   	push   %edi
+    14b4:	56                   	push   %esi
+    14b5:	53                   	push   %ebx
+    14b6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+    14b9:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+    14bc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+    14bf:	0f b6 1e             	movzbl (%esi),%ebx
+    14c2:	83 c6 01             	add    $0x1,%esi
+    14c5:	84 db                	test   %bl,%bl
+    14c7:	74 67                	je     1530 <printf+0x80>
+    14c9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+    14cc:	31 d2                	xor    %edx,%edx
+    14ce:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+    14d1:	eb 34                	jmp    1507 <printf+0x57>
+    14d3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    14d7:	90                   	nop
+    14d8:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+    14db:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+    14e0:	83 f8 25             	cmp    $0x25,%eax
+    14e3:	74 18                	je     14fd <printf+0x4d>
+  write(fd, &c, 1);
+    14e5:	83 ec 04             	sub    $0x4,%esp
+    14e8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+    14eb:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    14ee:	6a 01                	push   $0x1
+    14f0:	50                   	push   %eax
+    14f1:	57                   	push   %edi
+    14f2:	e8 0c fe ff ff       	call   1303 <write>
+    14f7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+    14fa:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+    14fd:	0f b6 1e             	movzbl (%esi),%ebx
+    1500:	83 c6 01             	add    $0x1,%esi
+    1503:	84 db                	test   %bl,%bl
+    1505:	74 29                	je     1530 <printf+0x80>
+    c = fmt[i] & 0xff;
+    1507:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+    150a:	85 d2                	test   %edx,%edx
+    150c:	74 ca                	je     14d8 <printf+0x28>
+      }
+    } else if(state == '%'){
+    150e:	83 fa 25             	cmp    $0x25,%edx
+    1511:	75 ea                	jne    14fd <printf+0x4d>
+      if(c == 'd'){
+    1513:	83 f8 25             	cmp    $0x25,%eax
+    1516:	0f 84 24 01 00 00    	je     1640 <printf+0x190>
+    151c:	83 e8 63             	sub    $0x63,%eax
+    151f:	83 f8 15             	cmp    $0x15,%eax
+    1522:	77 1c                	ja     1540 <printf+0x90>
+    1524:	ff 24 85 e4 19 00 00 	jmp    *0x19e4(,%eax,4)
+    152b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    152f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+    1530:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1533:	5b                   	pop    %ebx
+    1534:	5e                   	pop    %esi
+    1535:	5f                   	pop    %edi
+    1536:	5d                   	pop    %ebp
+    1537:	c3                   	ret
+    1538:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    153f:	90                   	nop
+  write(fd, &c, 1);
+    1540:	83 ec 04             	sub    $0x4,%esp
+    1543:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    1546:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+    154a:	6a 01                	push   $0x1
+    154c:	52                   	push   %edx
+    154d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    1550:	57                   	push   %edi
+    1551:	e8 ad fd ff ff       	call   1303 <write>
+    1556:	83 c4 0c             	add    $0xc,%esp
+    1559:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    155c:	6a 01                	push   $0x1
+    155e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+    1561:	52                   	push   %edx
+    1562:	57                   	push   %edi
+    1563:	e8 9b fd ff ff       	call   1303 <write>
+        putc(fd, c);
+    1568:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    156b:	31 d2                	xor    %edx,%edx
+    156d:	eb 8e                	jmp    14fd <printf+0x4d>
+    156f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+    1570:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    1573:	83 ec 0c             	sub    $0xc,%esp
+    1576:	b9 10 00 00 00       	mov    $0x10,%ecx
+    157b:	8b 13                	mov    (%ebx),%edx
+    157d:	6a 00                	push   $0x0
+    157f:	89 f8                	mov    %edi,%eax
+        ap++;
+    1581:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+    1584:	e8 87 fe ff ff       	call   1410 <printint>
+        ap++;
+    1589:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    158c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    158f:	31 d2                	xor    %edx,%edx
+    1591:	e9 67 ff ff ff       	jmp    14fd <printf+0x4d>
+    1596:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    159d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+    15a0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+    15a3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+    15a5:	83 c0 04             	add    $0x4,%eax
+    15a8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+    15ab:	85 db                	test   %ebx,%ebx
+    15ad:	0f 84 9d 00 00 00    	je     1650 <printf+0x1a0>
+        while(*s != 0){
+    15b3:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+    15b6:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+    15b8:	84 c0                	test   %al,%al
+    15ba:	0f 84 3d ff ff ff    	je     14fd <printf+0x4d>
+    15c0:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    15c3:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+    15c6:	89 de                	mov    %ebx,%esi
+    15c8:	89 d3                	mov    %edx,%ebx
+    15ca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+    15d0:	83 ec 04             	sub    $0x4,%esp
+    15d3:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+    15d6:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+    15d9:	6a 01                	push   $0x1
+    15db:	53                   	push   %ebx
+    15dc:	57                   	push   %edi
+    15dd:	e8 21 fd ff ff       	call   1303 <write>
+        while(*s != 0){
+    15e2:	0f b6 06             	movzbl (%esi),%eax
+    15e5:	83 c4 10             	add    $0x10,%esp
+    15e8:	84 c0                	test   %al,%al
+    15ea:	75 e4                	jne    15d0 <printf+0x120>
+      state = 0;
+    15ec:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+    15ef:	31 d2                	xor    %edx,%edx
+    15f1:	e9 07 ff ff ff       	jmp    14fd <printf+0x4d>
+    15f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    15fd:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+    1600:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    1603:	83 ec 0c             	sub    $0xc,%esp
+    1606:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    160b:	8b 13                	mov    (%ebx),%edx
+    160d:	6a 01                	push   $0x1
+    160f:	e9 6b ff ff ff       	jmp    157f <printf+0xcf>
+    1614:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+    1618:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+    161b:	83 ec 04             	sub    $0x4,%esp
+    161e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+    1621:	8b 03                	mov    (%ebx),%eax
+        ap++;
+    1623:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+    1626:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+    1629:	6a 01                	push   $0x1
+    162b:	52                   	push   %edx
+    162c:	57                   	push   %edi
+    162d:	e8 d1 fc ff ff       	call   1303 <write>
+        ap++;
+    1632:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    1635:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    1638:	31 d2                	xor    %edx,%edx
+    163a:	e9 be fe ff ff       	jmp    14fd <printf+0x4d>
+    163f:	90                   	nop
+  write(fd, &c, 1);
+    1640:	83 ec 04             	sub    $0x4,%esp
+    1643:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    1646:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    1649:	6a 01                	push   $0x1
+    164b:	e9 11 ff ff ff       	jmp    1561 <printf+0xb1>
+    1650:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+    1655:	bb da 19 00 00       	mov    $0x19da,%ebx
+    165a:	e9 61 ff ff ff       	jmp    15c0 <printf+0x110>
+    165f:	90                   	nop
+
+00001660 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+    1660:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    1661:	a1 00 6d 00 00       	mov    0x6d00,%eax
+{
+    1666:	89 e5                	mov    %esp,%ebp
+    1668:	57                   	push   %edi
+    1669:	56                   	push   %esi
+    166a:	53                   	push   %ebx
+    166b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+    166e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    1671:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1678:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    167a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    167c:	39 ca                	cmp    %ecx,%edx
+    167e:	73 30                	jae    16b0 <free+0x50>
+    1680:	39 c1                	cmp    %eax,%ecx
+    1682:	72 04                	jb     1688 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    1684:	39 c2                	cmp    %eax,%edx
+    1686:	72 f0                	jb     1678 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    1688:	8b 73 fc             	mov    -0x4(%ebx),%esi
+    168b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+    168e:	39 f8                	cmp    %edi,%eax
+    1690:	74 2e                	je     16c0 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+    1692:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+    1695:	8b 42 04             	mov    0x4(%edx),%eax
+    1698:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    169b:	39 f1                	cmp    %esi,%ecx
+    169d:	74 38                	je     16d7 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+    169f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+    16a1:	5b                   	pop    %ebx
+  freep = p;
+    16a2:	89 15 00 6d 00 00    	mov    %edx,0x6d00
+}
+    16a8:	5e                   	pop    %esi
+    16a9:	5f                   	pop    %edi
+    16aa:	5d                   	pop    %ebp
+    16ab:	c3                   	ret
+    16ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    16b0:	39 c1                	cmp    %eax,%ecx
+    16b2:	72 d0                	jb     1684 <free+0x24>
+    16b4:	eb c2                	jmp    1678 <free+0x18>
+    16b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    16bd:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+    16c0:	03 70 04             	add    0x4(%eax),%esi
+    16c3:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    16c6:	8b 02                	mov    (%edx),%eax
+    16c8:	8b 00                	mov    (%eax),%eax
+    16ca:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+    16cd:	8b 42 04             	mov    0x4(%edx),%eax
+    16d0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    16d3:	39 f1                	cmp    %esi,%ecx
+    16d5:	75 c8                	jne    169f <free+0x3f>
+    p->s.size += bp->s.size;
+    16d7:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+    16da:	89 15 00 6d 00 00    	mov    %edx,0x6d00
+    p->s.size += bp->s.size;
+    16e0:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+    16e3:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+    16e6:	89 0a                	mov    %ecx,(%edx)
+}
+    16e8:	5b                   	pop    %ebx
+    16e9:	5e                   	pop    %esi
+    16ea:	5f                   	pop    %edi
+    16eb:	5d                   	pop    %ebp
+    16ec:	c3                   	ret
+    16ed:	8d 76 00             	lea    0x0(%esi),%esi
+
+000016f0 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+    16f0:	55                   	push   %ebp
+    16f1:	89 e5                	mov    %esp,%ebp
+    16f3:	57                   	push   %edi
+    16f4:	56                   	push   %esi
+    16f5:	53                   	push   %ebx
+    16f6:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    16f9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+    16fc:	8b 15 00 6d 00 00    	mov    0x6d00,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    1702:	8d 78 07             	lea    0x7(%eax),%edi
+    1705:	c1 ef 03             	shr    $0x3,%edi
+    1708:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+    170b:	85 d2                	test   %edx,%edx
+    170d:	0f 84 8d 00 00 00    	je     17a0 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    1713:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    1715:	8b 48 04             	mov    0x4(%eax),%ecx
+    1718:	39 f9                	cmp    %edi,%ecx
+    171a:	73 64                	jae    1780 <malloc+0x90>
+  if(nu < 4096)
+    171c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    1721:	39 df                	cmp    %ebx,%edi
+    1723:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+    1726:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+    172d:	eb 0a                	jmp    1739 <malloc+0x49>
+    172f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    1730:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    1732:	8b 48 04             	mov    0x4(%eax),%ecx
+    1735:	39 f9                	cmp    %edi,%ecx
+    1737:	73 47                	jae    1780 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+    1739:	89 c2                	mov    %eax,%edx
+    173b:	39 05 00 6d 00 00    	cmp    %eax,0x6d00
+    1741:	75 ed                	jne    1730 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+    1743:	83 ec 0c             	sub    $0xc,%esp
+    1746:	56                   	push   %esi
+    1747:	e8 1f fc ff ff       	call   136b <sbrk>
+  if(p == (char*)-1)
+    174c:	83 c4 10             	add    $0x10,%esp
+    174f:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1752:	74 1c                	je     1770 <malloc+0x80>
+  hp->s.size = nu;
+    1754:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+    1757:	83 ec 0c             	sub    $0xc,%esp
+    175a:	83 c0 08             	add    $0x8,%eax
+    175d:	50                   	push   %eax
+    175e:	e8 fd fe ff ff       	call   1660 <free>
+  return freep;
+    1763:	8b 15 00 6d 00 00    	mov    0x6d00,%edx
+      if((p = morecore(nunits)) == 0)
+    1769:	83 c4 10             	add    $0x10,%esp
+    176c:	85 d2                	test   %edx,%edx
+    176e:	75 c0                	jne    1730 <malloc+0x40>
+        return 0;
+  }
+}
+    1770:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+    1773:	31 c0                	xor    %eax,%eax
+}
+    1775:	5b                   	pop    %ebx
+    1776:	5e                   	pop    %esi
+    1777:	5f                   	pop    %edi
+    1778:	5d                   	pop    %ebp
+    1779:	c3                   	ret
+    177a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+    1780:	39 cf                	cmp    %ecx,%edi
+    1782:	74 4c                	je     17d0 <malloc+0xe0>
+        p->s.size -= nunits;
+    1784:	29 f9                	sub    %edi,%ecx
+    1786:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+    1789:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+    178c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+    178f:	89 15 00 6d 00 00    	mov    %edx,0x6d00
+}
+    1795:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+    1798:	83 c0 08             	add    $0x8,%eax
+}
+    179b:	5b                   	pop    %ebx
+    179c:	5e                   	pop    %esi
+    179d:	5f                   	pop    %edi
+    179e:	5d                   	pop    %ebp
+    179f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+    17a0:	c7 05 00 6d 00 00 04 	movl   $0x6d04,0x6d00
+    17a7:	6d 00 00 
+    base.s.size = 0;
+    17aa:	b8 04 6d 00 00       	mov    $0x6d04,%eax
+    base.s.ptr = freep = prevp = &base;
+    17af:	c7 05 04 6d 00 00 04 	movl   $0x6d04,0x6d04
+    17b6:	6d 00 00 
+    base.s.size = 0;
+    17b9:	c7 05 08 6d 00 00 00 	movl   $0x0,0x6d08
+    17c0:	00 00 00 
+    if(p->s.size >= nunits){
+    17c3:	e9 54 ff ff ff       	jmp    171c <malloc+0x2c>
+    17c8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    17cf:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+    17d0:	8b 08                	mov    (%eax),%ecx
+    17d2:	89 0a                	mov    %ecx,(%edx)
+    17d4:	eb b9                	jmp    178f <malloc+0x9f>
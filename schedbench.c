@@ -0,0 +1,513 @@
+// Scheduler benchmark.
+// usage: schedbench [ticks [specfile|- [seed]]]
+//
+// Each line of a spec file describes a class of jobs:
+//   kind count queue tickets priority burst io rounds
+// kind is cpu, pipe, file or mix. count jobs of the class run at
+// once, and each one that finishes is replaced by a new one until
+// ticks have passed. A job runs rounds rounds of a CPU burst of
+// burst ticks followed, except for cpu, by an I/O wait: a pipe
+// round trip to a helper that answers after io ticks, or io
+// blocks written to a file; mix alternates the two. Each job is
+// put on queue with tickets lottery tickets and SRPF priority
+// priority (e.g. 2.5), where its class takes them.
+// Lines starting with # are ignored.
+//
+// For each class it reports finished jobs, their turnaround
+// (fork to exit) and response time (fork to first run), in ticks.
+// A seed reseeds the scheduler's random draws first, so that
+// lottery and tie-break decisions repeat from run to run;
+// - stands for the built-in spec.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "fcntl.h"
+#include "param.h"
+#include "sched.h"
+
+#define NCLASS   8
+#define MAXLIVE  24   // jobs running at once, leaving room for helpers
+#define NSAMPLE  256  // jobs per class kept for the p99
+
+#define K_CPU   0
+#define K_PIPE  1
+#define K_FILE  2
+#define K_MIX   3
+
+char *kinds[] = { "cpu", "pipe", "file", "mix" };
+
+struct spec {
+  int kind;
+  int count;
+  int queue;
+  int tickets;
+  int priority;                // In thousandths
+  int burst;
+  int io;
+  int rounds;
+  int line;                    // In the spec, for errors
+
+  int done;                    // Finished jobs
+  uint turnsum, respsum;
+  uint turn[NSAMPLE], resp[NSAMPLE];
+};
+
+struct spec specs[NCLASS];
+int nspec;
+
+// What a job sends back through the result pipe.
+struct result {
+  int cls;                     // Class, or -1 from the timer
+  int pid;                     // Job that finished
+  uint arrival;                // Forked
+  uint first;                  // First ran
+  uint end;                    // Done
+};
+
+struct live {
+  int pid;
+  int cls;
+  int reaped;                  // wait() has returned pid already
+} live[MAXLIVE];
+int nlive;
+
+char *defspec =
+  "# kind count queue tickets priority burst io rounds\n"
+  "cpu  2 1 10 1 20 0 5\n"
+  "pipe 2 1 10 1 1  2 20\n"
+  "file 2 1 10 1 1  4 10\n"
+  "mix  2 1 10 1 5  2 10\n";
+
+uint loopspertick;
+struct schedattr self;         // Our own attributes, restored after each fork
+int maxqueue;                  // Highest queue the kernel accepts
+
+// Burn n ticks' worth of CPU, as calibrated at startup.
+void
+spin(int n)
+{
+  volatile uint i;
+  uint total = n * loopspertick;
+
+  for(i = 0; i < total; i++)
+    ;
+}
+
+void
+calibrate(void)
+{
+  volatile uint i;
+  uint t0, n;
+
+  t0 = uptime();
+  while(uptime() == t0)
+    ;
+  t0 = uptime();
+  n = 0;
+  while(uptime() < t0 + 10){
+    for(i = 0; i < 1000; i++)
+      ;
+    n += 1000;
+  }
+  loopspertick = n / 10;
+}
+
+// "sb" followed by pid, for a job's scratch file.
+void
+filename(char *name, int pid)
+{
+  char digits[12];
+  int n;
+
+  n = 0;
+  do {
+    digits[n++] = '0' + pid % 10;
+    pid /= 10;
+  } while(pid > 0);
+  *name++ = 's';
+  *name++ = 'b';
+  while(n > 0)
+    *name++ = digits[--n];
+  *name = 0;
+}
+
+// Helper at the other end of a pipe job: answer each byte
+// io ticks later, until the job closes its end.
+void
+echo(int in, int out, int io)
+{
+  char c;
+
+  while(read(in, &c, 1) == 1){
+    sleep(io);
+    write(out, &c, 1);
+  }
+  exit();
+}
+
+void
+job(int cls, uint arrival, int resfd)
+{
+  struct spec *s = &specs[cls];
+  struct result r;
+  char name[16], buf[512], c;
+  int to[2], from[2], helper, fd, i, k;
+
+  r.cls = cls;
+  r.pid = getpid();
+  r.arrival = arrival;
+  r.first = uptime();
+
+  helper = -1;
+  if(s->kind == K_PIPE || s->kind == K_MIX){
+    if(pipe(to) < 0 || pipe(from) < 0)
+      exit();
+    if((helper = fork()) == 0){
+      close(to[1]);
+      close(from[0]);
+      echo(to[0], from[1], s->io);
+    }
+    close(to[0]);
+    close(from[1]);
+  }
+  filename(name, getpid());
+  memset(buf, 'x', sizeof(buf));
+
+  for(i = 0; i < s->rounds; i++){
+    spin(s->burst);
+    if(s->kind == K_PIPE || (s->kind == K_MIX && i % 2 == 0)){
+      write(to[1], "x", 1);
+      read(from[0], &c, 1);
+    } else if(s->kind == K_FILE || s->kind == K_MIX){
+      if((fd = open(name, O_CREATE | O_WRONLY)) < 0)
+        exit();
+      for(k = 0; k < s->io; k++)
+        write(fd, buf, sizeof(buf));
+      close(fd);
+    }
+  }
+
+  if(helper > 0){
+    close(to[1]);
+    close(from[0]);
+    wait();
+  }
+  if(s->kind == K_FILE || s->kind == K_MIX)
+    unlink(name);
+  r.end = uptime();
+  write(resfd, &r, sizeof(r));
+  exit();
+}
+
+// Fork a job of class cls into live slot l. The job inherits
+// its class's attributes from fork(), so that it runs with
+// them from its first dispatch. Returns -1 if the kernel
+// refuses the attributes or the fork fails.
+int
+launch(int l, int cls, int resfd)
+{
+  struct spec *s = &specs[cls];
+  struct schedattr a;
+  uint arrival;
+  int pid, me;
+
+  a.mask = SA_QUEUE | SA_TICKETS | SA_PRIORITY | SA_QUANTUM | SA_FLAGS;
+  a.queue = s->queue;
+  a.tickets = s->tickets;
+  a.priority = s->priority;
+  a.quantum = 0;
+  a.flags = SAF_INHERIT;
+  me = 0;
+  if(setSchedAttr(&me, 1, &a) < 0){
+    printf(2, "schedbench: spec line %d: cannot set queue %d, %d tickets\n",
+           s->line, s->queue, s->tickets);
+    return -1;
+  }
+  arrival = uptime();
+  if((pid = fork()) == 0)
+    job(cls, arrival, resfd);
+  if(pid < 0){
+    printf(2, "schedbench: fork failed\n");
+    return -1;
+  }
+  live[l].pid = pid;
+  live[l].cls = cls;
+  live[l].reaped = 0;
+  if(setSchedAttr(&me, 1, &self) < 0){
+    printf(2, "schedbench: cannot restore own attributes\n");
+    return -1;
+  }
+  return 0;
+}
+
+// The live slot of pid, or -1.
+int
+slot(int pid)
+{
+  int l;
+
+  for(l = 0; l < nlive; l++)
+    if(live[l].pid == pid)
+      return l;
+  return -1;
+}
+
+//PAGEBREAK: 30
+// Spec parsing.
+
+// Parse a decimal such as 2.5 into thousandths.
+int
+thousandths(char *s)
+{
+  int n, scale;
+
+  n = atoi(s) * 1000;
+  if((s = strchr(s, '.')) == 0)
+    return n;
+  for(s++, scale = 100; *s >= '0' && *s <= '9' && scale > 0; s++, scale /= 10)
+    n += (*s - '0') * scale;
+  return n;
+}
+
+char*
+word(char **sp)
+{
+  char *s = *sp, *w;
+
+  while(*s == ' ' || *s == '\t')
+    s++;
+  w = s;
+  while(*s && *s != ' ' && *s != '\t')
+    s++;
+  if(*s)
+    *s++ = 0;
+  *sp = s;
+  return *w ? w : 0;
+}
+
+// Parse spec line n. Queues and tickets must be ones the
+// kernel accepts: 0..maxqueue and 1..MAXTICKET.
+int
+parseline(char *line, int n)
+{
+  struct spec *s;
+  char *w[8];
+  int i;
+
+  for(i = 0; i < 8; i++)
+    if((w[i] = word(&line)) == 0)
+      break;
+  if(i == 0 || w[0][0] == '#')
+    return 0;
+  if(i < 8 || nspec == NCLASS)
+    return -1;
+  s = &specs[nspec];
+  for(s->kind = 0; s->kind < 4; s->kind++)
+    if(strcmp(w[0], kinds[s->kind]) == 0)
+      break;
+  if(s->kind == 4)
+    return -1;
+  s->count = atoi(w[1]);
+  s->queue = atoi(w[2]);
+  s->tickets = atoi(w[3]);
+  s->priority = thousandths(w[4]);
+  s->burst = atoi(w[5]);
+  s->io = atoi(w[6]);
+  s->rounds = atoi(w[7]);
+  s->line = n;
+  if(s->count < 1 || s->rounds < 1 || s->tickets < 1 ||
+     s->tickets > MAXTICKET || s->queue < 0 || s->queue > maxqueue)
+    return -1;
+  nspec++;
+  return 0;
+}
+
+int
+parsespec(char *text)
+{
+  char *line, *nl;
+  int n;
+
+  for(n = 1, line = text; *line; n++, line = nl){
+    if((nl = strchr(line, '\n')) != 0)
+      *nl++ = 0;
+    else
+      nl = line + strlen(line);
+    if(parseline(line, n) < 0){
+      printf(2, "schedbench: bad spec line %d\n", n);
+      return -1;
+    }
+  }
+  return 0;
+}
+
+char*
+readspec(char *file)
+{
+  static char text[2048];
+  int fd, n;
+
+  if((fd = open(file, O_RDONLY)) < 0)
+    return 0;
+  n = read(fd, text, sizeof(text) - 1);
+  close(fd);
+  if(n < 0)
+    return 0;
+  text[n] = 0;
+  return text;
+}
+
+//PAGEBREAK: 30
+// Results.
+
+void
+record(struct result *r)
+{
+  struct spec *s = &specs[r->cls];
+  uint turn, resp;
+
+  turn = r->end - r->arrival;
+  resp = r->first - r->arrival;
+  s->turnsum += turn;
+  s->respsum += resp;
+  if(s->done < NSAMPLE){
+    s->turn[s->done] = turn;
+    s->resp[s->done] = resp;
+  }
+  s->done++;
+}
+
+// 99th percentile of the first n samples of v; sorts v.
+uint
+p99(uint *v, int n)
+{
+  int i, j;
+  uint x;
+
+  if(n > NSAMPLE)
+    n = NSAMPLE;
+  for(i = 1; i < n; i++){
+    x = v[i];
+    for(j = i; j > 0 && v[j-1] > x; j--)
+      v[j] = v[j-1];
+    v[j] = x;
+  }
+  return v[n * 99 / 100];
+}
+
+// Print a/b with one decimal.
+void
+printavg(uint a, uint b)
+{
+  printf(1, "%d.%d", a / b, a * 10 / b % 10);
+}
+
+void
+report(uint elapsed)
+{
+  struct spec *s;
+  int i;
+
+  printf(1, "%d ticks\n", elapsed);
+  printf(1, "class kind  jobs  jobs/1000t  turnaround mean/p99  response mean/p99\n");
+  for(i = 0; i < nspec; i++){
+    s = &specs[i];
+    printf(1, "%d     %s  %d  ", i, kinds[s->kind], s->done);
+    printavg(s->done * 1000, elapsed);
+    if(s->done == 0){
+      printf(1, "  -  -\n");
+      continue;
+    }
+    printf(1, "  ");
+    printavg(s->turnsum, s->done);
+    printf(1, "/%d  ", p99(s->turn, s->done));
+    printavg(s->respsum, s->done);
+    printf(1, "/%d\n", p99(s->resp, s->done));
+  }
+}
+
+int
+main(int argc, char *argv[])
+{
+  static struct schedstat st;
+  struct result r;
+  char *text, name[16];
+  int res[2], ticks, timer, pid, i, j, l, failed;
+  uint start, elapsed;
+
+  ticks = argc > 1 ? atoi(argv[1]) : 1000;
+  text = defspec;
+  if(argc > 2 && strcmp(argv[2], "-") != 0 && (text = readspec(argv[2])) == 0){
+    printf(2, "schedbench: cannot read %s\n", argv[2]);
+    exit();
+  }
+  if(getSchedStat(&st) < 0)
+    exit();
+  maxqueue = st.nqueue;
+  if(ticks < 1 || parsespec(text) < 0 || nspec == 0)
+    exit();
+  for(i = 0; i < nspec; i++)
+    nlive += specs[i].count;
+  if(nlive > MAXLIVE){
+    printf(2, "schedbench: at most %d jobs at once\n", MAXLIVE);
+    exit();
+  }
+
+  calibrate();
+  if(getSchedAttr(0, &self) < 0)
+    exit();
+  if(argc > 3)
+    schedSeed(atoi(argv[3]));
+  if(pipe(res) < 0)
+    exit();
+
+  start = uptime();
+  if((timer = fork()) == 0){
+    close(res[0]);
+    sleep(ticks);
+    r.cls = -1;
+    write(res[1], &r, sizeof(r));
+    exit();
+  }
+  if(timer < 0){
+    printf(2, "schedbench: fork failed\n");
+    exit();
+  }
+  failed = 0;
+  l = 0;
+  for(i = 0; i < nspec && !failed; i++)
+    for(j = 0; j < specs[i].count && !failed; j++)
+      failed = launch(l++, i, res[1]) < 0;
+
+  // Each finished job sends its result and exits;
+  // reap it and replace it with another of the same class.
+  // Other jobs reaped on the way are marked, to be replaced
+  // once their results arrive.
+  while(!failed && read(res[0], &r, sizeof(r)) == sizeof(r) && r.cls >= 0){
+    record(&r);
+    if((l = slot(r.pid)) < 0)
+      continue;
+    while(!live[l].reaped && (pid = wait()) > 0)
+      if((j = slot(pid)) >= 0)
+        live[j].reaped = 1;
+    failed = launch(l, live[l].cls, res[1]) < 0;
+  }
+  elapsed = uptime() - start;
+
+  if(failed)
+    kill(timer);
+  for(l = 0; l < nlive; l++)
+    if(live[l].pid > 0 && !live[l].reaped)
+      kill(live[l].pid);
+  while((pid = wait()) > 0){
+    for(l = 0; l < nlive; l++)
+      if(live[l].pid == pid && specs[live[l].cls].kind >= K_FILE){
+        filename(name, pid);
+        unlink(name);
+      }
+  }
+  if(!failed)
+    report(elapsed);
+  exit();
+}
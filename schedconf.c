@@ -0,0 +1,40 @@
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "param.h"
+#include "sched.h"
+
+char *classnames[NSCHEDCLASS] = {
+[SCHED_RR]      "rr",
+[SCHED_LOTTERY] "lottery",
+[SCHED_HRRN]    "hrrn",
+[SCHED_SRPF]    "srpf",
+[SCHED_STRIDE]  "stride",
+};
+
+int
+main(int argc, char *argv[])
+{
+  int classes[MAXARG];
+  int i, j;
+
+  if(argc < 2){
+    printf(1, "usage: schedconf class...  (classes: rr lottery hrrn srpf stride)\n");
+    exit();
+  }
+
+  for(i = 1; i < argc; i++){
+    for(j = 0; j < NSCHEDCLASS; j++)
+      if(strcmp(argv[i], classnames[j]) == 0)
+        break;
+    if(j == NSCHEDCLASS){
+      printf(1, "schedconf: unknown class %s\n", argv[i]);
+      exit();
+    }
+    classes[i-1] = j;
+  }
+
+  if(configQueues(argc - 1, classes) < 0)
+    printf(1, "schedconf: cannot configure %d queues\n", argc - 1);
+  exit();
+}
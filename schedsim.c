@@ -0,0 +1,559 @@
+// Host-side scheduler simulator.
+// Links the kernel's sched.c unchanged and replays a workload
+// through its run queues one timer tick at a time, then reports
+// throughput, turnaround and response time in ticks and the cost
+// of each class's pick_next in nanoseconds.
+//
+// usage: schedsim [-c cpus] [-m class,...] [-q quantum,...]
+//                 [-n jobs] [-a ticks] [-s seed] [-v] [workload]
+//
+// A workload file has one job per line:
+//   arrival queue tickets priority cpu [io cpu]...
+// with times in ticks and priority as for setSRPF (e.g. 2.5).
+// Without a file, -n jobs are generated from -s seed, half
+// CPU-bound and half I/O-bound, -a ticks apart on average.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "types.h"
+#include "param.h"
+#include "mmu.h"
+#include "proc.h"
+
+#define MAXJOB   10000
+#define MAXBURST 64
+#define MAXTICK  10000000
+
+struct job {
+  uint arrival;
+  int queue;
+  int tickets;
+  int priority;                // Fixed point
+  int burst[MAXBURST];         // CPU, I/O, CPU, ... ticks
+  int nburst;
+  int cur;                     // Burst in progress
+  int left;                    // Ticks left in it
+  uint wake;                   // When the current I/O ends
+  int started;
+  uint firstrun;
+  uint finish;
+  struct proc *p;              // While alive
+};
+
+struct job jobs[MAXJOB];
+int njob;
+int ndone;
+
+struct proc proc[NPROC];
+struct job *slotjob[NPROC];
+struct runq rq[NCPU];
+struct proc *running[NCPU];
+int ncpus = 1;
+
+uint ticks;
+uint64 timerns;                // Cost of one cyclecount() pair
+
+// sched.c; defs.h clashes with the C library.
+void            runqseed(struct runq*, int, uint);
+void            runqinsert(struct runq*, struct proc*);
+void            runqremove(struct runq*, struct proc*);
+struct proc*    runqpick(struct runq*);
+struct proc*    runqsteal(struct runq*, int);
+void            runqdispatch(struct runq*, struct proc*);
+int             runqtick(struct runq*, struct proc*);
+void            runqblocked(struct runq*, struct proc*);
+void            runqclock(struct runq*, uint);
+int             runqpreempts(struct proc*, struct proc*);
+
+// Hooks sched.c expects from the kernel.
+
+int
+procslot(struct proc *p)
+{
+  return p - proc;
+}
+
+struct proc*
+slotproc(int i)
+{
+  return &proc[i];
+}
+
+// Decision cost is measured in nanoseconds here.
+uint64
+cyclecount(void)
+{
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+void
+traceevent(int type, struct proc *p, int arg, int reason)
+{
+}
+
+// Workload generator, independent of the run queues' generators.
+uint64 wlstate = 1;
+
+uint
+wlrand(void)
+{
+  wlstate ^= wlstate << 13;
+  wlstate ^= wlstate >> 7;
+  wlstate ^= wlstate << 17;
+  return wlstate >> 32;
+}
+
+int
+between(int lo, int hi)
+{
+  return lo + wlrand() % (hi - lo + 1);
+}
+
+void
+genjobs(int n, int gap)
+{
+  struct job *j;
+  uint t = 0;
+  int k, cycles;
+
+  for(j = jobs; j < &jobs[n]; j++){
+    t += between(0, 2*gap);
+    j->arrival = t;
+    j->queue = between(1, nqueue);
+    j->tickets = between(1, 20);
+    j->priority = between(1, 10) * FIXSCALE;
+    if(wlrand() % 2){
+      // CPU-bound: one long burst.
+      j->burst[0] = between(20, 200);
+      j->nburst = 1;
+    } else {
+      // I/O-bound: short bursts between waits.
+      cycles = between(5, 20);
+      for(k = 0; k < cycles; k++){
+        j->burst[j->nburst++] = between(1, 3);
+        j->burst[j->nburst++] = between(2, 10);
+      }
+      j->burst[j->nburst++] = between(1, 3);
+    }
+  }
+  njob = n;
+}
+
+int
+readjobs(char *file)
+{
+  FILE *f;
+  char line[1024], *tok;
+  struct job *j;
+  int n;
+
+  if((f = fopen(file, "r")) == 0){
+    perror(file);
+    return -1;
+  }
+  while(fgets(line, sizeof(line), f) && njob < MAXJOB){
+    if((tok = strtok(line, " \t\n")) == 0 || tok[0] == '#')
+      continue;
+    j = &jobs[njob];
+    j->arrival = atoi(tok);
+    for(n = 0; n < 3 && (tok = strtok(0, " \t\n")) != 0; n++){
+      if(n == 0)
+        j->queue = atoi(tok);
+      else if(n == 1)
+        j->tickets = atoi(tok);
+      else
+        j->priority = atof(tok) * FIXSCALE;
+    }
+    while((tok = strtok(0, " \t\n")) != 0 && j->nburst < MAXBURST)
+      j->burst[j->nburst++] = atoi(tok);
+    if(n < 3 || j->nburst % 2 == 0){
+      fprintf(stderr, "schedsim: %s: bad job on line %d\n", file, njob + 1);
+      fclose(f);
+      return -1;
+    }
+    njob++;
+  }
+  fclose(f);
+  return 0;
+}
+
+// Set a comma-separated list of numbers into v; returns the count.
+int
+numlist(char *s, int *v, int max)
+{
+  int n;
+
+  for(n = 0; n < max && s && *s; n++){
+    v[n] = atoi(s);
+    if((s = strchr(s, ',')) != 0)
+      s++;
+  }
+  return n;
+}
+
+int
+setclasses(char *s)
+{
+  char *name;
+  int i, n;
+
+  n = 0;
+  for(name = strtok(s, ","); name; name = strtok(0, ",")){
+    if(n + 1 >= NQUEUE)
+      return -1;
+    for(i = 0; i < NSCHEDCLASS; i++)
+      if(strcmp(name, schedclasses[i]->name) == 0)
+        break;
+    if(i == NSCHEDCLASS)
+      return -1;
+    queueclass[++n] = schedclasses[i];
+  }
+  if(n == 0)
+    return -1;
+  nqueue = n;
+  return 0;
+}
+
+//PAGEBREAK: 30
+// The simulated kernel.
+
+int
+leastloaded(void)
+{
+  int i, best;
+
+  best = 0;
+  for(i = 1; i < ncpus; i++)
+    if(rq[i].nready + (running[i] != 0) < rq[best].nready + (running[best] != 0))
+      best = i;
+  return best;
+}
+
+void
+makeready(struct proc *p)
+{
+  p->state = RUNNABLE;
+  p->mlfq.readyTick = ticks;
+  runqinsert(&rq[p->rqcpu], p);
+}
+
+// End an I/O wait, taking the CPU from a process on a lower
+// queue as the kernel's wakeup does.
+void
+wake(struct proc *p)
+{
+  struct proc *cur = running[p->rqcpu];
+
+  makeready(p);
+  if(cur && runqpreempts(p, cur)){
+    running[p->rqcpu] = 0;
+    makeready(cur);
+  }
+}
+
+// Start job j, as fork() would; 0 if the process table is full.
+int
+spawn(struct job *j)
+{
+  struct proc *p;
+
+  for(p = proc; p < &proc[NPROC]; p++)
+    if(p->state == UNUSED)
+      break;
+  if(p == &proc[NPROC])
+    return 0;
+  memset(p, 0, sizeof(*p));
+  p->pid = j - jobs + 1;
+  p->mlfq.arrivalTime = ticks;
+  p->mlfq.queueNumber = j->queue;
+  p->mlfq.executedCycleNumber = 1;
+  p->mlfq.remainedPriority = j->priority;
+  p->mlfq.lotteryTicket = j->tickets;
+  p->heapidx = -1;
+  p->affinity = ~0;
+  p->rqcpu = leastloaded();
+  slotjob[procslot(p)] = j;
+  j->p = p;
+  j->left = j->burst[0];
+  makeready(p);
+  return 1;
+}
+
+// Busiest run queue other than CPU self's, as in proc.c.
+struct runq*
+busiest(int self)
+{
+  struct runq *r = 0;
+  int i;
+
+  for(i = 0; i < ncpus; i++){
+    if(i == self || rq[i].nready == 0)
+      continue;
+    if(r == 0 || rq[i].nready - rq[i].nbound > r->nready - r->nbound ||
+       (rq[i].nready - rq[i].nbound == r->nready - r->nbound &&
+        rq[i].nready > r->nready))
+      r = &rq[i];
+  }
+  return r;
+}
+
+void
+dispatch(int c)
+{
+  struct runq *victim;
+  struct proc *p;
+  struct job *j;
+
+  if((p = runqpick(&rq[c])) == 0 && (victim = busiest(c)) != 0)
+    p = runqsteal(victim, c);
+  if(p == 0)
+    return;
+  runqremove(&rq[p->rqcpu], p);
+  p->rqcpu = c;
+  runqdispatch(&rq[c], p);
+  p->state = RUNNING;
+  running[c] = p;
+  j = slotjob[procslot(p)];
+  if(!j->started){
+    j->started = 1;
+    j->firstrun = ticks;
+  }
+}
+
+// Run CPU c's process for one tick.
+void
+runtick(int c)
+{
+  struct proc *p = running[c];
+  struct job *j = slotjob[procslot(p)];
+  int expired;
+
+  expired = runqtick(&rq[c], p);
+  if(--j->left > 0){
+    if(expired){
+      running[c] = 0;
+      makeready(p);
+    }
+    return;
+  }
+
+  running[c] = 0;
+  j->cur++;
+  if(j->cur == j->nburst){
+    j->finish = ticks + 1;
+    j->p = 0;
+    ndone++;
+    p->state = UNUSED;
+    return;
+  }
+  // Start an I/O wait; the next CPU burst follows it.
+  runqblocked(&rq[c], p);
+  p->state = SLEEPING;
+  j->wake = ticks + 1 + j->burst[j->cur];
+  j->cur++;
+  j->left = j->burst[j->cur];
+}
+
+void
+simulate(void)
+{
+  struct job *j, *next;
+  int c;
+
+  next = jobs;
+  for(ticks = 0; ndone < njob && ticks < MAXTICK; ticks++){
+    while(next < &jobs[njob] && next->arrival <= ticks && spawn(next))
+      next++;
+    for(j = jobs; j < next; j++)
+      if(j->p && j->p->state == SLEEPING && j->wake <= ticks)
+        wake(j->p);
+    if(ticks % MLFQ_AGEPERIOD == 0)
+      for(c = 0; c < ncpus; c++)
+        runqclock(&rq[c], ticks);
+    for(c = 0; c < ncpus; c++)
+      if(running[c] == 0)
+        dispatch(c);
+    for(c = 0; c < ncpus; c++)
+      if(running[c])
+        runtick(c);
+  }
+}
+
+//PAGEBREAK: 30
+// Reports.
+
+int
+uintcmp(const void *a, const void *b)
+{
+  uint x = *(const uint*)a, y = *(const uint*)b;
+
+  return x < y ? -1 : x > y;
+}
+
+void
+summary(char *what, uint *v, int n)
+{
+  double sum = 0;
+  int i;
+
+  if(n == 0)
+    return;
+  qsort(v, n, sizeof(*v), uintcmp);
+  for(i = 0; i < n; i++)
+    sum += v[i];
+  printf("%-11s mean %8.1f  p50 %6u  p99 %6u  max %6u ticks\n",
+         what, sum / n, v[n/2], v[n * 99 / 100], v[n-1]);
+}
+
+void
+report(int verbose)
+{
+  static uint turn[MAXJOB], resp[MAXJOB];
+  struct schedclass *cls;
+  struct queuestat st;
+  struct job *j;
+  uint end, cpuwork;
+  uint64 ns;
+  int i, c, n, k;
+
+  end = 0;
+  cpuwork = 0;
+  n = 0;
+  for(j = jobs; j < &jobs[njob]; j++){
+    for(k = 0; k < j->nburst; k += 2)
+      cpuwork += j->burst[k];
+    if(!j->finish)
+      continue;
+    turn[n] = j->finish - j->arrival;
+    resp[n] = j->firstrun - j->arrival;
+    n++;
+    if(j->finish > end)
+      end = j->finish;
+    if(verbose)
+      printf("job %4ld  arrive %6u  queue %d  first %6u  finish %6u\n",
+             (long)(j - jobs + 1), j->arrival, j->queue, j->firstrun, j->finish);
+  }
+
+  printf("%d of %d jobs done in %u ticks on %d cpus\n", n, njob, end, ncpus);
+  if(end > 0)
+    printf("throughput  %.2f jobs/100 ticks, cpu busy %.1f%%\n",
+           100.0 * n / end, 100.0 * cpuwork / ((double)end * ncpus));
+  summary("turnaround", turn, n);
+  summary("response", resp, n);
+
+  printf("queue class    disp  ticks  preempt  yield\n");
+  for(i = 0; i <= nqueue; i++){
+    memset(&st, 0, sizeof(st));
+    for(c = 0; c < ncpus; c++){
+      st.dispatches += rq[c].stat[i].dispatches;
+      st.runticks += rq[c].stat[i].runticks;
+      st.preemptions += rq[c].stat[i].preemptions;
+      st.yields += rq[c].stat[i].yields;
+    }
+    if(i == 0 && st.dispatches == 0)
+      continue;
+    printf("%-5d %-8s %5u  %5u  %7u  %5u\n", i, queueclass[i]->name,
+           st.dispatches, st.runticks, st.preemptions, st.yields);
+  }
+
+  printf("class     picks    ns/pick\n");
+  for(i = 0; i < NSCHEDCLASS; i++){
+    cls = schedclasses[i];
+    if(cls->picks == 0)
+      continue;
+    ns = cls->cycles > cls->picks * timerns ? cls->cycles - cls->picks * timerns : 0;
+    printf("%-8s %6u  %9.1f\n", cls->name, cls->picks, (double)ns / cls->picks);
+  }
+}
+
+// Overhead of a back-to-back cyclecount() pair, taken off each pick.
+void
+calibrate(void)
+{
+  uint64 t0, best;
+  int i;
+
+  best = ~0ULL;
+  for(i = 0; i < 1000; i++){
+    t0 = cyclecount();
+    t0 = cyclecount() - t0;
+    if(t0 < best)
+      best = t0;
+  }
+  timerns = best;
+}
+
+int
+main(int argc, char *argv[])
+{
+  int i, n, gap, verbose;
+  uint seed;
+  char *file;
+
+  n = 200;
+  gap = 80;
+  seed = 1;
+  verbose = 0;
+  file = 0;
+  for(i = 1; i < argc; i++){
+    if(strcmp(argv[i], "-v") == 0)
+      verbose = 1;
+    else if(argv[i][0] == '-' && i + 1 < argc){
+      switch(argv[i][1]){
+      case 'c':
+        ncpus = atoi(argv[++i]);
+        break;
+      case 'm':
+        if(setclasses(argv[++i]) < 0){
+          fprintf(stderr, "schedsim: bad class list %s\n", argv[i]);
+          exit(1);
+        }
+        break;
+      case 'q':
+        numlist(argv[++i], &quantum[1], NQUEUE - 1);
+        break;
+      case 'n':
+        n = atoi(argv[++i]);
+        break;
+      case 'a':
+        gap = atoi(argv[++i]);
+        break;
+      case 's':
+        seed = strtoul(argv[++i], 0, 0);
+        break;
+      default:
+        goto usage;
+      }
+    } else if(argv[i][0] != '-' && file == 0)
+      file = argv[i];
+    else
+      goto usage;
+  }
+  if(ncpus < 1 || ncpus > NCPU || n < 1 || n > MAXJOB || gap < 0 || seed == 0)
+    goto usage;
+
+  wlstate = seed;
+  if(file){
+    if(readjobs(file) < 0)
+      exit(1);
+  } else
+    genjobs(n, gap);
+
+  for(i = 0; i < NCPU; i++)
+    runqseed(&rq[i], i, seed);
+  calibrate();
+  simulate();
+  report(verbose);
+  exit(0);
+
+usage:
+  fprintf(stderr, "usage: schedsim [-c cpus] [-m class,...] [-q quantum,...]\n"
+                  "                [-n jobs] [-a ticks] [-s seed] [-v] [workload]\n");
+  exit(1);
+}
@@ -0,0 +1,1507 @@
+
+_schedstat:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  }
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	51                   	push   %ecx
+  11:	83 ec 18             	sub    $0x18,%esp
+  14:	8b 31                	mov    (%ecx),%esi
+  16:	8b 79 04             	mov    0x4(%ecx),%edi
+  int interval = 100, count = 1;
+
+  if(argc > 1)
+  19:	83 fe 01             	cmp    $0x1,%esi
+  1c:	7f 48                	jg     66 <main+0x66>
+  if(interval < 1 || count < 1){
+    printf(2, "usage: schedstat [ticks [count]]\n");
+    exit();
+  }
+
+  if(getSchedStat(&prev) < 0){
+  1e:	83 ec 0c             	sub    $0xc,%esp
+  21:	68 20 11 00 00       	push   $0x1120
+  26:	e8 f0 05 00 00       	call   61b <getSchedStat>
+  2b:	83 c4 10             	add    $0x10,%esp
+  2e:	85 c0                	test   %eax,%eax
+  30:	78 7f                	js     b1 <main+0xb1>
+    printf(2, "schedstat: getSchedStat failed\n");
+    exit();
+  }
+  while(count-- > 0){
+    sleep(interval);
+  32:	83 ec 0c             	sub    $0xc,%esp
+    getSchedStat(&cur);
+    report();
+    prev = cur;
+  35:	bf 20 11 00 00       	mov    $0x1120,%edi
+  3a:	be e0 0e 00 00       	mov    $0xee0,%esi
+    sleep(interval);
+  3f:	6a 64                	push   $0x64
+  41:	e8 8d 05 00 00       	call   5d3 <sleep>
+    getSchedStat(&cur);
+  46:	c7 04 24 e0 0e 00 00 	movl   $0xee0,(%esp)
+  4d:	e8 c9 05 00 00       	call   61b <getSchedStat>
+    report();
+  52:	e8 b9 01 00 00       	call   210 <report>
+    prev = cur;
+  57:	b9 89 00 00 00       	mov    $0x89,%ecx
+  5c:	83 c4 10             	add    $0x10,%esp
+  5f:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  }
+  exit();
+  61:	e8 dd 04 00 00       	call   543 <exit>
+    interval = atoi(argv[1]);
+  66:	83 ec 0c             	sub    $0xc,%esp
+  69:	ff 77 04             	push   0x4(%edi)
+  int interval = 100, count = 1;
+  6c:	bb 01 00 00 00       	mov    $0x1,%ebx
+    interval = atoi(argv[1]);
+  71:	e8 5a 04 00 00       	call   4d0 <atoi>
+  if(argc > 2)
+  76:	83 c4 10             	add    $0x10,%esp
+    interval = atoi(argv[1]);
+  79:	89 c2                	mov    %eax,%edx
+  if(argc > 2)
+  7b:	83 fe 02             	cmp    $0x2,%esi
+  7e:	74 16                	je     96 <main+0x96>
+    count = atoi(argv[2]);
+  80:	83 ec 0c             	sub    $0xc,%esp
+  83:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  86:	ff 77 08             	push   0x8(%edi)
+  89:	e8 42 04 00 00       	call   4d0 <atoi>
+  8e:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  91:	83 c4 10             	add    $0x10,%esp
+  94:	89 c3                	mov    %eax,%ebx
+  if(interval < 1 || count < 1){
+  96:	85 d2                	test   %edx,%edx
+  98:	7e 04                	jle    9e <main+0x9e>
+  9a:	85 db                	test   %ebx,%ebx
+  9c:	7f 26                	jg     c4 <main+0xc4>
+    printf(2, "usage: schedstat [ticks [count]]\n");
+  9e:	52                   	push   %edx
+  9f:	52                   	push   %edx
+  a0:	68 bc 0a 00 00       	push   $0xabc
+  a5:	6a 02                	push   $0x2
+  a7:	e8 64 06 00 00       	call   710 <printf>
+    exit();
+  ac:	e8 92 04 00 00       	call   543 <exit>
+    printf(2, "schedstat: getSchedStat failed\n");
+  b1:	50                   	push   %eax
+  b2:	50                   	push   %eax
+  b3:	68 e0 0a 00 00       	push   $0xae0
+  b8:	6a 02                	push   $0x2
+  ba:	e8 51 06 00 00       	call   710 <printf>
+    exit();
+  bf:	e8 7f 04 00 00       	call   543 <exit>
+  if(getSchedStat(&prev) < 0){
+  c4:	83 ec 0c             	sub    $0xc,%esp
+  c7:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  ca:	68 20 11 00 00       	push   $0x1120
+  cf:	e8 47 05 00 00       	call   61b <getSchedStat>
+  d4:	83 c4 10             	add    $0x10,%esp
+  d7:	85 c0                	test   %eax,%eax
+  d9:	78 d6                	js     b1 <main+0xb1>
+  while(count-- > 0){
+  db:	83 eb 01             	sub    $0x1,%ebx
+  de:	66 90                	xchg   %ax,%ax
+    sleep(interval);
+  e0:	83 ec 0c             	sub    $0xc,%esp
+  e3:	ff 75 e4             	push   -0x1c(%ebp)
+  while(count-- > 0){
+  e6:	83 eb 01             	sub    $0x1,%ebx
+    prev = cur;
+  e9:	bf 20 11 00 00       	mov    $0x1120,%edi
+  ee:	be e0 0e 00 00       	mov    $0xee0,%esi
+    sleep(interval);
+  f3:	e8 db 04 00 00       	call   5d3 <sleep>
+    getSchedStat(&cur);
+  f8:	c7 04 24 e0 0e 00 00 	movl   $0xee0,(%esp)
+  ff:	e8 17 05 00 00       	call   61b <getSchedStat>
+    report();
+ 104:	e8 07 01 00 00       	call   210 <report>
+    prev = cur;
+ 109:	b9 89 00 00 00       	mov    $0x89,%ecx
+  while(count-- > 0){
+ 10e:	83 c4 10             	add    $0x10,%esp
+    prev = cur;
+ 111:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  while(count-- > 0){
+ 113:	83 fb ff             	cmp    $0xffffffff,%ebx
+ 116:	75 c8                	jne    e0 <main+0xe0>
+ 118:	e9 44 ff ff ff       	jmp    61 <main+0x61>
+ 11d:	66 90                	xchg   %ax,%ax
+ 11f:	90                   	nop
+
+00000120 <row>:
+{
+ 120:	55                   	push   %ebp
+ 121:	89 e5                	mov    %esp,%ebp
+ 123:	57                   	push   %edi
+ 124:	56                   	push   %esi
+ 125:	53                   	push   %ebx
+ 126:	83 ec 1c             	sub    $0x1c,%esp
+ 129:	8b 7d 08             	mov    0x8(%ebp),%edi
+ 12c:	8b 75 0c             	mov    0xc(%ebp),%esi
+ 12f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  samples = cur.samples - prev.samples;
+ 132:	8b 0d e4 0e 00 00    	mov    0xee4,%ecx
+  avglen = samples ? (b->lensum - a->lensum) * 10 / samples : 0;
+ 138:	2b 0d 24 11 00 00    	sub    0x1124,%ecx
+ 13e:	0f 84 bc 00 00 00    	je     200 <row+0xe0>
+ 144:	8b 43 10             	mov    0x10(%ebx),%eax
+ 147:	2b 46 10             	sub    0x10(%esi),%eax
+ 14a:	31 d2                	xor    %edx,%edx
+ 14c:	8d 04 80             	lea    (%eax,%eax,4),%eax
+ 14f:	01 c0                	add    %eax,%eax
+ 151:	f7 f1                	div    %ecx
+  printf(1, "%s  %d  %d  %d  %d  %d.%d  %d  ",
+ 153:	b9 cd cc cc cc       	mov    $0xcccccccd,%ecx
+ 158:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+ 15b:	f7 e1                	mul    %ecx
+ 15d:	89 d1                	mov    %edx,%ecx
+ 15f:	c1 e9 03             	shr    $0x3,%ecx
+ 162:	8d 14 89             	lea    (%ecx,%ecx,4),%edx
+ 165:	89 c8                	mov    %ecx,%eax
+ 167:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 16a:	01 d2                	add    %edx,%edx
+ 16c:	29 d1                	sub    %edx,%ecx
+ 16e:	83 ec 08             	sub    $0x8,%esp
+ 171:	ff 73 14             	push   0x14(%ebx)
+ 174:	51                   	push   %ecx
+ 175:	50                   	push   %eax
+ 176:	8b 43 0c             	mov    0xc(%ebx),%eax
+ 179:	2b 46 0c             	sub    0xc(%esi),%eax
+ 17c:	50                   	push   %eax
+ 17d:	8b 43 08             	mov    0x8(%ebx),%eax
+ 180:	2b 46 08             	sub    0x8(%esi),%eax
+ 183:	50                   	push   %eax
+ 184:	8b 43 04             	mov    0x4(%ebx),%eax
+ 187:	2b 46 04             	sub    0x4(%esi),%eax
+ 18a:	50                   	push   %eax
+ 18b:	8b 03                	mov    (%ebx),%eax
+ 18d:	2b 06                	sub    (%esi),%eax
+ 18f:	50                   	push   %eax
+ 190:	57                   	push   %edi
+  for(j = 0; j < NLATBUCKET; j++)
+ 191:	bf 01 00 00 00       	mov    $0x1,%edi
+  printf(1, "%s  %d  %d  %d  %d  %d.%d  %d  ",
+ 196:	68 38 0a 00 00       	push   $0xa38
+ 19b:	6a 01                	push   $0x1
+ 19d:	e8 6e 05 00 00       	call   710 <printf>
+    printf(1, "%s%d", j ? "/" : "", b->latency[j] - a->latency[j]);
+ 1a2:	8b 43 18             	mov    0x18(%ebx),%eax
+ 1a5:	83 c4 30             	add    $0x30,%esp
+ 1a8:	2b 46 18             	sub    0x18(%esi),%eax
+ 1ab:	50                   	push   %eax
+ 1ac:	68 16 0b 00 00       	push   $0xb16
+ 1b1:	68 00 0b 00 00       	push   $0xb00
+ 1b6:	6a 01                	push   $0x1
+ 1b8:	e8 53 05 00 00       	call   710 <printf>
+ 1bd:	83 c4 10             	add    $0x10,%esp
+ 1c0:	8b 44 bb 18          	mov    0x18(%ebx,%edi,4),%eax
+ 1c4:	2b 44 be 18          	sub    0x18(%esi,%edi,4),%eax
+  for(j = 0; j < NLATBUCKET; j++)
+ 1c8:	83 c7 01             	add    $0x1,%edi
+    printf(1, "%s%d", j ? "/" : "", b->latency[j] - a->latency[j]);
+ 1cb:	50                   	push   %eax
+ 1cc:	68 05 0b 00 00       	push   $0xb05
+ 1d1:	68 00 0b 00 00       	push   $0xb00
+ 1d6:	6a 01                	push   $0x1
+ 1d8:	e8 33 05 00 00       	call   710 <printf>
+  for(j = 0; j < NLATBUCKET; j++)
+ 1dd:	83 c4 10             	add    $0x10,%esp
+ 1e0:	83 ff 08             	cmp    $0x8,%edi
+ 1e3:	75 db                	jne    1c0 <row+0xa0>
+  printf(1, "\n");
+ 1e5:	c7 45 0c 15 0b 00 00 	movl   $0xb15,0xc(%ebp)
+ 1ec:	c7 45 08 01 00 00 00 	movl   $0x1,0x8(%ebp)
+}
+ 1f3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 1f6:	5b                   	pop    %ebx
+ 1f7:	5e                   	pop    %esi
+ 1f8:	5f                   	pop    %edi
+ 1f9:	5d                   	pop    %ebp
+  printf(1, "\n");
+ 1fa:	e9 11 05 00 00       	jmp    710 <printf>
+ 1ff:	90                   	nop
+ 200:	31 c0                	xor    %eax,%eax
+ 202:	e9 67 ff ff ff       	jmp    16e <row+0x4e>
+ 207:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 20e:	66 90                	xchg   %ax,%ax
+
+00000210 <report>:
+{
+ 210:	55                   	push   %ebp
+ 211:	89 e5                	mov    %esp,%ebp
+ 213:	56                   	push   %esi
+ 214:	be 64 00 00 00       	mov    $0x64,%esi
+ 219:	53                   	push   %ebx
+  printf(1, "over %d ticks:\n", cur.ticks - prev.ticks);
+ 21a:	a1 e0 0e 00 00       	mov    0xee0,%eax
+ 21f:	2b 05 20 11 00 00    	sub    0x1120,%eax
+ 225:	83 ec 04             	sub    $0x4,%esp
+ 228:	50                   	push   %eax
+ 229:	68 07 0b 00 00       	push   $0xb07
+ 22e:	6a 01                	push   $0x1
+ 230:	e8 db 04 00 00       	call   710 <printf>
+  printf(1, "queue class    disp  ticks  preempt  yield  avglen  maxlen  wait 0/1/2-3/4-7/8-15/16-31/32-63/64+\n");
+ 235:	58                   	pop    %eax
+ 236:	5a                   	pop    %edx
+ 237:	68 58 0a 00 00       	push   $0xa58
+ 23c:	6a 01                	push   $0x1
+ 23e:	e8 cd 04 00 00       	call   710 <printf>
+  printf(1, "rt    ");
+ 243:	59                   	pop    %ecx
+ 244:	5b                   	pop    %ebx
+ 245:	68 17 0b 00 00       	push   $0xb17
+ 24a:	6a 01                	push   $0x1
+ 24c:	bb 01 00 00 00       	mov    $0x1,%ebx
+ 251:	e8 ba 04 00 00       	call   710 <printf>
+  row("edf", &prev.rt, &cur.rt);
+ 256:	83 c4 0c             	add    $0xc,%esp
+ 259:	68 cc 10 00 00       	push   $0x10cc
+ 25e:	68 0c 13 00 00       	push   $0x130c
+ 263:	68 1e 0b 00 00       	push   $0xb1e
+ 268:	e8 b3 fe ff ff       	call   120 <row>
+  for(i = 1; i <= cur.nqueue + 1; i++){
+ 26d:	a1 e8 0e 00 00       	mov    0xee8,%eax
+ 272:	83 c4 10             	add    $0x10,%esp
+ 275:	85 c0                	test   %eax,%eax
+ 277:	79 57                	jns    2d0 <report+0xc0>
+ 279:	eb 75                	jmp    2f0 <report+0xe0>
+ 27b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 27f:	90                   	nop
+      printf(1, "fb    ");
+ 280:	83 ec 08             	sub    $0x8,%esp
+ 283:	68 22 0b 00 00       	push   $0xb22
+ 288:	6a 01                	push   $0x1
+ 28a:	e8 81 04 00 00       	call   710 <printf>
+ 28f:	83 c4 10             	add    $0x10,%esp
+ 292:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 297:	31 d2                	xor    %edx,%edx
+    row(classnames[cur.cls[j]], &prev.q[j], &cur.q[j]);
+ 299:	83 ec 04             	sub    $0x4,%esp
+ 29c:	8d 88 e0 0e 00 00    	lea    0xee0(%eax),%ecx
+ 2a2:	05 20 11 00 00       	add    $0x1120,%eax
+  for(i = 1; i <= cur.nqueue + 1; i++){
+ 2a7:	83 c6 38             	add    $0x38,%esi
+    row(classnames[cur.cls[j]], &prev.q[j], &cur.q[j]);
+ 2aa:	51                   	push   %ecx
+ 2ab:	50                   	push   %eax
+ 2ac:	8b 04 95 ec 0e 00 00 	mov    0xeec(,%edx,4),%eax
+ 2b3:	ff 34 85 b0 0e 00 00 	push   0xeb0(,%eax,4)
+ 2ba:	e8 61 fe ff ff       	call   120 <row>
+  for(i = 1; i <= cur.nqueue + 1; i++){
+ 2bf:	a1 e8 0e 00 00       	mov    0xee8,%eax
+ 2c4:	8d 53 01             	lea    0x1(%ebx),%edx
+ 2c7:	83 c4 10             	add    $0x10,%esp
+ 2ca:	39 d8                	cmp    %ebx,%eax
+ 2cc:	7c 22                	jl     2f0 <report+0xe0>
+ 2ce:	89 d3                	mov    %edx,%ebx
+    j = i <= cur.nqueue ? i : 0;  // fallback queue last
+ 2d0:	39 d8                	cmp    %ebx,%eax
+ 2d2:	7c ac                	jl     280 <report+0x70>
+      printf(1, "%d     ", j);
+ 2d4:	83 ec 04             	sub    $0x4,%esp
+ 2d7:	53                   	push   %ebx
+ 2d8:	68 29 0b 00 00       	push   $0xb29
+ 2dd:	6a 01                	push   $0x1
+ 2df:	e8 2c 04 00 00       	call   710 <printf>
+ 2e4:	83 c4 10             	add    $0x10,%esp
+ 2e7:	89 f0                	mov    %esi,%eax
+ 2e9:	89 da                	mov    %ebx,%edx
+ 2eb:	eb ac                	jmp    299 <report+0x89>
+ 2ed:	8d 76 00             	lea    0x0(%esi),%esi
+}
+ 2f0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 2f3:	5b                   	pop    %ebx
+ 2f4:	5e                   	pop    %esi
+ 2f5:	5d                   	pop    %ebp
+ 2f6:	c3                   	ret
+ 2f7:	66 90                	xchg   %ax,%ax
+ 2f9:	66 90                	xchg   %ax,%ax
+ 2fb:	66 90                	xchg   %ax,%ax
+ 2fd:	66 90                	xchg   %ax,%ax
+ 2ff:	90                   	nop
+
+00000300 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 300:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 301:	31 c0                	xor    %eax,%eax
+{
+ 303:	89 e5                	mov    %esp,%ebp
+ 305:	53                   	push   %ebx
+ 306:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 309:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 30c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 310:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 314:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 317:	83 c0 01             	add    $0x1,%eax
+ 31a:	84 d2                	test   %dl,%dl
+ 31c:	75 f2                	jne    310 <strcpy+0x10>
+    ;
+  return os;
+}
+ 31e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 321:	89 c8                	mov    %ecx,%eax
+ 323:	c9                   	leave
+ 324:	c3                   	ret
+ 325:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 32c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000330 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 330:	55                   	push   %ebp
+ 331:	89 e5                	mov    %esp,%ebp
+ 333:	53                   	push   %ebx
+ 334:	8b 55 08             	mov    0x8(%ebp),%edx
+ 337:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 33a:	0f b6 02             	movzbl (%edx),%eax
+ 33d:	84 c0                	test   %al,%al
+ 33f:	75 17                	jne    358 <strcmp+0x28>
+ 341:	eb 3a                	jmp    37d <strcmp+0x4d>
+ 343:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 347:	90                   	nop
+ 348:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 34c:	83 c2 01             	add    $0x1,%edx
+ 34f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 352:	84 c0                	test   %al,%al
+ 354:	74 1a                	je     370 <strcmp+0x40>
+    p++, q++;
+ 356:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 358:	0f b6 19             	movzbl (%ecx),%ebx
+ 35b:	38 c3                	cmp    %al,%bl
+ 35d:	74 e9                	je     348 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 35f:	29 d8                	sub    %ebx,%eax
+}
+ 361:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 364:	c9                   	leave
+ 365:	c3                   	ret
+ 366:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 36d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 370:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 374:	31 c0                	xor    %eax,%eax
+ 376:	29 d8                	sub    %ebx,%eax
+}
+ 378:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 37b:	c9                   	leave
+ 37c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 37d:	0f b6 19             	movzbl (%ecx),%ebx
+ 380:	31 c0                	xor    %eax,%eax
+ 382:	eb db                	jmp    35f <strcmp+0x2f>
+ 384:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 38b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 38f:	90                   	nop
+
+00000390 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 390:	55                   	push   %ebp
+ 391:	89 e5                	mov    %esp,%ebp
+ 393:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 396:	80 3a 00             	cmpb   $0x0,(%edx)
+ 399:	74 15                	je     3b0 <strlen+0x20>
+ 39b:	31 c0                	xor    %eax,%eax
+ 39d:	8d 76 00             	lea    0x0(%esi),%esi
+ 3a0:	83 c0 01             	add    $0x1,%eax
+ 3a3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 3a7:	89 c1                	mov    %eax,%ecx
+ 3a9:	75 f5                	jne    3a0 <strlen+0x10>
+    ;
+  return n;
+}
+ 3ab:	89 c8                	mov    %ecx,%eax
+ 3ad:	5d                   	pop    %ebp
+ 3ae:	c3                   	ret
+ 3af:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 3b0:	31 c9                	xor    %ecx,%ecx
+}
+ 3b2:	5d                   	pop    %ebp
+ 3b3:	89 c8                	mov    %ecx,%eax
+ 3b5:	c3                   	ret
+ 3b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3bd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000003c0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 3c0:	55                   	push   %ebp
+ 3c1:	89 e5                	mov    %esp,%ebp
+ 3c3:	57                   	push   %edi
+ 3c4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 3c7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 3ca:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 3cd:	89 d7                	mov    %edx,%edi
+ 3cf:	fc                   	cld
+ 3d0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 3d2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 3d5:	89 d0                	mov    %edx,%eax
+ 3d7:	c9                   	leave
+ 3d8:	c3                   	ret
+ 3d9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000003e0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 3e0:	55                   	push   %ebp
+ 3e1:	89 e5                	mov    %esp,%ebp
+ 3e3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3e6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 3ea:	0f b6 10             	movzbl (%eax),%edx
+ 3ed:	84 d2                	test   %dl,%dl
+ 3ef:	75 12                	jne    403 <strchr+0x23>
+ 3f1:	eb 1d                	jmp    410 <strchr+0x30>
+ 3f3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 3f7:	90                   	nop
+ 3f8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 3fc:	83 c0 01             	add    $0x1,%eax
+ 3ff:	84 d2                	test   %dl,%dl
+ 401:	74 0d                	je     410 <strchr+0x30>
+    if(*s == c)
+ 403:	38 d1                	cmp    %dl,%cl
+ 405:	75 f1                	jne    3f8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 407:	5d                   	pop    %ebp
+ 408:	c3                   	ret
+ 409:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 410:	31 c0                	xor    %eax,%eax
+}
+ 412:	5d                   	pop    %ebp
+ 413:	c3                   	ret
+ 414:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 41b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 41f:	90                   	nop
+
+00000420 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 420:	55                   	push   %ebp
+ 421:	89 e5                	mov    %esp,%ebp
+ 423:	57                   	push   %edi
+ 424:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 425:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 428:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 429:	31 db                	xor    %ebx,%ebx
+{
+ 42b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 42e:	eb 27                	jmp    457 <gets+0x37>
+    cc = read(0, &c, 1);
+ 430:	83 ec 04             	sub    $0x4,%esp
+ 433:	6a 01                	push   $0x1
+ 435:	56                   	push   %esi
+ 436:	6a 00                	push   $0x0
+ 438:	e8 1e 01 00 00       	call   55b <read>
+    if(cc < 1)
+ 43d:	83 c4 10             	add    $0x10,%esp
+ 440:	85 c0                	test   %eax,%eax
+ 442:	7e 1d                	jle    461 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 444:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 448:	8b 55 08             	mov    0x8(%ebp),%edx
+ 44b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 44f:	3c 0a                	cmp    $0xa,%al
+ 451:	74 10                	je     463 <gets+0x43>
+ 453:	3c 0d                	cmp    $0xd,%al
+ 455:	74 0c                	je     463 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 457:	89 df                	mov    %ebx,%edi
+ 459:	83 c3 01             	add    $0x1,%ebx
+ 45c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 45f:	7c cf                	jl     430 <gets+0x10>
+ 461:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 463:	8b 45 08             	mov    0x8(%ebp),%eax
+ 466:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 46a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 46d:	5b                   	pop    %ebx
+ 46e:	5e                   	pop    %esi
+ 46f:	5f                   	pop    %edi
+ 470:	5d                   	pop    %ebp
+ 471:	c3                   	ret
+ 472:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 479:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000480 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 480:	55                   	push   %ebp
+ 481:	89 e5                	mov    %esp,%ebp
+ 483:	56                   	push   %esi
+ 484:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 485:	83 ec 08             	sub    $0x8,%esp
+ 488:	6a 00                	push   $0x0
+ 48a:	ff 75 08             	push   0x8(%ebp)
+ 48d:	e8 f1 00 00 00       	call   583 <open>
+  if(fd < 0)
+ 492:	83 c4 10             	add    $0x10,%esp
+ 495:	85 c0                	test   %eax,%eax
+ 497:	78 27                	js     4c0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 499:	83 ec 08             	sub    $0x8,%esp
+ 49c:	ff 75 0c             	push   0xc(%ebp)
+ 49f:	89 c3                	mov    %eax,%ebx
+ 4a1:	50                   	push   %eax
+ 4a2:	e8 f4 00 00 00       	call   59b <fstat>
+  close(fd);
+ 4a7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 4aa:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 4ac:	e8 ba 00 00 00       	call   56b <close>
+  return r;
+ 4b1:	83 c4 10             	add    $0x10,%esp
+}
+ 4b4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 4b7:	89 f0                	mov    %esi,%eax
+ 4b9:	5b                   	pop    %ebx
+ 4ba:	5e                   	pop    %esi
+ 4bb:	5d                   	pop    %ebp
+ 4bc:	c3                   	ret
+ 4bd:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 4c0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 4c5:	eb ed                	jmp    4b4 <stat+0x34>
+ 4c7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4ce:	66 90                	xchg   %ax,%ax
+
+000004d0 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 4d0:	55                   	push   %ebp
+ 4d1:	89 e5                	mov    %esp,%ebp
+ 4d3:	53                   	push   %ebx
+ 4d4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 4d7:	0f be 02             	movsbl (%edx),%eax
+ 4da:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 4dd:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 4e0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 4e5:	77 1e                	ja     505 <atoi+0x35>
+ 4e7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4ee:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 4f0:	83 c2 01             	add    $0x1,%edx
+ 4f3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 4f6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 4fa:	0f be 02             	movsbl (%edx),%eax
+ 4fd:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 500:	80 fb 09             	cmp    $0x9,%bl
+ 503:	76 eb                	jbe    4f0 <atoi+0x20>
+  return n;
+}
+ 505:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 508:	89 c8                	mov    %ecx,%eax
+ 50a:	c9                   	leave
+ 50b:	c3                   	ret
+ 50c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000510 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 510:	55                   	push   %ebp
+ 511:	89 e5                	mov    %esp,%ebp
+ 513:	57                   	push   %edi
+ 514:	56                   	push   %esi
+ 515:	8b 45 10             	mov    0x10(%ebp),%eax
+ 518:	8b 55 08             	mov    0x8(%ebp),%edx
+ 51b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 51e:	85 c0                	test   %eax,%eax
+ 520:	7e 13                	jle    535 <memmove+0x25>
+ 522:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 524:	89 d7                	mov    %edx,%edi
+ 526:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 52d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 530:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 531:	39 f8                	cmp    %edi,%eax
+ 533:	75 fb                	jne    530 <memmove+0x20>
+  return vdst;
+}
+ 535:	5e                   	pop    %esi
+ 536:	89 d0                	mov    %edx,%eax
+ 538:	5f                   	pop    %edi
+ 539:	5d                   	pop    %ebp
+ 53a:	c3                   	ret
+
+0000053b <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 53b:	b8 01 00 00 00       	mov    $0x1,%eax
+ 540:	cd 40                	int    $0x40
+ 542:	c3                   	ret
+
+00000543 <exit>:
+SYSCALL(exit)
+ 543:	b8 02 00 00 00       	mov    $0x2,%eax
+ 548:	cd 40                	int    $0x40
+ 54a:	c3                   	ret
+
+0000054b <wait>:
+SYSCALL(wait)
+ 54b:	b8 03 00 00 00       	mov    $0x3,%eax
+ 550:	cd 40                	int    $0x40
+ 552:	c3                   	ret
+
+00000553 <pipe>:
+SYSCALL(pipe)
+ 553:	b8 04 00 00 00       	mov    $0x4,%eax
+ 558:	cd 40                	int    $0x40
+ 55a:	c3                   	ret
+
+0000055b <read>:
+SYSCALL(read)
+ 55b:	b8 05 00 00 00       	mov    $0x5,%eax
+ 560:	cd 40                	int    $0x40
+ 562:	c3                   	ret
+
+00000563 <write>:
+SYSCALL(write)
+ 563:	b8 10 00 00 00       	mov    $0x10,%eax
+ 568:	cd 40                	int    $0x40
+ 56a:	c3                   	ret
+
+0000056b <close>:
+SYSCALL(close)
+ 56b:	b8 15 00 00 00       	mov    $0x15,%eax
+ 570:	cd 40                	int    $0x40
+ 572:	c3                   	ret
+
+00000573 <kill>:
+SYSCALL(kill)
+ 573:	b8 06 00 00 00       	mov    $0x6,%eax
+ 578:	cd 40                	int    $0x40
+ 57a:	c3                   	ret
+
+0000057b <exec>:
+SYSCALL(exec)
+ 57b:	b8 07 00 00 00       	mov    $0x7,%eax
+ 580:	cd 40                	int    $0x40
+ 582:	c3                   	ret
+
+00000583 <open>:
+SYSCALL(open)
+ 583:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 588:	cd 40                	int    $0x40
+ 58a:	c3                   	ret
+
+0000058b <mknod>:
+SYSCALL(mknod)
+ 58b:	b8 11 00 00 00       	mov    $0x11,%eax
+ 590:	cd 40                	int    $0x40
+ 592:	c3                   	ret
+
+00000593 <unlink>:
+SYSCALL(unlink)
+ 593:	b8 12 00 00 00       	mov    $0x12,%eax
+ 598:	cd 40                	int    $0x40
+ 59a:	c3                   	ret
+
+0000059b <fstat>:
+SYSCALL(fstat)
+ 59b:	b8 08 00 00 00       	mov    $0x8,%eax
+ 5a0:	cd 40                	int    $0x40
+ 5a2:	c3                   	ret
+
+000005a3 <link>:
+SYSCALL(link)
+ 5a3:	b8 13 00 00 00       	mov    $0x13,%eax
+ 5a8:	cd 40                	int    $0x40
+ 5aa:	c3                   	ret
+
+000005ab <mkdir>:
+SYSCALL(mkdir)
+ 5ab:	b8 14 00 00 00       	mov    $0x14,%eax
+ 5b0:	cd 40                	int    $0x40
+ 5b2:	c3                   	ret
+
+000005b3 <chdir>:
+SYSCALL(chdir)
+ 5b3:	b8 09 00 00 00       	mov    $0x9,%eax
+ 5b8:	cd 40                	int    $0x40
+ 5ba:	c3                   	ret
+
+000005bb <dup>:
+SYSCALL(dup)
+ 5bb:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 5c0:	cd 40                	int    $0x40
+ 5c2:	c3                   	ret
+
+000005c3 <getpid>:
+SYSCALL(getpid)
+ 5c3:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 5c8:	cd 40                	int    $0x40
+ 5ca:	c3                   	ret
+
+000005cb <sbrk>:
+SYSCALL(sbrk)
+ 5cb:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 5d0:	cd 40                	int    $0x40
+ 5d2:	c3                   	ret
+
+000005d3 <sleep>:
+SYSCALL(sleep)
+ 5d3:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 5d8:	cd 40                	int    $0x40
+ 5da:	c3                   	ret
+
+000005db <uptime>:
+SYSCALL(uptime)
+ 5db:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 5e0:	cd 40                	int    $0x40
+ 5e2:	c3                   	ret
+
+000005e3 <setTicket>:
+SYSCALL(setTicket)
+ 5e3:	b8 16 00 00 00       	mov    $0x16,%eax
+ 5e8:	cd 40                	int    $0x40
+ 5ea:	c3                   	ret
+
+000005eb <changeQueue>:
+SYSCALL(changeQueue)
+ 5eb:	b8 17 00 00 00       	mov    $0x17,%eax
+ 5f0:	cd 40                	int    $0x40
+ 5f2:	c3                   	ret
+
+000005f3 <setLotteryTicket>:
+SYSCALL(setLotteryTicket)
+ 5f3:	b8 18 00 00 00       	mov    $0x18,%eax
+ 5f8:	cd 40                	int    $0x40
+ 5fa:	c3                   	ret
+
+000005fb <setSRPFPriority>:
+SYSCALL(setSRPFPriority)
+ 5fb:	b8 19 00 00 00       	mov    $0x19,%eax
+ 600:	cd 40                	int    $0x40
+ 602:	c3                   	ret
+
+00000603 <printInfo>:
+SYSCALL(printInfo)
+ 603:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 608:	cd 40                	int    $0x40
+ 60a:	c3                   	ret
+
+0000060b <configQueues>:
+SYSCALL(configQueues)
+ 60b:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 610:	cd 40                	int    $0x40
+ 612:	c3                   	ret
+
+00000613 <setQuantum>:
+SYSCALL(setQuantum)
+ 613:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 618:	cd 40                	int    $0x40
+ 61a:	c3                   	ret
+
+0000061b <getSchedStat>:
+SYSCALL(getSchedStat)
+ 61b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 620:	cd 40                	int    $0x40
+ 622:	c3                   	ret
+
+00000623 <schedTrace>:
+SYSCALL(schedTrace)
+ 623:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 628:	cd 40                	int    $0x40
+ 62a:	c3                   	ret
+
+0000062b <schedSeed>:
+SYSCALL(schedSeed)
+ 62b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 630:	cd 40                	int    $0x40
+ 632:	c3                   	ret
+
+00000633 <setSchedAttr>:
+SYSCALL(setSchedAttr)
+ 633:	b8 20 00 00 00       	mov    $0x20,%eax
+ 638:	cd 40                	int    $0x40
+ 63a:	c3                   	ret
+
+0000063b <getSchedAttr>:
+SYSCALL(getSchedAttr)
+ 63b:	b8 21 00 00 00       	mov    $0x21,%eax
+ 640:	cd 40                	int    $0x40
+ 642:	c3                   	ret
+
+00000643 <setAffinity>:
+SYSCALL(setAffinity)
+ 643:	b8 22 00 00 00       	mov    $0x22,%eax
+ 648:	cd 40                	int    $0x40
+ 64a:	c3                   	ret
+
+0000064b <getAffinity>:
+SYSCALL(getAffinity)
+ 64b:	b8 23 00 00 00       	mov    $0x23,%eax
+ 650:	cd 40                	int    $0x40
+ 652:	c3                   	ret
+
+00000653 <gangJoin>:
+SYSCALL(gangJoin)
+ 653:	b8 24 00 00 00       	mov    $0x24,%eax
+ 658:	cd 40                	int    $0x40
+ 65a:	c3                   	ret
+
+0000065b <setRealtime>:
+SYSCALL(setRealtime)
+ 65b:	b8 25 00 00 00       	mov    $0x25,%eax
+ 660:	cd 40                	int    $0x40
+ 662:	c3                   	ret
+ 663:	66 90                	xchg   %ax,%ax
+ 665:	66 90                	xchg   %ax,%ax
+ 667:	66 90                	xchg   %ax,%ax
+ 669:	66 90                	xchg   %ax,%ax
+ 66b:	66 90                	xchg   %ax,%ax
+ 66d:	66 90                	xchg   %ax,%ax
+ 66f:	90                   	nop
+
+00000670 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 670:	55                   	push   %ebp
+ 671:	89 e5                	mov    %esp,%ebp
+ 673:	57                   	push   %edi
+ 674:	56                   	push   %esi
+ 675:	53                   	push   %ebx
+ 676:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 678:	89 d1                	mov    %edx,%ecx
+{
+ 67a:	83 ec 3c             	sub    $0x3c,%esp
+ 67d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 680:	85 d2                	test   %edx,%edx
+ 682:	0f 89 80 00 00 00    	jns    708 <printint+0x98>
+ 688:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 68c:	74 7a                	je     708 <printint+0x98>
+    x = -xx;
+ 68e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 690:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 695:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 698:	31 f6                	xor    %esi,%esi
+ 69a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 6a0:	89 c8                	mov    %ecx,%eax
+ 6a2:	31 d2                	xor    %edx,%edx
+ 6a4:	89 f7                	mov    %esi,%edi
+ 6a6:	f7 f3                	div    %ebx
+ 6a8:	8d 76 01             	lea    0x1(%esi),%esi
+ 6ab:	0f b6 92 ac 0b 00 00 	movzbl 0xbac(%edx),%edx
+ 6b2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 6b6:	89 ca                	mov    %ecx,%edx
+ 6b8:	89 c1                	mov    %eax,%ecx
+ 6ba:	39 da                	cmp    %ebx,%edx
+ 6bc:	73 e2                	jae    6a0 <printint+0x30>
+  if(neg)
+ 6be:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 6c1:	85 c0                	test   %eax,%eax
+ 6c3:	74 07                	je     6cc <printint+0x5c>
+    buf[i++] = '-';
+ 6c5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 6ca:	89 f7                	mov    %esi,%edi
+ 6cc:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 6cf:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 6d2:	01 df                	add    %ebx,%edi
+ 6d4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 6d8:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 6db:	83 ec 04             	sub    $0x4,%esp
+ 6de:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 6e1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 6e4:	6a 01                	push   $0x1
+ 6e6:	50                   	push   %eax
+ 6e7:	56                   	push   %esi
+ 6e8:	e8 76 fe ff ff       	call   563 <write>
+  while(--i >= 0)
+ 6ed:	89 f8                	mov    %edi,%eax
+ 6ef:	83 c4 10             	add    $0x10,%esp
+ 6f2:	83 ef 01             	sub    $0x1,%edi
+ 6f5:	39 d8                	cmp    %ebx,%eax
+ 6f7:	75 df                	jne    6d8 <printint+0x68>
+}
+ 6f9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 6fc:	5b                   	pop    %ebx
+ 6fd:	5e                   	pop    %esi
+ 6fe:	5f                   	pop    %edi
+ 6ff:	5d                   	pop    %ebp
+ 700:	c3                   	ret
+ 701:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 708:	31 c0                	xor    %eax,%eax
+ 70a:	eb 89                	jmp    695 <printint+0x25>
+ 70c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000710 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 710:	55                   	push   %ebp
+ 711:	89 e5                	mov    %esp,%ebp
+ 713:	57                   	push   %edi
+ 714:	56                   	push   %esi
+ 715:	53                   	push   %ebx
+ 716:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 719:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 71c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 71f:	0f b6 1e             	movzbl (%esi),%ebx
+ 722:	83 c6 01             	add    $0x1,%esi
+ 725:	84 db                	test   %bl,%bl
+ 727:	74 67                	je     790 <printf+0x80>
+ 729:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 72c:	31 d2                	xor    %edx,%edx
+ 72e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 731:	eb 34                	jmp    767 <printf+0x57>
+ 733:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 737:	90                   	nop
+ 738:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 73b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 740:	83 f8 25             	cmp    $0x25,%eax
+ 743:	74 18                	je     75d <printf+0x4d>
+  write(fd, &c, 1);
+ 745:	83 ec 04             	sub    $0x4,%esp
+ 748:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 74b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 74e:	6a 01                	push   $0x1
+ 750:	50                   	push   %eax
+ 751:	57                   	push   %edi
+ 752:	e8 0c fe ff ff       	call   563 <write>
+ 757:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 75a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 75d:	0f b6 1e             	movzbl (%esi),%ebx
+ 760:	83 c6 01             	add    $0x1,%esi
+ 763:	84 db                	test   %bl,%bl
+ 765:	74 29                	je     790 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 767:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 76a:	85 d2                	test   %edx,%edx
+ 76c:	74 ca                	je     738 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 76e:	83 fa 25             	cmp    $0x25,%edx
+ 771:	75 ea                	jne    75d <printf+0x4d>
+      if(c == 'd'){
+ 773:	83 f8 25             	cmp    $0x25,%eax
+ 776:	0f 84 24 01 00 00    	je     8a0 <printf+0x190>
+ 77c:	83 e8 63             	sub    $0x63,%eax
+ 77f:	83 f8 15             	cmp    $0x15,%eax
+ 782:	77 1c                	ja     7a0 <printf+0x90>
+ 784:	ff 24 85 54 0b 00 00 	jmp    *0xb54(,%eax,4)
+ 78b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 78f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 790:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 793:	5b                   	pop    %ebx
+ 794:	5e                   	pop    %esi
+ 795:	5f                   	pop    %edi
+ 796:	5d                   	pop    %ebp
+ 797:	c3                   	ret
+ 798:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 79f:	90                   	nop
+  write(fd, &c, 1);
+ 7a0:	83 ec 04             	sub    $0x4,%esp
+ 7a3:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 7a6:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 7aa:	6a 01                	push   $0x1
+ 7ac:	52                   	push   %edx
+ 7ad:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 7b0:	57                   	push   %edi
+ 7b1:	e8 ad fd ff ff       	call   563 <write>
+ 7b6:	83 c4 0c             	add    $0xc,%esp
+ 7b9:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 7bc:	6a 01                	push   $0x1
+ 7be:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 7c1:	52                   	push   %edx
+ 7c2:	57                   	push   %edi
+ 7c3:	e8 9b fd ff ff       	call   563 <write>
+        putc(fd, c);
+ 7c8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 7cb:	31 d2                	xor    %edx,%edx
+ 7cd:	eb 8e                	jmp    75d <printf+0x4d>
+ 7cf:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 7d0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 7d3:	83 ec 0c             	sub    $0xc,%esp
+ 7d6:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 7db:	8b 13                	mov    (%ebx),%edx
+ 7dd:	6a 00                	push   $0x0
+ 7df:	89 f8                	mov    %edi,%eax
+        ap++;
+ 7e1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 7e4:	e8 87 fe ff ff       	call   670 <printint>
+        ap++;
+ 7e9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 7ec:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 7ef:	31 d2                	xor    %edx,%edx
+ 7f1:	e9 67 ff ff ff       	jmp    75d <printf+0x4d>
+ 7f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7fd:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 800:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 803:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 805:	83 c0 04             	add    $0x4,%eax
+ 808:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 80b:	85 db                	test   %ebx,%ebx
+ 80d:	0f 84 9d 00 00 00    	je     8b0 <printf+0x1a0>
+        while(*s != 0){
+ 813:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 816:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 818:	84 c0                	test   %al,%al
+ 81a:	0f 84 3d ff ff ff    	je     75d <printf+0x4d>
+ 820:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 823:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 826:	89 de                	mov    %ebx,%esi
+ 828:	89 d3                	mov    %edx,%ebx
+ 82a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 830:	83 ec 04             	sub    $0x4,%esp
+ 833:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 836:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 839:	6a 01                	push   $0x1
+ 83b:	53                   	push   %ebx
+ 83c:	57                   	push   %edi
+ 83d:	e8 21 fd ff ff       	call   563 <write>
+        while(*s != 0){
+ 842:	0f b6 06             	movzbl (%esi),%eax
+ 845:	83 c4 10             	add    $0x10,%esp
+ 848:	84 c0                	test   %al,%al
+ 84a:	75 e4                	jne    830 <printf+0x120>
+      state = 0;
+ 84c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 84f:	31 d2                	xor    %edx,%edx
+ 851:	e9 07 ff ff ff       	jmp    75d <printf+0x4d>
+ 856:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 85d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 860:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 863:	83 ec 0c             	sub    $0xc,%esp
+ 866:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 86b:	8b 13                	mov    (%ebx),%edx
+ 86d:	6a 01                	push   $0x1
+ 86f:	e9 6b ff ff ff       	jmp    7df <printf+0xcf>
+ 874:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 878:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 87b:	83 ec 04             	sub    $0x4,%esp
+ 87e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 881:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 883:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 886:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 889:	6a 01                	push   $0x1
+ 88b:	52                   	push   %edx
+ 88c:	57                   	push   %edi
+ 88d:	e8 d1 fc ff ff       	call   563 <write>
+        ap++;
+ 892:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 895:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 898:	31 d2                	xor    %edx,%edx
+ 89a:	e9 be fe ff ff       	jmp    75d <printf+0x4d>
+ 89f:	90                   	nop
+  write(fd, &c, 1);
+ 8a0:	83 ec 04             	sub    $0x4,%esp
+ 8a3:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 8a6:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 8a9:	6a 01                	push   $0x1
+ 8ab:	e9 11 ff ff ff       	jmp    7c1 <printf+0xb1>
+ 8b0:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 8b5:	bb 4d 0b 00 00       	mov    $0xb4d,%ebx
+ 8ba:	e9 61 ff ff ff       	jmp    820 <printf+0x110>
+ 8bf:	90                   	nop
+
+000008c0 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 8c0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 8c1:	a1 44 13 00 00       	mov    0x1344,%eax
+{
+ 8c6:	89 e5                	mov    %esp,%ebp
+ 8c8:	57                   	push   %edi
+ 8c9:	56                   	push   %esi
+ 8ca:	53                   	push   %ebx
+ 8cb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ 8ce:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 8d1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8d8:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 8da:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 8dc:	39 ca                	cmp    %ecx,%edx
+ 8de:	73 30                	jae    910 <free+0x50>
+ 8e0:	39 c1                	cmp    %eax,%ecx
+ 8e2:	72 04                	jb     8e8 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 8e4:	39 c2                	cmp    %eax,%edx
+ 8e6:	72 f0                	jb     8d8 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 8e8:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 8eb:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 8ee:	39 f8                	cmp    %edi,%eax
+ 8f0:	74 2e                	je     920 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 8f2:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 8f5:	8b 42 04             	mov    0x4(%edx),%eax
+ 8f8:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 8fb:	39 f1                	cmp    %esi,%ecx
+ 8fd:	74 38                	je     937 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 8ff:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 901:	5b                   	pop    %ebx
+  freep = p;
+ 902:	89 15 44 13 00 00    	mov    %edx,0x1344
+}
+ 908:	5e                   	pop    %esi
+ 909:	5f                   	pop    %edi
+ 90a:	5d                   	pop    %ebp
+ 90b:	c3                   	ret
+ 90c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 910:	39 c1                	cmp    %eax,%ecx
+ 912:	72 d0                	jb     8e4 <free+0x24>
+ 914:	eb c2                	jmp    8d8 <free+0x18>
+ 916:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 91d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ 920:	03 70 04             	add    0x4(%eax),%esi
+ 923:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 926:	8b 02                	mov    (%edx),%eax
+ 928:	8b 00                	mov    (%eax),%eax
+ 92a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 92d:	8b 42 04             	mov    0x4(%edx),%eax
+ 930:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 933:	39 f1                	cmp    %esi,%ecx
+ 935:	75 c8                	jne    8ff <free+0x3f>
+    p->s.size += bp->s.size;
+ 937:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ 93a:	89 15 44 13 00 00    	mov    %edx,0x1344
+    p->s.size += bp->s.size;
+ 940:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 943:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 946:	89 0a                	mov    %ecx,(%edx)
+}
+ 948:	5b                   	pop    %ebx
+ 949:	5e                   	pop    %esi
+ 94a:	5f                   	pop    %edi
+ 94b:	5d                   	pop    %ebp
+ 94c:	c3                   	ret
+ 94d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000950 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 950:	55                   	push   %ebp
+ 951:	89 e5                	mov    %esp,%ebp
+ 953:	57                   	push   %edi
+ 954:	56                   	push   %esi
+ 955:	53                   	push   %ebx
+ 956:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 959:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ 95c:	8b 15 44 13 00 00    	mov    0x1344,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 962:	8d 78 07             	lea    0x7(%eax),%edi
+ 965:	c1 ef 03             	shr    $0x3,%edi
+ 968:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ 96b:	85 d2                	test   %edx,%edx
+ 96d:	0f 84 8d 00 00 00    	je     a00 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 973:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 975:	8b 48 04             	mov    0x4(%eax),%ecx
+ 978:	39 f9                	cmp    %edi,%ecx
+ 97a:	73 64                	jae    9e0 <malloc+0x90>
+  if(nu < 4096)
+ 97c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 981:	39 df                	cmp    %ebx,%edi
+ 983:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 986:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ 98d:	eb 0a                	jmp    999 <malloc+0x49>
+ 98f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 990:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 992:	8b 48 04             	mov    0x4(%eax),%ecx
+ 995:	39 f9                	cmp    %edi,%ecx
+ 997:	73 47                	jae    9e0 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ 999:	89 c2                	mov    %eax,%edx
+ 99b:	39 05 44 13 00 00    	cmp    %eax,0x1344
+ 9a1:	75 ed                	jne    990 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ 9a3:	83 ec 0c             	sub    $0xc,%esp
+ 9a6:	56                   	push   %esi
+ 9a7:	e8 1f fc ff ff       	call   5cb <sbrk>
+  if(p == (char*)-1)
+ 9ac:	83 c4 10             	add    $0x10,%esp
+ 9af:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 9b2:	74 1c                	je     9d0 <malloc+0x80>
+  hp->s.size = nu;
+ 9b4:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ 9b7:	83 ec 0c             	sub    $0xc,%esp
+ 9ba:	83 c0 08             	add    $0x8,%eax
+ 9bd:	50                   	push   %eax
+ 9be:	e8 fd fe ff ff       	call   8c0 <free>
+  return freep;
+ 9c3:	8b 15 44 13 00 00    	mov    0x1344,%edx
+      if((p = morecore(nunits)) == 0)
+ 9c9:	83 c4 10             	add    $0x10,%esp
+ 9cc:	85 d2                	test   %edx,%edx
+ 9ce:	75 c0                	jne    990 <malloc+0x40>
+        return 0;
+  }
+}
+ 9d0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ 9d3:	31 c0                	xor    %eax,%eax
+}
+ 9d5:	5b                   	pop    %ebx
+ 9d6:	5e                   	pop    %esi
+ 9d7:	5f                   	pop    %edi
+ 9d8:	5d                   	pop    %ebp
+ 9d9:	c3                   	ret
+ 9da:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ 9e0:	39 cf                	cmp    %ecx,%edi
+ 9e2:	74 4c                	je     a30 <malloc+0xe0>
+        p->s.size -= nunits;
+ 9e4:	29 f9                	sub    %edi,%ecx
+ 9e6:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ 9e9:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ 9ec:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ 9ef:	89 15 44 13 00 00    	mov    %edx,0x1344
+}
+ 9f5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ 9f8:	83 c0 08             	add    $0x8,%eax
+}
+ 9fb:	5b                   	pop    %ebx
+ 9fc:	5e                   	pop    %esi
+ 9fd:	5f                   	pop    %edi
+ 9fe:	5d                   	pop    %ebp
+ 9ff:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ a00:	c7 05 44 13 00 00 48 	movl   $0x1348,0x1344
+ a07:	13 00 00 
+    base.s.size = 0;
+ a0a:	b8 48 13 00 00       	mov    $0x1348,%eax
+    base.s.ptr = freep = prevp = &base;
+ a0f:	c7 05 48 13 00 00 48 	movl   $0x1348,0x1348
+ a16:	13 00 00 
+    base.s.size = 0;
+ a19:	c7 05 4c 13 00 00 00 	movl   $0x0,0x134c
+ a20:	00 00 00 
+    if(p->s.size >= nunits){
+ a23:	e9 54 ff ff ff       	jmp    97c <malloc+0x2c>
+ a28:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a2f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ a30:	8b 08                	mov    (%eax),%ecx
+ a32:	89 0a                	mov    %ecx,(%edx)
+ a34:	eb b9                	jmp    9ef <malloc+0x9f>
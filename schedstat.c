@@ -0,0 +1,82 @@
+// Print per-queue scheduler statistics as deltas over an interval.
+// usage: schedstat [ticks [count]]
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "param.h"
+#include "sched.h"
+
+char *classnames[NSCHEDCLASS] = {
+[SCHED_RR]      "rr",
+[SCHED_LOTTERY] "lottery",
+[SCHED_HRRN]    "hrrn",
+[SCHED_SRPF]    "srpf",
+[SCHED_STRIDE]  "stride",
+};
+
+struct schedstat prev, cur;
+
+// One queue's line: the change from a to b.
+void
+row(char *class, struct queuestat *a, struct queuestat *b)
+{
+  uint samples, avglen;
+  int j;
+
+  samples = cur.samples - prev.samples;
+  avglen = samples ? (b->lensum - a->lensum) * 10 / samples : 0;
+  printf(1, "%s  %d  %d  %d  %d  %d.%d  %d  ",
+         class, b->dispatches - a->dispatches,
+         b->runticks - a->runticks, b->preemptions - a->preemptions,
+         b->yields - a->yields, avglen / 10, avglen % 10, b->lenmax);
+  for(j = 0; j < NLATBUCKET; j++)
+    printf(1, "%s%d", j ? "/" : "", b->latency[j] - a->latency[j]);
+  printf(1, "\n");
+}
+
+void
+report(void)
+{
+  int i, j;
+
+  printf(1, "over %d ticks:\n", cur.ticks - prev.ticks);
+  printf(1, "queue class    disp  ticks  preempt  yield  avglen  maxlen  wait 0/1/2-3/4-7/8-15/16-31/32-63/64+\n");
+  printf(1, "rt    ");
+  row("edf", &prev.rt, &cur.rt);
+  for(i = 1; i <= cur.nqueue + 1; i++){
+    j = i <= cur.nqueue ? i : 0;  // fallback queue last
+    if(j == 0)
+      printf(1, "fb    ");
+    else
+      printf(1, "%d     ", j);
+    row(classnames[cur.cls[j]], &prev.q[j], &cur.q[j]);
+  }
+}
+
+int
+main(int argc, char *argv[])
+{
+  int interval = 100, count = 1;
+
+  if(argc > 1)
+    interval = atoi(argv[1]);
+  if(argc > 2)
+    count = atoi(argv[2]);
+  if(interval < 1 || count < 1){
+    printf(2, "usage: schedstat [ticks [count]]\n");
+    exit();
+  }
+
+  if(getSchedStat(&prev) < 0){
+    printf(2, "schedstat: getSchedStat failed\n");
+    exit();
+  }
+  while(count-- > 0){
+    sleep(interval);
+    getSchedStat(&cur);
+    report();
+    prev = cur;
+  }
+  exit();
+}
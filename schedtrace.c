@@ -0,0 +1,54 @@
+// Record scheduler trace events into a file for traceanalyze.
+// usage: schedtrace file [ticks]
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "fcntl.h"
+#include "param.h"
+#include "sched.h"
+
+#define NEV 64
+
+struct schedevent buf[NEV];
+
+int
+main(int argc, char *argv[])
+{
+  int fd, n, ticks, total;
+  uint end;
+
+  if(argc < 2){
+    printf(2, "usage: schedtrace file [ticks]\n");
+    exit();
+  }
+  ticks = argc > 2 ? atoi(argv[2]) : 100;
+
+  fd = open(argv[1], O_CREATE | O_WRONLY);
+  if(fd < 0){
+    printf(2, "schedtrace: cannot open %s\n", argv[1]);
+    exit();
+  }
+
+  // Throw away what was buffered before we started.
+  while(schedTrace(buf, NEV) > 0)
+    ;
+
+  total = 0;
+  end = uptime() + ticks;
+  while(uptime() < end){
+    sleep(1);
+    while((n = schedTrace(buf, NEV)) > 0){
+      if(write(fd, buf, n*sizeof(buf[0])) != n*sizeof(buf[0])){
+        printf(2, "schedtrace: %s is full\n", argv[1]);
+        goto done;
+      }
+      total += n;
+    }
+  }
+
+done:
+  close(fd);
+  printf(1, "schedtrace: %d events in %s\n", total, argv[1]);
+  exit();
+}
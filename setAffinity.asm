@@ -0,0 +1,1403 @@
+
+_setAffinity:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  return mask;
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	51                   	push   %ecx
+  11:	83 ec 08             	sub    $0x8,%esp
+  14:	8b 19                	mov    (%ecx),%ebx
+  16:	8b 79 04             	mov    0x4(%ecx),%edi
+  int pid, mask, cpu;
+
+  if(argc != 2 && argc != 3){
+  19:	8d 43 fe             	lea    -0x2(%ebx),%eax
+  1c:	83 f8 01             	cmp    $0x1,%eax
+  1f:	76 13                	jbe    34 <main+0x34>
+    printf(1, "setAffinity: usage: setAffinity pid [cpu,cpu,...]\n");
+  21:	53                   	push   %ebx
+  22:	53                   	push   %ebx
+  23:	68 e8 08 00 00       	push   $0x8e8
+  28:	6a 01                	push   $0x1
+  2a:	e8 91 05 00 00       	call   5c0 <printf>
+    exit();
+  2f:	e8 bf 03 00 00       	call   3f3 <exit>
+  }
+  pid = atoi(argv[1]);
+  34:	83 ec 0c             	sub    $0xc,%esp
+  37:	ff 77 04             	push   0x4(%edi)
+  3a:	e8 41 03 00 00       	call   380 <atoi>
+
+  if(argc == 3 && (mask = cpulist(argv[2])) == 0){
+  3f:	83 c4 10             	add    $0x10,%esp
+  pid = atoi(argv[1]);
+  42:	89 c6                	mov    %eax,%esi
+  if(argc == 3 && (mask = cpulist(argv[2])) == 0){
+  44:	83 fb 03             	cmp    $0x3,%ebx
+  47:	74 74                	je     bd <main+0xbd>
+  }
+  if(argc == 3 && setAffinity(pid, mask) < 0){
+    printf(1, "setAffinity: cannot bind %d to cpus %s\n", pid, argv[2]);
+    exit();
+  }
+  if((mask = getAffinity(pid)) < 0){
+  49:	83 ec 0c             	sub    $0xc,%esp
+  4c:	56                   	push   %esi
+  4d:	e8 a9 04 00 00       	call   4fb <getAffinity>
+  52:	83 c4 10             	add    $0x10,%esp
+  55:	89 c3                	mov    %eax,%ebx
+  57:	85 c0                	test   %eax,%eax
+  59:	78 3c                	js     97 <main+0x97>
+    printf(1, "setAffinity: no process %d\n", pid);
+    exit();
+  }
+  printf(1, "%d: cpus", pid);
+  5b:	51                   	push   %ecx
+  5c:	56                   	push   %esi
+  5d:	68 7e 09 00 00       	push   $0x97e
+  62:	6a 01                	push   $0x1
+  64:	e8 57 05 00 00       	call   5c0 <printf>
+  for(cpu = 0; mask; cpu++, mask >>= 1)
+  69:	83 c4 10             	add    $0x10,%esp
+  6c:	85 db                	test   %ebx,%ebx
+  6e:	74 3a                	je     aa <main+0xaa>
+  70:	31 f6                	xor    %esi,%esi
+  72:	eb 0b                	jmp    7f <main+0x7f>
+  74:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  78:	83 c6 01             	add    $0x1,%esi
+  7b:	d1 fb                	sar    %ebx
+  7d:	74 2b                	je     aa <main+0xaa>
+    if(mask & 1)
+  7f:	f6 c3 01             	test   $0x1,%bl
+  82:	74 f4                	je     78 <main+0x78>
+      printf(1, " %d", cpu);
+  84:	52                   	push   %edx
+  85:	56                   	push   %esi
+  86:	68 87 09 00 00       	push   $0x987
+  8b:	6a 01                	push   $0x1
+  8d:	e8 2e 05 00 00       	call   5c0 <printf>
+  92:	83 c4 10             	add    $0x10,%esp
+  95:	eb e1                	jmp    78 <main+0x78>
+    printf(1, "setAffinity: no process %d\n", pid);
+  97:	53                   	push   %ebx
+  98:	56                   	push   %esi
+  99:	68 62 09 00 00       	push   $0x962
+  9e:	6a 01                	push   $0x1
+  a0:	e8 1b 05 00 00       	call   5c0 <printf>
+    exit();
+  a5:	e8 49 03 00 00       	call   3f3 <exit>
+  printf(1, "\n");
+  aa:	50                   	push   %eax
+  ab:	50                   	push   %eax
+  ac:	68 7c 09 00 00       	push   $0x97c
+  b1:	6a 01                	push   $0x1
+  b3:	e8 08 05 00 00       	call   5c0 <printf>
+  exit();
+  b8:	e8 36 03 00 00       	call   3f3 <exit>
+  if(argc == 3 && (mask = cpulist(argv[2])) == 0){
+  bd:	83 ec 0c             	sub    $0xc,%esp
+  c0:	ff 77 08             	push   0x8(%edi)
+  c3:	e8 48 00 00 00       	call   110 <cpulist>
+  c8:	83 c4 10             	add    $0x10,%esp
+  cb:	85 c0                	test   %eax,%eax
+  cd:	75 15                	jne    e4 <main+0xe4>
+    printf(1, "setAffinity: bad cpu list %s\n", argv[2]);
+  cf:	51                   	push   %ecx
+  d0:	ff 77 08             	push   0x8(%edi)
+  d3:	68 44 09 00 00       	push   $0x944
+  d8:	6a 01                	push   $0x1
+  da:	e8 e1 04 00 00       	call   5c0 <printf>
+    exit();
+  df:	e8 0f 03 00 00       	call   3f3 <exit>
+  if(argc == 3 && setAffinity(pid, mask) < 0){
+  e4:	52                   	push   %edx
+  e5:	52                   	push   %edx
+  e6:	50                   	push   %eax
+  e7:	56                   	push   %esi
+  e8:	e8 06 04 00 00       	call   4f3 <setAffinity>
+  ed:	83 c4 10             	add    $0x10,%esp
+  f0:	85 c0                	test   %eax,%eax
+  f2:	0f 89 51 ff ff ff    	jns    49 <main+0x49>
+    printf(1, "setAffinity: cannot bind %d to cpus %s\n", pid, argv[2]);
+  f8:	ff 77 08             	push   0x8(%edi)
+  fb:	56                   	push   %esi
+  fc:	68 1c 09 00 00       	push   $0x91c
+ 101:	6a 01                	push   $0x1
+ 103:	e8 b8 04 00 00       	call   5c0 <printf>
+    exit();
+ 108:	e8 e6 02 00 00       	call   3f3 <exit>
+ 10d:	66 90                	xchg   %ax,%ax
+ 10f:	90                   	nop
+
+00000110 <cpulist>:
+{
+ 110:	55                   	push   %ebp
+ 111:	89 e5                	mov    %esp,%ebp
+ 113:	57                   	push   %edi
+ 114:	56                   	push   %esi
+ 115:	53                   	push   %ebx
+ 116:	83 ec 0c             	sub    $0xc,%esp
+ 119:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  while(*s){
+ 11c:	0f b6 03             	movzbl (%ebx),%eax
+ 11f:	84 c0                	test   %al,%al
+ 121:	74 72                	je     195 <cpulist+0x85>
+  uint mask = 0;
+ 123:	31 f6                	xor    %esi,%esi
+    mask |= 1 << cpu;
+ 125:	bf 01 00 00 00       	mov    $0x1,%edi
+ 12a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(*s < '0' || *s > '9' || (cpu = atoi(s)) >= NCPU)
+ 130:	83 e8 30             	sub    $0x30,%eax
+ 133:	3c 09                	cmp    $0x9,%al
+ 135:	77 5e                	ja     195 <cpulist+0x85>
+ 137:	83 ec 0c             	sub    $0xc,%esp
+ 13a:	53                   	push   %ebx
+ 13b:	e8 40 02 00 00       	call   380 <atoi>
+ 140:	83 c4 10             	add    $0x10,%esp
+ 143:	83 f8 07             	cmp    $0x7,%eax
+ 146:	7f 4d                	jg     195 <cpulist+0x85>
+    mask |= 1 << cpu;
+ 148:	89 c1                	mov    %eax,%ecx
+ 14a:	89 fa                	mov    %edi,%edx
+    while(*s >= '0' && *s <= '9')
+ 14c:	0f b6 03             	movzbl (%ebx),%eax
+    mask |= 1 << cpu;
+ 14f:	d3 e2                	shl    %cl,%edx
+ 151:	09 d6                	or     %edx,%esi
+    while(*s >= '0' && *s <= '9')
+ 153:	8d 50 d0             	lea    -0x30(%eax),%edx
+ 156:	80 fa 09             	cmp    $0x9,%dl
+ 159:	77 14                	ja     16f <cpulist+0x5f>
+ 15b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 15f:	90                   	nop
+ 160:	0f b6 43 01          	movzbl 0x1(%ebx),%eax
+      s++;
+ 164:	83 c3 01             	add    $0x1,%ebx
+    while(*s >= '0' && *s <= '9')
+ 167:	8d 50 d0             	lea    -0x30(%eax),%edx
+ 16a:	80 fa 09             	cmp    $0x9,%dl
+ 16d:	76 f1                	jbe    160 <cpulist+0x50>
+    if(*s == ',')
+ 16f:	3c 2c                	cmp    $0x2c,%al
+ 171:	74 1d                	je     190 <cpulist+0x80>
+    else if(*s)
+ 173:	84 c0                	test   %al,%al
+ 175:	75 1e                	jne    195 <cpulist+0x85>
+  while(*s){
+ 177:	0f b6 03             	movzbl (%ebx),%eax
+ 17a:	84 c0                	test   %al,%al
+ 17c:	75 b2                	jne    130 <cpulist+0x20>
+}
+ 17e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 181:	89 f0                	mov    %esi,%eax
+ 183:	5b                   	pop    %ebx
+ 184:	5e                   	pop    %esi
+ 185:	5f                   	pop    %edi
+ 186:	5d                   	pop    %ebp
+ 187:	c3                   	ret
+ 188:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 18f:	90                   	nop
+      s++;
+ 190:	83 c3 01             	add    $0x1,%ebx
+ 193:	eb e2                	jmp    177 <cpulist+0x67>
+}
+ 195:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  uint mask = 0;
+ 198:	31 f6                	xor    %esi,%esi
+}
+ 19a:	5b                   	pop    %ebx
+ 19b:	89 f0                	mov    %esi,%eax
+ 19d:	5e                   	pop    %esi
+ 19e:	5f                   	pop    %edi
+ 19f:	5d                   	pop    %ebp
+ 1a0:	c3                   	ret
+ 1a1:	66 90                	xchg   %ax,%ax
+ 1a3:	66 90                	xchg   %ax,%ax
+ 1a5:	66 90                	xchg   %ax,%ax
+ 1a7:	66 90                	xchg   %ax,%ax
+ 1a9:	66 90                	xchg   %ax,%ax
+ 1ab:	66 90                	xchg   %ax,%ax
+ 1ad:	66 90                	xchg   %ax,%ax
+ 1af:	90                   	nop
+
+000001b0 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 1b0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 1b1:	31 c0                	xor    %eax,%eax
+{
+ 1b3:	89 e5                	mov    %esp,%ebp
+ 1b5:	53                   	push   %ebx
+ 1b6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 1b9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 1bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 1c0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 1c4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 1c7:	83 c0 01             	add    $0x1,%eax
+ 1ca:	84 d2                	test   %dl,%dl
+ 1cc:	75 f2                	jne    1c0 <strcpy+0x10>
+    ;
+  return os;
+}
+ 1ce:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 1d1:	89 c8                	mov    %ecx,%eax
+ 1d3:	c9                   	leave
+ 1d4:	c3                   	ret
+ 1d5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000001e0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 1e0:	55                   	push   %ebp
+ 1e1:	89 e5                	mov    %esp,%ebp
+ 1e3:	53                   	push   %ebx
+ 1e4:	8b 55 08             	mov    0x8(%ebp),%edx
+ 1e7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 1ea:	0f b6 02             	movzbl (%edx),%eax
+ 1ed:	84 c0                	test   %al,%al
+ 1ef:	75 17                	jne    208 <strcmp+0x28>
+ 1f1:	eb 3a                	jmp    22d <strcmp+0x4d>
+ 1f3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 1f7:	90                   	nop
+ 1f8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 1fc:	83 c2 01             	add    $0x1,%edx
+ 1ff:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 202:	84 c0                	test   %al,%al
+ 204:	74 1a                	je     220 <strcmp+0x40>
+    p++, q++;
+ 206:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 208:	0f b6 19             	movzbl (%ecx),%ebx
+ 20b:	38 c3                	cmp    %al,%bl
+ 20d:	74 e9                	je     1f8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 20f:	29 d8                	sub    %ebx,%eax
+}
+ 211:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 214:	c9                   	leave
+ 215:	c3                   	ret
+ 216:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 21d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 220:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 224:	31 c0                	xor    %eax,%eax
+ 226:	29 d8                	sub    %ebx,%eax
+}
+ 228:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 22b:	c9                   	leave
+ 22c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 22d:	0f b6 19             	movzbl (%ecx),%ebx
+ 230:	31 c0                	xor    %eax,%eax
+ 232:	eb db                	jmp    20f <strcmp+0x2f>
+ 234:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 23b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 23f:	90                   	nop
+
+00000240 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 240:	55                   	push   %ebp
+ 241:	89 e5                	mov    %esp,%ebp
+ 243:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 246:	80 3a 00             	cmpb   $0x0,(%edx)
+ 249:	74 15                	je     260 <strlen+0x20>
+ 24b:	31 c0                	xor    %eax,%eax
+ 24d:	8d 76 00             	lea    0x0(%esi),%esi
+ 250:	83 c0 01             	add    $0x1,%eax
+ 253:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 257:	89 c1                	mov    %eax,%ecx
+ 259:	75 f5                	jne    250 <strlen+0x10>
+    ;
+  return n;
+}
+ 25b:	89 c8                	mov    %ecx,%eax
+ 25d:	5d                   	pop    %ebp
+ 25e:	c3                   	ret
+ 25f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 260:	31 c9                	xor    %ecx,%ecx
+}
+ 262:	5d                   	pop    %ebp
+ 263:	89 c8                	mov    %ecx,%eax
+ 265:	c3                   	ret
+ 266:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 26d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000270 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 270:	55                   	push   %ebp
+ 271:	89 e5                	mov    %esp,%ebp
+ 273:	57                   	push   %edi
+ 274:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 277:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 27a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 27d:	89 d7                	mov    %edx,%edi
+ 27f:	fc                   	cld
+ 280:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 282:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 285:	89 d0                	mov    %edx,%eax
+ 287:	c9                   	leave
+ 288:	c3                   	ret
+ 289:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000290 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 290:	55                   	push   %ebp
+ 291:	89 e5                	mov    %esp,%ebp
+ 293:	8b 45 08             	mov    0x8(%ebp),%eax
+ 296:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 29a:	0f b6 10             	movzbl (%eax),%edx
+ 29d:	84 d2                	test   %dl,%dl
+ 29f:	75 12                	jne    2b3 <strchr+0x23>
+ 2a1:	eb 1d                	jmp    2c0 <strchr+0x30>
+ 2a3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2a7:	90                   	nop
+ 2a8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 2ac:	83 c0 01             	add    $0x1,%eax
+ 2af:	84 d2                	test   %dl,%dl
+ 2b1:	74 0d                	je     2c0 <strchr+0x30>
+    if(*s == c)
+ 2b3:	38 d1                	cmp    %dl,%cl
+ 2b5:	75 f1                	jne    2a8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 2b7:	5d                   	pop    %ebp
+ 2b8:	c3                   	ret
+ 2b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 2c0:	31 c0                	xor    %eax,%eax
+}
+ 2c2:	5d                   	pop    %ebp
+ 2c3:	c3                   	ret
+ 2c4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2cf:	90                   	nop
+
+000002d0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 2d0:	55                   	push   %ebp
+ 2d1:	89 e5                	mov    %esp,%ebp
+ 2d3:	57                   	push   %edi
+ 2d4:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 2d5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 2d8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 2d9:	31 db                	xor    %ebx,%ebx
+{
+ 2db:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 2de:	eb 27                	jmp    307 <gets+0x37>
+    cc = read(0, &c, 1);
+ 2e0:	83 ec 04             	sub    $0x4,%esp
+ 2e3:	6a 01                	push   $0x1
+ 2e5:	56                   	push   %esi
+ 2e6:	6a 00                	push   $0x0
+ 2e8:	e8 1e 01 00 00       	call   40b <read>
+    if(cc < 1)
+ 2ed:	83 c4 10             	add    $0x10,%esp
+ 2f0:	85 c0                	test   %eax,%eax
+ 2f2:	7e 1d                	jle    311 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 2f4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 2f8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 2fb:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 2ff:	3c 0a                	cmp    $0xa,%al
+ 301:	74 10                	je     313 <gets+0x43>
+ 303:	3c 0d                	cmp    $0xd,%al
+ 305:	74 0c                	je     313 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 307:	89 df                	mov    %ebx,%edi
+ 309:	83 c3 01             	add    $0x1,%ebx
+ 30c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 30f:	7c cf                	jl     2e0 <gets+0x10>
+ 311:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 313:	8b 45 08             	mov    0x8(%ebp),%eax
+ 316:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 31a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 31d:	5b                   	pop    %ebx
+ 31e:	5e                   	pop    %esi
+ 31f:	5f                   	pop    %edi
+ 320:	5d                   	pop    %ebp
+ 321:	c3                   	ret
+ 322:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 329:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000330 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 330:	55                   	push   %ebp
+ 331:	89 e5                	mov    %esp,%ebp
+ 333:	56                   	push   %esi
+ 334:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 335:	83 ec 08             	sub    $0x8,%esp
+ 338:	6a 00                	push   $0x0
+ 33a:	ff 75 08             	push   0x8(%ebp)
+ 33d:	e8 f1 00 00 00       	call   433 <open>
+  if(fd < 0)
+ 342:	83 c4 10             	add    $0x10,%esp
+ 345:	85 c0                	test   %eax,%eax
+ 347:	78 27                	js     370 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 349:	83 ec 08             	sub    $0x8,%esp
+ 34c:	ff 75 0c             	push   0xc(%ebp)
+ 34f:	89 c3                	mov    %eax,%ebx
+ 351:	50                   	push   %eax
+ 352:	e8 f4 00 00 00       	call   44b <fstat>
+  close(fd);
+ 357:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 35a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 35c:	e8 ba 00 00 00       	call   41b <close>
+  return r;
+ 361:	83 c4 10             	add    $0x10,%esp
+}
+ 364:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 367:	89 f0                	mov    %esi,%eax
+ 369:	5b                   	pop    %ebx
+ 36a:	5e                   	pop    %esi
+ 36b:	5d                   	pop    %ebp
+ 36c:	c3                   	ret
+ 36d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 370:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 375:	eb ed                	jmp    364 <stat+0x34>
+ 377:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 37e:	66 90                	xchg   %ax,%ax
+
+00000380 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 380:	55                   	push   %ebp
+ 381:	89 e5                	mov    %esp,%ebp
+ 383:	53                   	push   %ebx
+ 384:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 387:	0f be 02             	movsbl (%edx),%eax
+ 38a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 38d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 390:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 395:	77 1e                	ja     3b5 <atoi+0x35>
+ 397:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 39e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 3a0:	83 c2 01             	add    $0x1,%edx
+ 3a3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 3a6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 3aa:	0f be 02             	movsbl (%edx),%eax
+ 3ad:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 3b0:	80 fb 09             	cmp    $0x9,%bl
+ 3b3:	76 eb                	jbe    3a0 <atoi+0x20>
+  return n;
+}
+ 3b5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 3b8:	89 c8                	mov    %ecx,%eax
+ 3ba:	c9                   	leave
+ 3bb:	c3                   	ret
+ 3bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000003c0 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 3c0:	55                   	push   %ebp
+ 3c1:	89 e5                	mov    %esp,%ebp
+ 3c3:	57                   	push   %edi
+ 3c4:	56                   	push   %esi
+ 3c5:	8b 45 10             	mov    0x10(%ebp),%eax
+ 3c8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 3cb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 3ce:	85 c0                	test   %eax,%eax
+ 3d0:	7e 13                	jle    3e5 <memmove+0x25>
+ 3d2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 3d4:	89 d7                	mov    %edx,%edi
+ 3d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3dd:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 3e0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 3e1:	39 f8                	cmp    %edi,%eax
+ 3e3:	75 fb                	jne    3e0 <memmove+0x20>
+  return vdst;
+}
+ 3e5:	5e                   	pop    %esi
+ 3e6:	89 d0                	mov    %edx,%eax
+ 3e8:	5f                   	pop    %edi
+ 3e9:	5d                   	pop    %ebp
+ 3ea:	c3                   	ret
+
+000003eb <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 3eb:	b8 01 00 00 00       	mov    $0x1,%eax
+ 3f0:	cd 40                	int    $0x40
+ 3f2:	c3                   	ret
+
+000003f3 <exit>:
+SYSCALL(exit)
+ 3f3:	b8 02 00 00 00       	mov    $0x2,%eax
+ 3f8:	cd 40                	int    $0x40
+ 3fa:	c3                   	ret
+
+000003fb <wait>:
+SYSCALL(wait)
+ 3fb:	b8 03 00 00 00       	mov    $0x3,%eax
+ 400:	cd 40                	int    $0x40
+ 402:	c3                   	ret
+
+00000403 <pipe>:
+SYSCALL(pipe)
+ 403:	b8 04 00 00 00       	mov    $0x4,%eax
+ 408:	cd 40                	int    $0x40
+ 40a:	c3                   	ret
+
+0000040b <read>:
+SYSCALL(read)
+ 40b:	b8 05 00 00 00       	mov    $0x5,%eax
+ 410:	cd 40                	int    $0x40
+ 412:	c3                   	ret
+
+00000413 <write>:
+SYSCALL(write)
+ 413:	b8 10 00 00 00       	mov    $0x10,%eax
+ 418:	cd 40                	int    $0x40
+ 41a:	c3                   	ret
+
+0000041b <close>:
+SYSCALL(close)
+ 41b:	b8 15 00 00 00       	mov    $0x15,%eax
+ 420:	cd 40                	int    $0x40
+ 422:	c3                   	ret
+
+00000423 <kill>:
+SYSCALL(kill)
+ 423:	b8 06 00 00 00       	mov    $0x6,%eax
+ 428:	cd 40                	int    $0x40
+ 42a:	c3                   	ret
+
+0000042b <exec>:
+SYSCALL(exec)
+ 42b:	b8 07 00 00 00       	mov    $0x7,%eax
+ 430:	cd 40                	int    $0x40
+ 432:	c3                   	ret
+
+00000433 <open>:
+SYSCALL(open)
+ 433:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 438:	cd 40                	int    $0x40
+ 43a:	c3                   	ret
+
+0000043b <mknod>:
+SYSCALL(mknod)
+ 43b:	b8 11 00 00 00       	mov    $0x11,%eax
+ 440:	cd 40                	int    $0x40
+ 442:	c3                   	ret
+
+00000443 <unlink>:
+SYSCALL(unlink)
+ 443:	b8 12 00 00 00       	mov    $0x12,%eax
+ 448:	cd 40                	int    $0x40
+ 44a:	c3                   	ret
+
+0000044b <fstat>:
+SYSCALL(fstat)
+ 44b:	b8 08 00 00 00       	mov    $0x8,%eax
+ 450:	cd 40                	int    $0x40
+ 452:	c3                   	ret
+
+00000453 <link>:
+SYSCALL(link)
+ 453:	b8 13 00 00 00       	mov    $0x13,%eax
+ 458:	cd 40                	int    $0x40
+ 45a:	c3                   	ret
+
+0000045b <mkdir>:
+SYSCALL(mkdir)
+ 45b:	b8 14 00 00 00       	mov    $0x14,%eax
+ 460:	cd 40                	int    $0x40
+ 462:	c3                   	ret
+
+00000463 <chdir>:
+SYSCALL(chdir)
+ 463:	b8 09 00 00 00       	mov    $0x9,%eax
+ 468:	cd 40                	int    $0x40
+ 46a:	c3                   	ret
+
+0000046b <dup>:
+SYSCALL(dup)
+ 46b:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 470:	cd 40                	int    $0x40
+ 472:	c3                   	ret
+
+00000473 <getpid>:
+SYSCALL(getpid)
+ 473:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 478:	cd 40                	int    $0x40
+ 47a:	c3                   	ret
+
+0000047b <sbrk>:
+SYSCALL(sbrk)
+ 47b:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 480:	cd 40                	int    $0x40
+ 482:	c3                   	ret
+
+00000483 <sleep>:
+SYSCALL(sleep)
+ 483:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 488:	cd 40                	int    $0x40
+ 48a:	c3                   	ret
+
+0000048b <uptime>:
+SYSCALL(uptime)
+ 48b:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 490:	cd 40                	int    $0x40
+ 492:	c3                   	ret
+
+00000493 <setTicket>:
+SYSCALL(setTicket)
+ 493:	b8 16 00 00 00       	mov    $0x16,%eax
+ 498:	cd 40                	int    $0x40
+ 49a:	c3                   	ret
+
+0000049b <changeQueue>:
+SYSCALL(changeQueue)
+ 49b:	b8 17 00 00 00       	mov    $0x17,%eax
+ 4a0:	cd 40                	int    $0x40
+ 4a2:	c3                   	ret
+
+000004a3 <setLotteryTicket>:
+SYSCALL(setLotteryTicket)
+ 4a3:	b8 18 00 00 00       	mov    $0x18,%eax
+ 4a8:	cd 40                	int    $0x40
+ 4aa:	c3                   	ret
+
+000004ab <setSRPFPriority>:
+SYSCALL(setSRPFPriority)
+ 4ab:	b8 19 00 00 00       	mov    $0x19,%eax
+ 4b0:	cd 40                	int    $0x40
+ 4b2:	c3                   	ret
+
+000004b3 <printInfo>:
+SYSCALL(printInfo)
+ 4b3:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 4b8:	cd 40                	int    $0x40
+ 4ba:	c3                   	ret
+
+000004bb <configQueues>:
+SYSCALL(configQueues)
+ 4bb:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 4c0:	cd 40                	int    $0x40
+ 4c2:	c3                   	ret
+
+000004c3 <setQuantum>:
+SYSCALL(setQuantum)
+ 4c3:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 4c8:	cd 40                	int    $0x40
+ 4ca:	c3                   	ret
+
+000004cb <getSchedStat>:
+SYSCALL(getSchedStat)
+ 4cb:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 4d0:	cd 40                	int    $0x40
+ 4d2:	c3                   	ret
+
+000004d3 <schedTrace>:
+SYSCALL(schedTrace)
+ 4d3:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 4d8:	cd 40                	int    $0x40
+ 4da:	c3                   	ret
+
+000004db <schedSeed>:
+SYSCALL(schedSeed)
+ 4db:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 4e0:	cd 40                	int    $0x40
+ 4e2:	c3                   	ret
+
+000004e3 <setSchedAttr>:
+SYSCALL(setSchedAttr)
+ 4e3:	b8 20 00 00 00       	mov    $0x20,%eax
+ 4e8:	cd 40                	int    $0x40
+ 4ea:	c3                   	ret
+
+000004eb <getSchedAttr>:
+SYSCALL(getSchedAttr)
+ 4eb:	b8 21 00 00 00       	mov    $0x21,%eax
+ 4f0:	cd 40                	int    $0x40
+ 4f2:	c3                   	ret
+
+000004f3 <setAffinity>:
+SYSCALL(setAffinity)
+ 4f3:	b8 22 00 00 00       	mov    $0x22,%eax
+ 4f8:	cd 40                	int    $0x40
+ 4fa:	c3                   	ret
+
+000004fb <getAffinity>:
+SYSCALL(getAffinity)
+ 4fb:	b8 23 00 00 00       	mov    $0x23,%eax
+ 500:	cd 40                	int    $0x40
+ 502:	c3                   	ret
+
+00000503 <gangJoin>:
+SYSCALL(gangJoin)
+ 503:	b8 24 00 00 00       	mov    $0x24,%eax
+ 508:	cd 40                	int    $0x40
+ 50a:	c3                   	ret
+
+0000050b <setRealtime>:
+SYSCALL(setRealtime)
+ 50b:	b8 25 00 00 00       	mov    $0x25,%eax
+ 510:	cd 40                	int    $0x40
+ 512:	c3                   	ret
+ 513:	66 90                	xchg   %ax,%ax
+ 515:	66 90                	xchg   %ax,%ax
+ 517:	66 90                	xchg   %ax,%ax
+ 519:	66 90                	xchg   %ax,%ax
+ 51b:	66 90                	xchg   %ax,%ax
+ 51d:	66 90                	xchg   %ax,%ax
+ 51f:	90                   	nop
+
+00000520 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 520:	55                   	push   %ebp
+ 521:	89 e5                	mov    %esp,%ebp
+ 523:	57                   	push   %edi
+ 524:	56                   	push   %esi
+ 525:	53                   	push   %ebx
+ 526:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 528:	89 d1                	mov    %edx,%ecx
+{
+ 52a:	83 ec 3c             	sub    $0x3c,%esp
+ 52d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 530:	85 d2                	test   %edx,%edx
+ 532:	0f 89 80 00 00 00    	jns    5b8 <printint+0x98>
+ 538:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 53c:	74 7a                	je     5b8 <printint+0x98>
+    x = -xx;
+ 53e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 540:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 545:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 548:	31 f6                	xor    %esi,%esi
+ 54a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 550:	89 c8                	mov    %ecx,%eax
+ 552:	31 d2                	xor    %edx,%edx
+ 554:	89 f7                	mov    %esi,%edi
+ 556:	f7 f3                	div    %ebx
+ 558:	8d 76 01             	lea    0x1(%esi),%esi
+ 55b:	0f b6 92 ec 09 00 00 	movzbl 0x9ec(%edx),%edx
+ 562:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 566:	89 ca                	mov    %ecx,%edx
+ 568:	89 c1                	mov    %eax,%ecx
+ 56a:	39 da                	cmp    %ebx,%edx
+ 56c:	73 e2                	jae    550 <printint+0x30>
+  if(neg)
+ 56e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 571:	85 c0                	test   %eax,%eax
+ 573:	74 07                	je     57c <printint+0x5c>
+    buf[i++] = '-';
+ 575:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 57a:	89 f7                	mov    %esi,%edi
+ 57c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 57f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 582:	01 df                	add    %ebx,%edi
+ 584:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 588:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 58b:	83 ec 04             	sub    $0x4,%esp
+ 58e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 591:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 594:	6a 01                	push   $0x1
+ 596:	50                   	push   %eax
+ 597:	56                   	push   %esi
+ 598:	e8 76 fe ff ff       	call   413 <write>
+  while(--i >= 0)
+ 59d:	89 f8                	mov    %edi,%eax
+ 59f:	83 c4 10             	add    $0x10,%esp
+ 5a2:	83 ef 01             	sub    $0x1,%edi
+ 5a5:	39 d8                	cmp    %ebx,%eax
+ 5a7:	75 df                	jne    588 <printint+0x68>
+}
+ 5a9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 5ac:	5b                   	pop    %ebx
+ 5ad:	5e                   	pop    %esi
+ 5ae:	5f                   	pop    %edi
+ 5af:	5d                   	pop    %ebp
+ 5b0:	c3                   	ret
+ 5b1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 5b8:	31 c0                	xor    %eax,%eax
+ 5ba:	eb 89                	jmp    545 <printint+0x25>
+ 5bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000005c0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 5c0:	55                   	push   %ebp
+ 5c1:	89 e5                	mov    %esp,%ebp
+ 5c3:	57                   	push   %edi
+ 5c4:	56                   	push   %esi
+ 5c5:	53                   	push   %ebx
+ 5c6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 5c9:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 5cc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 5cf:	0f b6 1e             	movzbl (%esi),%ebx
+ 5d2:	83 c6 01             	add    $0x1,%esi
+ 5d5:	84 db                	test   %bl,%bl
+ 5d7:	74 67                	je     640 <printf+0x80>
+ 5d9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 5dc:	31 d2                	xor    %edx,%edx
+ 5de:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 5e1:	eb 34                	jmp    617 <printf+0x57>
+ 5e3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 5e7:	90                   	nop
+ 5e8:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 5eb:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 5f0:	83 f8 25             	cmp    $0x25,%eax
+ 5f3:	74 18                	je     60d <printf+0x4d>
+  write(fd, &c, 1);
+ 5f5:	83 ec 04             	sub    $0x4,%esp
+ 5f8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 5fb:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 5fe:	6a 01                	push   $0x1
+ 600:	50                   	push   %eax
+ 601:	57                   	push   %edi
+ 602:	e8 0c fe ff ff       	call   413 <write>
+ 607:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 60a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 60d:	0f b6 1e             	movzbl (%esi),%ebx
+ 610:	83 c6 01             	add    $0x1,%esi
+ 613:	84 db                	test   %bl,%bl
+ 615:	74 29                	je     640 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 617:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 61a:	85 d2                	test   %edx,%edx
+ 61c:	74 ca                	je     5e8 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 61e:	83 fa 25             	cmp    $0x25,%edx
+ 621:	75 ea                	jne    60d <printf+0x4d>
+      if(c == 'd'){
+ 623:	83 f8 25             	cmp    $0x25,%eax
+ 626:	0f 84 24 01 00 00    	je     750 <printf+0x190>
+ 62c:	83 e8 63             	sub    $0x63,%eax
+ 62f:	83 f8 15             	cmp    $0x15,%eax
+ 632:	77 1c                	ja     650 <printf+0x90>
+ 634:	ff 24 85 94 09 00 00 	jmp    *0x994(,%eax,4)
+ 63b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 63f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 640:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 643:	5b                   	pop    %ebx
+ 644:	5e                   	pop    %esi
+ 645:	5f                   	pop    %edi
+ 646:	5d                   	pop    %ebp
+ 647:	c3                   	ret
+ 648:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 64f:	90                   	nop
+  write(fd, &c, 1);
+ 650:	83 ec 04             	sub    $0x4,%esp
+ 653:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 656:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 65a:	6a 01                	push   $0x1
+ 65c:	52                   	push   %edx
+ 65d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 660:	57                   	push   %edi
+ 661:	e8 ad fd ff ff       	call   413 <write>
+ 666:	83 c4 0c             	add    $0xc,%esp
+ 669:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 66c:	6a 01                	push   $0x1
+ 66e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 671:	52                   	push   %edx
+ 672:	57                   	push   %edi
+ 673:	e8 9b fd ff ff       	call   413 <write>
+        putc(fd, c);
+ 678:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 67b:	31 d2                	xor    %edx,%edx
+ 67d:	eb 8e                	jmp    60d <printf+0x4d>
+ 67f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 680:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 683:	83 ec 0c             	sub    $0xc,%esp
+ 686:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 68b:	8b 13                	mov    (%ebx),%edx
+ 68d:	6a 00                	push   $0x0
+ 68f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 691:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 694:	e8 87 fe ff ff       	call   520 <printint>
+        ap++;
+ 699:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 69c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 69f:	31 d2                	xor    %edx,%edx
+ 6a1:	e9 67 ff ff ff       	jmp    60d <printf+0x4d>
+ 6a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6ad:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 6b0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 6b3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 6b5:	83 c0 04             	add    $0x4,%eax
+ 6b8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 6bb:	85 db                	test   %ebx,%ebx
+ 6bd:	0f 84 9d 00 00 00    	je     760 <printf+0x1a0>
+        while(*s != 0){
+ 6c3:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 6c6:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 6c8:	84 c0                	test   %al,%al
+ 6ca:	0f 84 3d ff ff ff    	je     60d <printf+0x4d>
+ 6d0:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 6d3:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 6d6:	89 de                	mov    %ebx,%esi
+ 6d8:	89 d3                	mov    %edx,%ebx
+ 6da:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 6e0:	83 ec 04             	sub    $0x4,%esp
+ 6e3:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 6e6:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 6e9:	6a 01                	push   $0x1
+ 6eb:	53                   	push   %ebx
+ 6ec:	57                   	push   %edi
+ 6ed:	e8 21 fd ff ff       	call   413 <write>
+        while(*s != 0){
+ 6f2:	0f b6 06             	movzbl (%esi),%eax
+ 6f5:	83 c4 10             	add    $0x10,%esp
+ 6f8:	84 c0                	test   %al,%al
+ 6fa:	75 e4                	jne    6e0 <printf+0x120>
+      state = 0;
+ 6fc:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 6ff:	31 d2                	xor    %edx,%edx
+ 701:	e9 07 ff ff ff       	jmp    60d <printf+0x4d>
+ 706:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 70d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 710:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 713:	83 ec 0c             	sub    $0xc,%esp
+ 716:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 71b:	8b 13                	mov    (%ebx),%edx
+ 71d:	6a 01                	push   $0x1
+ 71f:	e9 6b ff ff ff       	jmp    68f <printf+0xcf>
+ 724:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 728:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 72b:	83 ec 04             	sub    $0x4,%esp
+ 72e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 731:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 733:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 736:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 739:	6a 01                	push   $0x1
+ 73b:	52                   	push   %edx
+ 73c:	57                   	push   %edi
+ 73d:	e8 d1 fc ff ff       	call   413 <write>
+        ap++;
+ 742:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 745:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 748:	31 d2                	xor    %edx,%edx
+ 74a:	e9 be fe ff ff       	jmp    60d <printf+0x4d>
+ 74f:	90                   	nop
+  write(fd, &c, 1);
+ 750:	83 ec 04             	sub    $0x4,%esp
+ 753:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 756:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 759:	6a 01                	push   $0x1
+ 75b:	e9 11 ff ff ff       	jmp    671 <printf+0xb1>
+ 760:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 765:	bb 8b 09 00 00       	mov    $0x98b,%ebx
+ 76a:	e9 61 ff ff ff       	jmp    6d0 <printf+0x110>
+ 76f:	90                   	nop
+
+00000770 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 770:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 771:	a1 d0 0c 00 00       	mov    0xcd0,%eax
+{
+ 776:	89 e5                	mov    %esp,%ebp
+ 778:	57                   	push   %edi
+ 779:	56                   	push   %esi
+ 77a:	53                   	push   %ebx
+ 77b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ 77e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 781:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 788:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 78a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 78c:	39 ca                	cmp    %ecx,%edx
+ 78e:	73 30                	jae    7c0 <free+0x50>
+ 790:	39 c1                	cmp    %eax,%ecx
+ 792:	72 04                	jb     798 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 794:	39 c2                	cmp    %eax,%edx
+ 796:	72 f0                	jb     788 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 798:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 79b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 79e:	39 f8                	cmp    %edi,%eax
+ 7a0:	74 2e                	je     7d0 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 7a2:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 7a5:	8b 42 04             	mov    0x4(%edx),%eax
+ 7a8:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 7ab:	39 f1                	cmp    %esi,%ecx
+ 7ad:	74 38                	je     7e7 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 7af:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 7b1:	5b                   	pop    %ebx
+  freep = p;
+ 7b2:	89 15 d0 0c 00 00    	mov    %edx,0xcd0
+}
+ 7b8:	5e                   	pop    %esi
+ 7b9:	5f                   	pop    %edi
+ 7ba:	5d                   	pop    %ebp
+ 7bb:	c3                   	ret
+ 7bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 7c0:	39 c1                	cmp    %eax,%ecx
+ 7c2:	72 d0                	jb     794 <free+0x24>
+ 7c4:	eb c2                	jmp    788 <free+0x18>
+ 7c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7cd:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ 7d0:	03 70 04             	add    0x4(%eax),%esi
+ 7d3:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 7d6:	8b 02                	mov    (%edx),%eax
+ 7d8:	8b 00                	mov    (%eax),%eax
+ 7da:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 7dd:	8b 42 04             	mov    0x4(%edx),%eax
+ 7e0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 7e3:	39 f1                	cmp    %esi,%ecx
+ 7e5:	75 c8                	jne    7af <free+0x3f>
+    p->s.size += bp->s.size;
+ 7e7:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ 7ea:	89 15 d0 0c 00 00    	mov    %edx,0xcd0
+    p->s.size += bp->s.size;
+ 7f0:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 7f3:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 7f6:	89 0a                	mov    %ecx,(%edx)
+}
+ 7f8:	5b                   	pop    %ebx
+ 7f9:	5e                   	pop    %esi
+ 7fa:	5f                   	pop    %edi
+ 7fb:	5d                   	pop    %ebp
+ 7fc:	c3                   	ret
+ 7fd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000800 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 800:	55                   	push   %ebp
+ 801:	89 e5                	mov    %esp,%ebp
+ 803:	57                   	push   %edi
+ 804:	56                   	push   %esi
+ 805:	53                   	push   %ebx
+ 806:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 809:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ 80c:	8b 15 d0 0c 00 00    	mov    0xcd0,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 812:	8d 78 07             	lea    0x7(%eax),%edi
+ 815:	c1 ef 03             	shr    $0x3,%edi
+ 818:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ 81b:	85 d2                	test   %edx,%edx
+ 81d:	0f 84 8d 00 00 00    	je     8b0 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 823:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 825:	8b 48 04             	mov    0x4(%eax),%ecx
+ 828:	39 f9                	cmp    %edi,%ecx
+ 82a:	73 64                	jae    890 <malloc+0x90>
+  if(nu < 4096)
+ 82c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 831:	39 df                	cmp    %ebx,%edi
+ 833:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 836:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ 83d:	eb 0a                	jmp    849 <malloc+0x49>
+ 83f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 840:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 842:	8b 48 04             	mov    0x4(%eax),%ecx
+ 845:	39 f9                	cmp    %edi,%ecx
+ 847:	73 47                	jae    890 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ 849:	89 c2                	mov    %eax,%edx
+ 84b:	39 05 d0 0c 00 00    	cmp    %eax,0xcd0
+ 851:	75 ed                	jne    840 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ 853:	83 ec 0c             	sub    $0xc,%esp
+ 856:	56                   	push   %esi
+ 857:	e8 1f fc ff ff       	call   47b <sbrk>
+  if(p == (char*)-1)
+ 85c:	83 c4 10             	add    $0x10,%esp
+ 85f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 862:	74 1c                	je     880 <malloc+0x80>
+  hp->s.size = nu;
+ 864:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ 867:	83 ec 0c             	sub    $0xc,%esp
+ 86a:	83 c0 08             	add    $0x8,%eax
+ 86d:	50                   	push   %eax
+ 86e:	e8 fd fe ff ff       	call   770 <free>
+  return freep;
+ 873:	8b 15 d0 0c 00 00    	mov    0xcd0,%edx
+      if((p = morecore(nunits)) == 0)
+ 879:	83 c4 10             	add    $0x10,%esp
+ 87c:	85 d2                	test   %edx,%edx
+ 87e:	75 c0                	jne    840 <malloc+0x40>
+        return 0;
+  }
+}
+ 880:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ 883:	31 c0                	xor    %eax,%eax
+}
+ 885:	5b                   	pop    %ebx
+ 886:	5e                   	pop    %esi
+ 887:	5f                   	pop    %edi
+ 888:	5d                   	pop    %ebp
+ 889:	c3                   	ret
+ 88a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ 890:	39 cf                	cmp    %ecx,%edi
+ 892:	74 4c                	je     8e0 <malloc+0xe0>
+        p->s.size -= nunits;
+ 894:	29 f9                	sub    %edi,%ecx
+ 896:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ 899:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ 89c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ 89f:	89 15 d0 0c 00 00    	mov    %edx,0xcd0
+}
+ 8a5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ 8a8:	83 c0 08             	add    $0x8,%eax
+}
+ 8ab:	5b                   	pop    %ebx
+ 8ac:	5e                   	pop    %esi
+ 8ad:	5f                   	pop    %edi
+ 8ae:	5d                   	pop    %ebp
+ 8af:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ 8b0:	c7 05 d0 0c 00 00 d4 	movl   $0xcd4,0xcd0
+ 8b7:	0c 00 00 
+    base.s.size = 0;
+ 8ba:	b8 d4 0c 00 00       	mov    $0xcd4,%eax
+    base.s.ptr = freep = prevp = &base;
+ 8bf:	c7 05 d4 0c 00 00 d4 	movl   $0xcd4,0xcd4
+ 8c6:	0c 00 00 
+    base.s.size = 0;
+ 8c9:	c7 05 d8 0c 00 00 00 	movl   $0x0,0xcd8
+ 8d0:	00 00 00 
+    if(p->s.size >= nunits){
+ 8d3:	e9 54 ff ff ff       	jmp    82c <malloc+0x2c>
+ 8d8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8df:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ 8e0:	8b 08                	mov    (%eax),%ecx
+ 8e2:	89 0a                	mov    %ecx,(%edx)
+ 8e4:	eb b9                	jmp    89f <malloc+0x9f>
@@ -0,0 +1,57 @@
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "param.h"
+
+// Parse a CPU list such as 0,2,3 into a mask, or 0 if it
+// is malformed or names a CPU outside 0..NCPU-1.
+uint
+cpulist(char *s)
+{
+  uint mask = 0;
+  int cpu;
+
+  while(*s){
+    if(*s < '0' || *s > '9' || (cpu = atoi(s)) >= NCPU)
+      return 0;
+    mask |= 1 << cpu;
+    while(*s >= '0' && *s <= '9')
+      s++;
+    if(*s == ',')
+      s++;
+    else if(*s)
+      return 0;
+  }
+  return mask;
+}
+
+int
+main(int argc, char *argv[])
+{
+  int pid, mask, cpu;
+
+  if(argc != 2 && argc != 3){
+    printf(1, "setAffinity: usage: setAffinity pid [cpu,cpu,...]\n");
+    exit();
+  }
+  pid = atoi(argv[1]);
+
+  if(argc == 3 && (mask = cpulist(argv[2])) == 0){
+    printf(1, "setAffinity: bad cpu list %s\n", argv[2]);
+    exit();
+  }
+  if(argc == 3 && setAffinity(pid, mask) < 0){
+    printf(1, "setAffinity: cannot bind %d to cpus %s\n", pid, argv[2]);
+    exit();
+  }
+  if((mask = getAffinity(pid)) < 0){
+    printf(1, "setAffinity: no process %d\n", pid);
+    exit();
+  }
+  printf(1, "%d: cpus", pid);
+  for(cpu = 0; mask; cpu++, mask >>= 1)
+    if(mask & 1)
+      printf(1, " %d", cpu);
+  printf(1, "\n");
+  exit();
+}
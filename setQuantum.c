@@ -0,0 +1,18 @@
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+
+int
+main(int argc, char *argv[])
+{
+  if(argc != 3){
+    printf(1, "setQuantum: usage: setQuantum queue ticks\n");
+    exit();
+  }
+  int queue = atoi(argv[1]);
+  int ticks = atoi(argv[2]);
+
+  if(setQuantum(queue, ticks) < 0)
+    printf(1, "setQuantum: cannot set queue %d to %d ticks\n", queue, ticks);
+  exit();
+}
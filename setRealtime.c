@@ -0,0 +1,37 @@
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "param.h"
+
+int
+main(int argc, char *argv[])
+{
+  int pid, runtime, period, deadline, cpu;
+
+  if(argc < 3 || argc > 5 || (argc == 3 && atoi(argv[2]) != 0)){
+    printf(1, "setRealtime: usage: setRealtime pid runtime period [deadline]\n");
+    printf(1, "             setRealtime pid 0\n");
+    exit();
+  }
+  pid = atoi(argv[1]);
+  runtime = atoi(argv[2]);
+  period = argc > 3 ? atoi(argv[3]) : 0;
+  deadline = argc > 4 ? atoi(argv[4]) : period;
+  if(runtime < 0 || (runtime > 0 && (deadline < runtime || period < deadline))){
+    printf(1, "setRealtime: need runtime <= deadline <= period\n");
+    exit();
+  }
+
+  if((cpu = setRealtime(pid, runtime, period, deadline)) < 0){
+    if(runtime == 0)
+      printf(1, "setRealtime: no process %d\n", pid);
+    else
+      printf(1, "setRealtime: cannot admit %d: no such process, or %d/%d "
+             "would take every CPU it may use past %d/1000 real-time\n",
+             pid, runtime, deadline, RTLIMIT);
+    exit();
+  }
+  if(runtime > 0)
+    printf(1, "%d: %d/%d/%d on cpu %d\n", pid, runtime, period, deadline, cpu);
+  exit();
+}
@@ -0,0 +1,2761 @@
+
+_sh:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  return 0;
+}
+
+int
+main(void)
+{
+       0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+       4:	83 e4 f0             	and    $0xfffffff0,%esp
+       7:	ff 71 fc             	push   -0x4(%ecx)
+       a:	55                   	push   %ebp
+       b:	89 e5                	mov    %esp,%ebp
+       d:	51                   	push   %ecx
+       e:	83 ec 10             	sub    $0x10,%esp
+  static char buf[100];
+  int fd;
+  setTicket(1000);
+      11:	68 e8 03 00 00       	push   $0x3e8
+      16:	e8 a8 0e 00 00       	call   ec3 <setTicket>
+  // Ensure that three file descriptors are open.
+  while((fd = open("console", O_RDWR)) >= 0){
+      1b:	83 c4 10             	add    $0x10,%esp
+      1e:	eb 09                	jmp    29 <main+0x29>
+    if(fd >= 3){
+      20:	83 f8 02             	cmp    $0x2,%eax
+      23:	0f 8f 96 00 00 00    	jg     bf <main+0xbf>
+  while((fd = open("console", O_RDWR)) >= 0){
+      29:	83 ec 08             	sub    $0x8,%esp
+      2c:	6a 02                	push   $0x2
+      2e:	68 b9 13 00 00       	push   $0x13b9
+      33:	e8 2b 0e 00 00       	call   e63 <open>
+      38:	83 c4 10             	add    $0x10,%esp
+      3b:	85 c0                	test   %eax,%eax
+      3d:	79 e1                	jns    20 <main+0x20>
+      3f:	eb 2e                	jmp    6f <main+0x6f>
+      41:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    }
+  }
+
+  // Read and run input commands.
+  while(getcmd(buf, sizeof(buf)) >= 0){
+    if(buf[0] == 'c' && buf[1] == 'd' && buf[2] == ' '){
+      48:	80 3d 22 1a 00 00 20 	cmpb   $0x20,0x1a22
+      4f:	0f 84 99 00 00 00    	je     ee <main+0xee>
+      55:	8d 76 00             	lea    0x0(%esi),%esi
+int
+fork1(void)
+{
+  int pid;
+
+  pid = fork();
+      58:	e8 be 0d 00 00       	call   e1b <fork>
+  if(pid == -1)
+      5d:	83 f8 ff             	cmp    $0xffffffff,%eax
+      60:	0f 84 cd 00 00 00    	je     133 <main+0x133>
+    if(fork1() == 0)
+      66:	85 c0                	test   %eax,%eax
+      68:	74 63                	je     cd <main+0xcd>
+    wait();
+      6a:	e8 bc 0d 00 00       	call   e2b <wait>
+  printf(2, "$ ");
+      6f:	83 ec 08             	sub    $0x8,%esp
+      72:	68 18 13 00 00       	push   $0x1318
+      77:	6a 02                	push   $0x2
+      79:	e8 72 0f 00 00       	call   ff0 <printf>
+  memset(buf, 0, nbuf);
+      7e:	83 c4 0c             	add    $0xc,%esp
+      81:	6a 64                	push   $0x64
+      83:	6a 00                	push   $0x0
+      85:	68 20 1a 00 00       	push   $0x1a20
+      8a:	e8 11 0c 00 00       	call   ca0 <memset>
+  gets(buf, nbuf);
+      8f:	58                   	pop    %eax
+      90:	5a                   	pop    %edx
+      91:	6a 64                	push   $0x64
+      93:	68 20 1a 00 00       	push   $0x1a20
+      98:	e8 63 0c 00 00       	call   d00 <gets>
+  if(buf[0] == 0) // EOF
+      9d:	0f b6 05 20 1a 00 00 	movzbl 0x1a20,%eax
+      a4:	83 c4 10             	add    $0x10,%esp
+      a7:	84 c0                	test   %al,%al
+      a9:	74 0f                	je     ba <main+0xba>
+    if(buf[0] == 'c' && buf[1] == 'd' && buf[2] == ' '){
+      ab:	3c 63                	cmp    $0x63,%al
+      ad:	75 a9                	jne    58 <main+0x58>
+      af:	80 3d 21 1a 00 00 64 	cmpb   $0x64,0x1a21
+      b6:	75 a0                	jne    58 <main+0x58>
+      b8:	eb 8e                	jmp    48 <main+0x48>
+  exit();
+      ba:	e8 64 0d 00 00       	call   e23 <exit>
+      close(fd);
+      bf:	83 ec 0c             	sub    $0xc,%esp
+      c2:	50                   	push   %eax
+      c3:	e8 83 0d 00 00       	call   e4b <close>
+      break;
+      c8:	83 c4 10             	add    $0x10,%esp
+      cb:	eb a2                	jmp    6f <main+0x6f>
+      setTicket(1000);
+      cd:	83 ec 0c             	sub    $0xc,%esp
+      d0:	68 e8 03 00 00       	push   $0x3e8
+      d5:	e8 e9 0d 00 00       	call   ec3 <setTicket>
+      runcmd(parsecmd(buf));
+      da:	c7 04 24 20 1a 00 00 	movl   $0x1a20,(%esp)
+      e1:	e8 8a 0a 00 00       	call   b70 <parsecmd>
+      e6:	89 04 24             	mov    %eax,(%esp)
+      e9:	e8 d2 00 00 00       	call   1c0 <runcmd>
+      buf[strlen(buf)-1] = 0;  // chop \n
+      ee:	83 ec 0c             	sub    $0xc,%esp
+      f1:	68 20 1a 00 00       	push   $0x1a20
+      f6:	e8 75 0b 00 00       	call   c70 <strlen>
+      if(chdir(buf+3) < 0)
+      fb:	c7 04 24 23 1a 00 00 	movl   $0x1a23,(%esp)
+      buf[strlen(buf)-1] = 0;  // chop \n
+     102:	c6 80 1f 1a 00 00 00 	movb   $0x0,0x1a1f(%eax)
+      if(chdir(buf+3) < 0)
+     109:	e8 85 0d 00 00       	call   e93 <chdir>
+     10e:	83 c4 10             	add    $0x10,%esp
+     111:	85 c0                	test   %eax,%eax
+     113:	0f 89 56 ff ff ff    	jns    6f <main+0x6f>
+        printf(2, "cannot cd %s\n", buf+3);
+     119:	51                   	push   %ecx
+     11a:	68 23 1a 00 00       	push   $0x1a23
+     11f:	68 c1 13 00 00       	push   $0x13c1
+     124:	6a 02                	push   $0x2
+     126:	e8 c5 0e 00 00       	call   ff0 <printf>
+     12b:	83 c4 10             	add    $0x10,%esp
+     12e:	e9 3c ff ff ff       	jmp    6f <main+0x6f>
+    panic("fork");
+     133:	83 ec 0c             	sub    $0xc,%esp
+     136:	68 1b 13 00 00       	push   $0x131b
+     13b:	e8 40 00 00 00       	call   180 <panic>
+
+00000140 <getcmd>:
+{
+     140:	55                   	push   %ebp
+     141:	89 e5                	mov    %esp,%ebp
+     143:	56                   	push   %esi
+     144:	53                   	push   %ebx
+     145:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     148:	8b 75 0c             	mov    0xc(%ebp),%esi
+  printf(2, "$ ");
+     14b:	83 ec 08             	sub    $0x8,%esp
+     14e:	68 18 13 00 00       	push   $0x1318
+     153:	6a 02                	push   $0x2
+     155:	e8 96 0e 00 00       	call   ff0 <printf>
+  memset(buf, 0, nbuf);
+     15a:	83 c4 0c             	add    $0xc,%esp
+     15d:	56                   	push   %esi
+     15e:	6a 00                	push   $0x0
+     160:	53                   	push   %ebx
+     161:	e8 3a 0b 00 00       	call   ca0 <memset>
+  gets(buf, nbuf);
+     166:	58                   	pop    %eax
+     167:	5a                   	pop    %edx
+     168:	56                   	push   %esi
+     169:	53                   	push   %ebx
+     16a:	e8 91 0b 00 00       	call   d00 <gets>
+  if(buf[0] == 0) // EOF
+     16f:	83 c4 10             	add    $0x10,%esp
+     172:	80 3b 01             	cmpb   $0x1,(%ebx)
+     175:	19 c0                	sbb    %eax,%eax
+}
+     177:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     17a:	5b                   	pop    %ebx
+     17b:	5e                   	pop    %esi
+     17c:	5d                   	pop    %ebp
+     17d:	c3                   	ret
+     17e:	66 90                	xchg   %ax,%ax
+
+00000180 <panic>:
+{
+     180:	55                   	push   %ebp
+     181:	89 e5                	mov    %esp,%ebp
+     183:	83 ec 0c             	sub    $0xc,%esp
+  printf(2, "%s\n", s);
+     186:	ff 75 08             	push   0x8(%ebp)
+     189:	68 b5 13 00 00       	push   $0x13b5
+     18e:	6a 02                	push   $0x2
+     190:	e8 5b 0e 00 00       	call   ff0 <printf>
+  exit();
+     195:	e8 89 0c 00 00       	call   e23 <exit>
+     19a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000001a0 <fork1>:
+{
+     1a0:	55                   	push   %ebp
+     1a1:	89 e5                	mov    %esp,%ebp
+     1a3:	83 ec 08             	sub    $0x8,%esp
+  pid = fork();
+     1a6:	e8 70 0c 00 00       	call   e1b <fork>
+  if(pid == -1)
+     1ab:	83 f8 ff             	cmp    $0xffffffff,%eax
+     1ae:	74 02                	je     1b2 <fork1+0x12>
+  return pid;
+}
+     1b0:	c9                   	leave
+     1b1:	c3                   	ret
+    panic("fork");
+     1b2:	83 ec 0c             	sub    $0xc,%esp
+     1b5:	68 1b 13 00 00       	push   $0x131b
+     1ba:	e8 c1 ff ff ff       	call   180 <panic>
+     1bf:	90                   	nop
+
+000001c0 <runcmd>:
+{
+     1c0:	55                   	push   %ebp
+     1c1:	89 e5                	mov    %esp,%ebp
+     1c3:	53                   	push   %ebx
+     1c4:	83 ec 14             	sub    $0x14,%esp
+     1c7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(cmd == 0)
+     1ca:	85 db                	test   %ebx,%ebx
+     1cc:	74 42                	je     210 <runcmd+0x50>
+  switch(cmd->type){
+     1ce:	83 3b 05             	cmpl   $0x5,(%ebx)
+     1d1:	0f 87 e3 00 00 00    	ja     2ba <runcmd+0xfa>
+     1d7:	8b 03                	mov    (%ebx),%eax
+     1d9:	ff 24 85 d0 13 00 00 	jmp    *0x13d0(,%eax,4)
+    if(ecmd->argv[0] == 0)
+     1e0:	8b 43 04             	mov    0x4(%ebx),%eax
+     1e3:	85 c0                	test   %eax,%eax
+     1e5:	74 29                	je     210 <runcmd+0x50>
+    exec(ecmd->argv[0], ecmd->argv);
+     1e7:	8d 53 04             	lea    0x4(%ebx),%edx
+     1ea:	51                   	push   %ecx
+     1eb:	51                   	push   %ecx
+     1ec:	52                   	push   %edx
+     1ed:	50                   	push   %eax
+     1ee:	e8 68 0c 00 00       	call   e5b <exec>
+    printf(2, "exec %s failed\n", ecmd->argv[0]);
+     1f3:	83 c4 0c             	add    $0xc,%esp
+     1f6:	ff 73 04             	push   0x4(%ebx)
+     1f9:	68 27 13 00 00       	push   $0x1327
+     1fe:	6a 02                	push   $0x2
+     200:	e8 eb 0d 00 00       	call   ff0 <printf>
+    break;
+     205:	83 c4 10             	add    $0x10,%esp
+     208:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     20f:	90                   	nop
+    exit();
+     210:	e8 0e 0c 00 00       	call   e23 <exit>
+    if(fork1() == 0)
+     215:	e8 86 ff ff ff       	call   1a0 <fork1>
+     21a:	85 c0                	test   %eax,%eax
+     21c:	75 f2                	jne    210 <runcmd+0x50>
+     21e:	e9 8c 00 00 00       	jmp    2af <runcmd+0xef>
+    if(pipe(p) < 0)
+     223:	83 ec 0c             	sub    $0xc,%esp
+     226:	8d 45 f0             	lea    -0x10(%ebp),%eax
+     229:	50                   	push   %eax
+     22a:	e8 04 0c 00 00       	call   e33 <pipe>
+     22f:	83 c4 10             	add    $0x10,%esp
+     232:	85 c0                	test   %eax,%eax
+     234:	0f 88 a2 00 00 00    	js     2dc <runcmd+0x11c>
+    if(fork1() == 0){
+     23a:	e8 61 ff ff ff       	call   1a0 <fork1>
+     23f:	85 c0                	test   %eax,%eax
+     241:	0f 84 a2 00 00 00    	je     2e9 <runcmd+0x129>
+    if(fork1() == 0){
+     247:	e8 54 ff ff ff       	call   1a0 <fork1>
+     24c:	85 c0                	test   %eax,%eax
+     24e:	0f 84 c3 00 00 00    	je     317 <runcmd+0x157>
+    close(p[0]);
+     254:	83 ec 0c             	sub    $0xc,%esp
+     257:	ff 75 f0             	push   -0x10(%ebp)
+     25a:	e8 ec 0b 00 00       	call   e4b <close>
+    close(p[1]);
+     25f:	58                   	pop    %eax
+     260:	ff 75 f4             	push   -0xc(%ebp)
+     263:	e8 e3 0b 00 00       	call   e4b <close>
+    wait();
+     268:	e8 be 0b 00 00       	call   e2b <wait>
+    wait();
+     26d:	e8 b9 0b 00 00       	call   e2b <wait>
+    break;
+     272:	83 c4 10             	add    $0x10,%esp
+     275:	eb 99                	jmp    210 <runcmd+0x50>
+    if(fork1() == 0)
+     277:	e8 24 ff ff ff       	call   1a0 <fork1>
+     27c:	85 c0                	test   %eax,%eax
+     27e:	74 2f                	je     2af <runcmd+0xef>
+    wait();
+     280:	e8 a6 0b 00 00       	call   e2b <wait>
+    runcmd(lcmd->right);
+     285:	83 ec 0c             	sub    $0xc,%esp
+     288:	ff 73 08             	push   0x8(%ebx)
+     28b:	e8 30 ff ff ff       	call   1c0 <runcmd>
+    close(rcmd->fd);
+     290:	83 ec 0c             	sub    $0xc,%esp
+     293:	ff 73 14             	push   0x14(%ebx)
+     296:	e8 b0 0b 00 00       	call   e4b <close>
+    if(open(rcmd->file, rcmd->mode) < 0){
+     29b:	58                   	pop    %eax
+     29c:	5a                   	pop    %edx
+     29d:	ff 73 10             	push   0x10(%ebx)
+     2a0:	ff 73 08             	push   0x8(%ebx)
+     2a3:	e8 bb 0b 00 00       	call   e63 <open>
+     2a8:	83 c4 10             	add    $0x10,%esp
+     2ab:	85 c0                	test   %eax,%eax
+     2ad:	78 18                	js     2c7 <runcmd+0x107>
+      runcmd(bcmd->cmd);
+     2af:	83 ec 0c             	sub    $0xc,%esp
+     2b2:	ff 73 04             	push   0x4(%ebx)
+     2b5:	e8 06 ff ff ff       	call   1c0 <runcmd>
+    panic("runcmd");
+     2ba:	83 ec 0c             	sub    $0xc,%esp
+     2bd:	68 20 13 00 00       	push   $0x1320
+     2c2:	e8 b9 fe ff ff       	call   180 <panic>
+      printf(2, "open %s failed\n", rcmd->file);
+     2c7:	51                   	push   %ecx
+     2c8:	ff 73 08             	push   0x8(%ebx)
+     2cb:	68 37 13 00 00       	push   $0x1337
+     2d0:	6a 02                	push   $0x2
+     2d2:	e8 19 0d 00 00       	call   ff0 <printf>
+      exit();
+     2d7:	e8 47 0b 00 00       	call   e23 <exit>
+      panic("pipe");
+     2dc:	83 ec 0c             	sub    $0xc,%esp
+     2df:	68 47 13 00 00       	push   $0x1347
+     2e4:	e8 97 fe ff ff       	call   180 <panic>
+      close(1);
+     2e9:	83 ec 0c             	sub    $0xc,%esp
+     2ec:	6a 01                	push   $0x1
+     2ee:	e8 58 0b 00 00       	call   e4b <close>
+      dup(p[1]);
+     2f3:	58                   	pop    %eax
+     2f4:	ff 75 f4             	push   -0xc(%ebp)
+     2f7:	e8 9f 0b 00 00       	call   e9b <dup>
+      close(p[0]);
+     2fc:	58                   	pop    %eax
+     2fd:	ff 75 f0             	push   -0x10(%ebp)
+     300:	e8 46 0b 00 00       	call   e4b <close>
+      close(p[1]);
+     305:	58                   	pop    %eax
+     306:	ff 75 f4             	push   -0xc(%ebp)
+     309:	e8 3d 0b 00 00       	call   e4b <close>
+      runcmd(pcmd->left);
+     30e:	5a                   	pop    %edx
+     30f:	ff 73 04             	push   0x4(%ebx)
+     312:	e8 a9 fe ff ff       	call   1c0 <runcmd>
+      close(0);
+     317:	83 ec 0c             	sub    $0xc,%esp
+     31a:	6a 00                	push   $0x0
+     31c:	e8 2a 0b 00 00       	call   e4b <close>
+      dup(p[0]);
+     321:	5a                   	pop    %edx
+     322:	ff 75 f0             	push   -0x10(%ebp)
+     325:	e8 71 0b 00 00       	call   e9b <dup>
+      close(p[0]);
+     32a:	59                   	pop    %ecx
+     32b:	ff 75 f0             	push   -0x10(%ebp)
+     32e:	e8 18 0b 00 00       	call   e4b <close>
+      close(p[1]);
+     333:	58                   	pop    %eax
+     334:	ff 75 f4             	push   -0xc(%ebp)
+     337:	e8 0f 0b 00 00       	call   e4b <close>
+      runcmd(pcmd->right);
+     33c:	58                   	pop    %eax
+     33d:	ff 73 08             	push   0x8(%ebx)
+     340:	e8 7b fe ff ff       	call   1c0 <runcmd>
+     345:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     34c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000350 <execcmd>:
+//PAGEBREAK!
+// Constructors
+
+struct cmd*
+execcmd(void)
+{
+     350:	55                   	push   %ebp
+     351:	89 e5                	mov    %esp,%ebp
+     353:	53                   	push   %ebx
+     354:	83 ec 10             	sub    $0x10,%esp
+  struct execcmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+     357:	6a 54                	push   $0x54
+     359:	e8 d2 0e 00 00       	call   1230 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     35e:	83 c4 0c             	add    $0xc,%esp
+     361:	6a 54                	push   $0x54
+  cmd = malloc(sizeof(*cmd));
+     363:	89 c3                	mov    %eax,%ebx
+  memset(cmd, 0, sizeof(*cmd));
+     365:	6a 00                	push   $0x0
+     367:	50                   	push   %eax
+     368:	e8 33 09 00 00       	call   ca0 <memset>
+  cmd->type = EXEC;
+     36d:	c7 03 01 00 00 00    	movl   $0x1,(%ebx)
+  return (struct cmd*)cmd;
+}
+     373:	89 d8                	mov    %ebx,%eax
+     375:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     378:	c9                   	leave
+     379:	c3                   	ret
+     37a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000380 <redircmd>:
+
+struct cmd*
+redircmd(struct cmd *subcmd, char *file, char *efile, int mode, int fd)
+{
+     380:	55                   	push   %ebp
+     381:	89 e5                	mov    %esp,%ebp
+     383:	53                   	push   %ebx
+     384:	83 ec 10             	sub    $0x10,%esp
+  struct redircmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+     387:	6a 18                	push   $0x18
+     389:	e8 a2 0e 00 00       	call   1230 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     38e:	83 c4 0c             	add    $0xc,%esp
+     391:	6a 18                	push   $0x18
+  cmd = malloc(sizeof(*cmd));
+     393:	89 c3                	mov    %eax,%ebx
+  memset(cmd, 0, sizeof(*cmd));
+     395:	6a 00                	push   $0x0
+     397:	50                   	push   %eax
+     398:	e8 03 09 00 00       	call   ca0 <memset>
+  cmd->type = REDIR;
+  cmd->cmd = subcmd;
+     39d:	8b 45 08             	mov    0x8(%ebp),%eax
+  cmd->type = REDIR;
+     3a0:	c7 03 02 00 00 00    	movl   $0x2,(%ebx)
+  cmd->cmd = subcmd;
+     3a6:	89 43 04             	mov    %eax,0x4(%ebx)
+  cmd->file = file;
+     3a9:	8b 45 0c             	mov    0xc(%ebp),%eax
+     3ac:	89 43 08             	mov    %eax,0x8(%ebx)
+  cmd->efile = efile;
+     3af:	8b 45 10             	mov    0x10(%ebp),%eax
+     3b2:	89 43 0c             	mov    %eax,0xc(%ebx)
+  cmd->mode = mode;
+     3b5:	8b 45 14             	mov    0x14(%ebp),%eax
+     3b8:	89 43 10             	mov    %eax,0x10(%ebx)
+  cmd->fd = fd;
+     3bb:	8b 45 18             	mov    0x18(%ebp),%eax
+     3be:	89 43 14             	mov    %eax,0x14(%ebx)
+  return (struct cmd*)cmd;
+}
+     3c1:	89 d8                	mov    %ebx,%eax
+     3c3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     3c6:	c9                   	leave
+     3c7:	c3                   	ret
+     3c8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     3cf:	90                   	nop
+
+000003d0 <pipecmd>:
+
+struct cmd*
+pipecmd(struct cmd *left, struct cmd *right)
+{
+     3d0:	55                   	push   %ebp
+     3d1:	89 e5                	mov    %esp,%ebp
+     3d3:	53                   	push   %ebx
+     3d4:	83 ec 10             	sub    $0x10,%esp
+  struct pipecmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+     3d7:	6a 0c                	push   $0xc
+     3d9:	e8 52 0e 00 00       	call   1230 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     3de:	83 c4 0c             	add    $0xc,%esp
+     3e1:	6a 0c                	push   $0xc
+  cmd = malloc(sizeof(*cmd));
+     3e3:	89 c3                	mov    %eax,%ebx
+  memset(cmd, 0, sizeof(*cmd));
+     3e5:	6a 00                	push   $0x0
+     3e7:	50                   	push   %eax
+     3e8:	e8 b3 08 00 00       	call   ca0 <memset>
+  cmd->type = PIPE;
+  cmd->left = left;
+     3ed:	8b 45 08             	mov    0x8(%ebp),%eax
+  cmd->type = PIPE;
+     3f0:	c7 03 03 00 00 00    	movl   $0x3,(%ebx)
+  cmd->left = left;
+     3f6:	89 43 04             	mov    %eax,0x4(%ebx)
+  cmd->right = right;
+     3f9:	8b 45 0c             	mov    0xc(%ebp),%eax
+     3fc:	89 43 08             	mov    %eax,0x8(%ebx)
+  return (struct cmd*)cmd;
+}
+     3ff:	89 d8                	mov    %ebx,%eax
+     401:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     404:	c9                   	leave
+     405:	c3                   	ret
+     406:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     40d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000410 <listcmd>:
+
+struct cmd*
+listcmd(struct cmd *left, struct cmd *right)
+{
+     410:	55                   	push   %ebp
+     411:	89 e5                	mov    %esp,%ebp
+     413:	53                   	push   %ebx
+     414:	83 ec 10             	sub    $0x10,%esp
+  struct listcmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+     417:	6a 0c                	push   $0xc
+     419:	e8 12 0e 00 00       	call   1230 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     41e:	83 c4 0c             	add    $0xc,%esp
+     421:	6a 0c                	push   $0xc
+  cmd = malloc(sizeof(*cmd));
+     423:	89 c3                	mov    %eax,%ebx
+  memset(cmd, 0, sizeof(*cmd));
+     425:	6a 00                	push   $0x0
+     427:	50                   	push   %eax
+     428:	e8 73 08 00 00       	call   ca0 <memset>
+  cmd->type = LIST;
+  cmd->left = left;
+     42d:	8b 45 08             	mov    0x8(%ebp),%eax
+  cmd->type = LIST;
+     430:	c7 03 04 00 00 00    	movl   $0x4,(%ebx)
+  cmd->left = left;
+     436:	89 43 04             	mov    %eax,0x4(%ebx)
+  cmd->right = right;
+     439:	8b 45 0c             	mov    0xc(%ebp),%eax
+     43c:	89 43 08             	mov    %eax,0x8(%ebx)
+  return (struct cmd*)cmd;
+}
+     43f:	89 d8                	mov    %ebx,%eax
+     441:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     444:	c9                   	leave
+     445:	c3                   	ret
+     446:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     44d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000450 <backcmd>:
+
+struct cmd*
+backcmd(struct cmd *subcmd)
+{
+     450:	55                   	push   %ebp
+     451:	89 e5                	mov    %esp,%ebp
+     453:	53                   	push   %ebx
+     454:	83 ec 10             	sub    $0x10,%esp
+  struct backcmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+     457:	6a 08                	push   $0x8
+     459:	e8 d2 0d 00 00       	call   1230 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     45e:	83 c4 0c             	add    $0xc,%esp
+     461:	6a 08                	push   $0x8
+  cmd = malloc(sizeof(*cmd));
+     463:	89 c3                	mov    %eax,%ebx
+  memset(cmd, 0, sizeof(*cmd));
+     465:	6a 00                	push   $0x0
+     467:	50                   	push   %eax
+     468:	e8 33 08 00 00       	call   ca0 <memset>
+  cmd->type = BACK;
+  cmd->cmd = subcmd;
+     46d:	8b 45 08             	mov    0x8(%ebp),%eax
+  cmd->type = BACK;
+     470:	c7 03 05 00 00 00    	movl   $0x5,(%ebx)
+  cmd->cmd = subcmd;
+     476:	89 43 04             	mov    %eax,0x4(%ebx)
+  return (struct cmd*)cmd;
+}
+     479:	89 d8                	mov    %ebx,%eax
+     47b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     47e:	c9                   	leave
+     47f:	c3                   	ret
+
+00000480 <gettoken>:
+char whitespace[] = " \t\r\n\v";
+char symbols[] = "<|>&;()";
+
+int
+gettoken(char **ps, char *es, char **q, char **eq)
+{
+     480:	55                   	push   %ebp
+     481:	89 e5                	mov    %esp,%ebp
+     483:	57                   	push   %edi
+     484:	56                   	push   %esi
+     485:	53                   	push   %ebx
+     486:	83 ec 0c             	sub    $0xc,%esp
+  char *s;
+  int ret;
+
+  s = *ps;
+     489:	8b 45 08             	mov    0x8(%ebp),%eax
+{
+     48c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     48f:	8b 75 10             	mov    0x10(%ebp),%esi
+  s = *ps;
+     492:	8b 38                	mov    (%eax),%edi
+  while(s < es && strchr(whitespace, *s))
+     494:	39 df                	cmp    %ebx,%edi
+     496:	72 0f                	jb     4a7 <gettoken+0x27>
+     498:	eb 25                	jmp    4bf <gettoken+0x3f>
+     49a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    s++;
+     4a0:	83 c7 01             	add    $0x1,%edi
+  while(s < es && strchr(whitespace, *s))
+     4a3:	39 fb                	cmp    %edi,%ebx
+     4a5:	74 18                	je     4bf <gettoken+0x3f>
+     4a7:	0f be 07             	movsbl (%edi),%eax
+     4aa:	83 ec 08             	sub    $0x8,%esp
+     4ad:	50                   	push   %eax
+     4ae:	68 18 1a 00 00       	push   $0x1a18
+     4b3:	e8 08 08 00 00       	call   cc0 <strchr>
+     4b8:	83 c4 10             	add    $0x10,%esp
+     4bb:	85 c0                	test   %eax,%eax
+     4bd:	75 e1                	jne    4a0 <gettoken+0x20>
+  if(q)
+     4bf:	85 f6                	test   %esi,%esi
+     4c1:	74 02                	je     4c5 <gettoken+0x45>
+    *q = s;
+     4c3:	89 3e                	mov    %edi,(%esi)
+  ret = *s;
+     4c5:	0f b6 07             	movzbl (%edi),%eax
+  switch(*s){
+     4c8:	3c 3c                	cmp    $0x3c,%al
+     4ca:	0f 8f d0 00 00 00    	jg     5a0 <gettoken+0x120>
+     4d0:	3c 3a                	cmp    $0x3a,%al
+     4d2:	0f 8f bc 00 00 00    	jg     594 <gettoken+0x114>
+     4d8:	84 c0                	test   %al,%al
+     4da:	75 44                	jne    520 <gettoken+0xa0>
+     4dc:	31 f6                	xor    %esi,%esi
+    ret = 'a';
+    while(s < es && !strchr(whitespace, *s) && !strchr(symbols, *s))
+      s++;
+    break;
+  }
+  if(eq)
+     4de:	8b 4d 14             	mov    0x14(%ebp),%ecx
+     4e1:	85 c9                	test   %ecx,%ecx
+     4e3:	74 05                	je     4ea <gettoken+0x6a>
+    *eq = s;
+     4e5:	8b 45 14             	mov    0x14(%ebp),%eax
+     4e8:	89 38                	mov    %edi,(%eax)
+
+  while(s < es && strchr(whitespace, *s))
+     4ea:	39 df                	cmp    %ebx,%edi
+     4ec:	72 09                	jb     4f7 <gettoken+0x77>
+     4ee:	eb 1f                	jmp    50f <gettoken+0x8f>
+    s++;
+     4f0:	83 c7 01             	add    $0x1,%edi
+  while(s < es && strchr(whitespace, *s))
+     4f3:	39 fb                	cmp    %edi,%ebx
+     4f5:	74 18                	je     50f <gettoken+0x8f>
+     4f7:	0f be 07             	movsbl (%edi),%eax
+     4fa:	83 ec 08             	sub    $0x8,%esp
+     4fd:	50                   	push   %eax
+     4fe:	68 18 1a 00 00       	push   $0x1a18
+     503:	e8 b8 07 00 00       	call   cc0 <strchr>
+     508:	83 c4 10             	add    $0x10,%esp
+     50b:	85 c0                	test   %eax,%eax
+     50d:	75 e1                	jne    4f0 <gettoken+0x70>
+  *ps = s;
+     50f:	8b 45 08             	mov    0x8(%ebp),%eax
+     512:	89 38                	mov    %edi,(%eax)
+  return ret;
+}
+     514:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     517:	89 f0                	mov    %esi,%eax
+     519:	5b                   	pop    %ebx
+     51a:	5e                   	pop    %esi
+     51b:	5f                   	pop    %edi
+     51c:	5d                   	pop    %ebp
+     51d:	c3                   	ret
+     51e:	66 90                	xchg   %ax,%ax
+  switch(*s){
+     520:	79 66                	jns    588 <gettoken+0x108>
+    while(s < es && !strchr(whitespace, *s) && !strchr(symbols, *s))
+     522:	39 df                	cmp    %ebx,%edi
+     524:	72 39                	jb     55f <gettoken+0xdf>
+  if(eq)
+     526:	8b 55 14             	mov    0x14(%ebp),%edx
+     529:	85 d2                	test   %edx,%edx
+     52b:	0f 84 b3 00 00 00    	je     5e4 <gettoken+0x164>
+    *eq = s;
+     531:	8b 45 14             	mov    0x14(%ebp),%eax
+     534:	89 38                	mov    %edi,(%eax)
+  while(s < es && strchr(whitespace, *s))
+     536:	e9 a9 00 00 00       	jmp    5e4 <gettoken+0x164>
+     53b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     53f:	90                   	nop
+    while(s < es && !strchr(whitespace, *s) && !strchr(symbols, *s))
+     540:	0f be 07             	movsbl (%edi),%eax
+     543:	83 ec 08             	sub    $0x8,%esp
+     546:	50                   	push   %eax
+     547:	68 10 1a 00 00       	push   $0x1a10
+     54c:	e8 6f 07 00 00       	call   cc0 <strchr>
+     551:	83 c4 10             	add    $0x10,%esp
+     554:	85 c0                	test   %eax,%eax
+     556:	75 1f                	jne    577 <gettoken+0xf7>
+      s++;
+     558:	83 c7 01             	add    $0x1,%edi
+    while(s < es && !strchr(whitespace, *s) && !strchr(symbols, *s))
+     55b:	39 fb                	cmp    %edi,%ebx
+     55d:	74 77                	je     5d6 <gettoken+0x156>
+     55f:	0f be 07             	movsbl (%edi),%eax
+     562:	83 ec 08             	sub    $0x8,%esp
+     565:	50                   	push   %eax
+     566:	68 18 1a 00 00       	push   $0x1a18
+     56b:	e8 50 07 00 00       	call   cc0 <strchr>
+     570:	83 c4 10             	add    $0x10,%esp
+     573:	85 c0                	test   %eax,%eax
+     575:	74 c9                	je     540 <gettoken+0xc0>
+    ret = 'a';
+     577:	be 61 00 00 00       	mov    $0x61,%esi
+     57c:	e9 5d ff ff ff       	jmp    4de <gettoken+0x5e>
+     581:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  switch(*s){
+     588:	3c 26                	cmp    $0x26,%al
+     58a:	74 08                	je     594 <gettoken+0x114>
+     58c:	8d 48 d8             	lea    -0x28(%eax),%ecx
+     58f:	80 f9 01             	cmp    $0x1,%cl
+     592:	77 8e                	ja     522 <gettoken+0xa2>
+  ret = *s;
+     594:	0f be f0             	movsbl %al,%esi
+    s++;
+     597:	83 c7 01             	add    $0x1,%edi
+    break;
+     59a:	e9 3f ff ff ff       	jmp    4de <gettoken+0x5e>
+     59f:	90                   	nop
+  switch(*s){
+     5a0:	3c 3e                	cmp    $0x3e,%al
+     5a2:	75 1c                	jne    5c0 <gettoken+0x140>
+    if(*s == '>'){
+     5a4:	80 7f 01 3e          	cmpb   $0x3e,0x1(%edi)
+     5a8:	74 1f                	je     5c9 <gettoken+0x149>
+    s++;
+     5aa:	83 c7 01             	add    $0x1,%edi
+  ret = *s;
+     5ad:	be 3e 00 00 00       	mov    $0x3e,%esi
+     5b2:	e9 27 ff ff ff       	jmp    4de <gettoken+0x5e>
+     5b7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     5be:	66 90                	xchg   %ax,%ax
+  switch(*s){
+     5c0:	3c 7c                	cmp    $0x7c,%al
+     5c2:	74 d0                	je     594 <gettoken+0x114>
+     5c4:	e9 59 ff ff ff       	jmp    522 <gettoken+0xa2>
+      s++;
+     5c9:	83 c7 02             	add    $0x2,%edi
+      ret = '+';
+     5cc:	be 2b 00 00 00       	mov    $0x2b,%esi
+     5d1:	e9 08 ff ff ff       	jmp    4de <gettoken+0x5e>
+  if(eq)
+     5d6:	8b 45 14             	mov    0x14(%ebp),%eax
+     5d9:	85 c0                	test   %eax,%eax
+     5db:	74 05                	je     5e2 <gettoken+0x162>
+    *eq = s;
+     5dd:	8b 45 14             	mov    0x14(%ebp),%eax
+     5e0:	89 18                	mov    %ebx,(%eax)
+      s++;
+     5e2:	89 df                	mov    %ebx,%edi
+    ret = 'a';
+     5e4:	be 61 00 00 00       	mov    $0x61,%esi
+     5e9:	e9 21 ff ff ff       	jmp    50f <gettoken+0x8f>
+     5ee:	66 90                	xchg   %ax,%ax
+
+000005f0 <peek>:
+
+int
+peek(char **ps, char *es, char *toks)
+{
+     5f0:	55                   	push   %ebp
+     5f1:	89 e5                	mov    %esp,%ebp
+     5f3:	57                   	push   %edi
+     5f4:	56                   	push   %esi
+     5f5:	53                   	push   %ebx
+     5f6:	83 ec 0c             	sub    $0xc,%esp
+     5f9:	8b 7d 08             	mov    0x8(%ebp),%edi
+     5fc:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *s;
+
+  s = *ps;
+     5ff:	8b 1f                	mov    (%edi),%ebx
+  while(s < es && strchr(whitespace, *s))
+     601:	39 f3                	cmp    %esi,%ebx
+     603:	72 12                	jb     617 <peek+0x27>
+     605:	eb 28                	jmp    62f <peek+0x3f>
+     607:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     60e:	66 90                	xchg   %ax,%ax
+    s++;
+     610:	83 c3 01             	add    $0x1,%ebx
+  while(s < es && strchr(whitespace, *s))
+     613:	39 de                	cmp    %ebx,%esi
+     615:	74 18                	je     62f <peek+0x3f>
+     617:	0f be 03             	movsbl (%ebx),%eax
+     61a:	83 ec 08             	sub    $0x8,%esp
+     61d:	50                   	push   %eax
+     61e:	68 18 1a 00 00       	push   $0x1a18
+     623:	e8 98 06 00 00       	call   cc0 <strchr>
+     628:	83 c4 10             	add    $0x10,%esp
+     62b:	85 c0                	test   %eax,%eax
+     62d:	75 e1                	jne    610 <peek+0x20>
+  *ps = s;
+     62f:	89 1f                	mov    %ebx,(%edi)
+  return *s && strchr(toks, *s);
+     631:	0f be 03             	movsbl (%ebx),%eax
+     634:	31 d2                	xor    %edx,%edx
+     636:	84 c0                	test   %al,%al
+     638:	75 0e                	jne    648 <peek+0x58>
+}
+     63a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     63d:	89 d0                	mov    %edx,%eax
+     63f:	5b                   	pop    %ebx
+     640:	5e                   	pop    %esi
+     641:	5f                   	pop    %edi
+     642:	5d                   	pop    %ebp
+     643:	c3                   	ret
+     644:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  return *s && strchr(toks, *s);
+     648:	83 ec 08             	sub    $0x8,%esp
+     64b:	50                   	push   %eax
+     64c:	ff 75 10             	push   0x10(%ebp)
+     64f:	e8 6c 06 00 00       	call   cc0 <strchr>
+     654:	83 c4 10             	add    $0x10,%esp
+     657:	31 d2                	xor    %edx,%edx
+     659:	85 c0                	test   %eax,%eax
+     65b:	0f 95 c2             	setne  %dl
+}
+     65e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     661:	5b                   	pop    %ebx
+     662:	89 d0                	mov    %edx,%eax
+     664:	5e                   	pop    %esi
+     665:	5f                   	pop    %edi
+     666:	5d                   	pop    %ebp
+     667:	c3                   	ret
+     668:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     66f:	90                   	nop
+
+00000670 <parseredirs>:
+  return cmd;
+}
+
+struct cmd*
+parseredirs(struct cmd *cmd, char **ps, char *es)
+{
+     670:	55                   	push   %ebp
+     671:	89 e5                	mov    %esp,%ebp
+     673:	57                   	push   %edi
+     674:	56                   	push   %esi
+     675:	53                   	push   %ebx
+     676:	83 ec 2c             	sub    $0x2c,%esp
+     679:	8b 75 0c             	mov    0xc(%ebp),%esi
+     67c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  int tok;
+  char *q, *eq;
+
+  while(peek(ps, es, "<>")){
+     67f:	90                   	nop
+     680:	83 ec 04             	sub    $0x4,%esp
+     683:	68 69 13 00 00       	push   $0x1369
+     688:	53                   	push   %ebx
+     689:	56                   	push   %esi
+     68a:	e8 61 ff ff ff       	call   5f0 <peek>
+     68f:	83 c4 10             	add    $0x10,%esp
+     692:	85 c0                	test   %eax,%eax
+     694:	0f 84 f6 00 00 00    	je     790 <parseredirs+0x120>
+    tok = gettoken(ps, es, 0, 0);
+     69a:	6a 00                	push   $0x0
+     69c:	6a 00                	push   $0x0
+     69e:	53                   	push   %ebx
+     69f:	56                   	push   %esi
+     6a0:	e8 db fd ff ff       	call   480 <gettoken>
+     6a5:	89 c7                	mov    %eax,%edi
+    if(gettoken(ps, es, &q, &eq) != 'a')
+     6a7:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+     6aa:	50                   	push   %eax
+     6ab:	8d 45 e0             	lea    -0x20(%ebp),%eax
+     6ae:	50                   	push   %eax
+     6af:	53                   	push   %ebx
+     6b0:	56                   	push   %esi
+     6b1:	e8 ca fd ff ff       	call   480 <gettoken>
+     6b6:	83 c4 20             	add    $0x20,%esp
+     6b9:	83 f8 61             	cmp    $0x61,%eax
+     6bc:	0f 85 d9 00 00 00    	jne    79b <parseredirs+0x12b>
+      panic("missing file for redirection");
+    switch(tok){
+     6c2:	83 ff 3c             	cmp    $0x3c,%edi
+     6c5:	74 69                	je     730 <parseredirs+0xc0>
+     6c7:	83 ff 3e             	cmp    $0x3e,%edi
+     6ca:	74 05                	je     6d1 <parseredirs+0x61>
+     6cc:	83 ff 2b             	cmp    $0x2b,%edi
+     6cf:	75 af                	jne    680 <parseredirs+0x10>
+      break;
+    case '>':
+      cmd = redircmd(cmd, q, eq, O_WRONLY|O_CREATE, 1);
+      break;
+    case '+':  // >>
+      cmd = redircmd(cmd, q, eq, O_WRONLY|O_CREATE, 1);
+     6d1:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+     6d4:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  cmd = malloc(sizeof(*cmd));
+     6d7:	83 ec 0c             	sub    $0xc,%esp
+      cmd = redircmd(cmd, q, eq, O_WRONLY|O_CREATE, 1);
+     6da:	89 55 d0             	mov    %edx,-0x30(%ebp)
+     6dd:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+  cmd = malloc(sizeof(*cmd));
+     6e0:	6a 18                	push   $0x18
+     6e2:	e8 49 0b 00 00       	call   1230 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     6e7:	83 c4 0c             	add    $0xc,%esp
+     6ea:	6a 18                	push   $0x18
+  cmd = malloc(sizeof(*cmd));
+     6ec:	89 c7                	mov    %eax,%edi
+  memset(cmd, 0, sizeof(*cmd));
+     6ee:	6a 00                	push   $0x0
+     6f0:	50                   	push   %eax
+     6f1:	e8 aa 05 00 00       	call   ca0 <memset>
+  cmd->type = REDIR;
+     6f6:	c7 07 02 00 00 00    	movl   $0x2,(%edi)
+  cmd->cmd = subcmd;
+     6fc:	8b 45 08             	mov    0x8(%ebp),%eax
+      break;
+     6ff:	83 c4 10             	add    $0x10,%esp
+  cmd->cmd = subcmd;
+     702:	89 47 04             	mov    %eax,0x4(%edi)
+  cmd->file = file;
+     705:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+     708:	89 4f 08             	mov    %ecx,0x8(%edi)
+  cmd->efile = efile;
+     70b:	8b 55 d0             	mov    -0x30(%ebp),%edx
+  cmd->mode = mode;
+     70e:	c7 47 10 01 02 00 00 	movl   $0x201,0x10(%edi)
+  cmd->efile = efile;
+     715:	89 57 0c             	mov    %edx,0xc(%edi)
+  cmd->fd = fd;
+     718:	c7 47 14 01 00 00 00 	movl   $0x1,0x14(%edi)
+      break;
+     71f:	89 7d 08             	mov    %edi,0x8(%ebp)
+     722:	e9 59 ff ff ff       	jmp    680 <parseredirs+0x10>
+     727:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     72e:	66 90                	xchg   %ax,%ax
+      cmd = redircmd(cmd, q, eq, O_RDONLY, 0);
+     730:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+     733:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  cmd = malloc(sizeof(*cmd));
+     736:	83 ec 0c             	sub    $0xc,%esp
+      cmd = redircmd(cmd, q, eq, O_RDONLY, 0);
+     739:	89 55 d0             	mov    %edx,-0x30(%ebp)
+     73c:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+  cmd = malloc(sizeof(*cmd));
+     73f:	6a 18                	push   $0x18
+     741:	e8 ea 0a 00 00       	call   1230 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     746:	83 c4 0c             	add    $0xc,%esp
+     749:	6a 18                	push   $0x18
+  cmd = malloc(sizeof(*cmd));
+     74b:	89 c7                	mov    %eax,%edi
+  memset(cmd, 0, sizeof(*cmd));
+     74d:	6a 00                	push   $0x0
+     74f:	50                   	push   %eax
+     750:	e8 4b 05 00 00       	call   ca0 <memset>
+  cmd->cmd = subcmd;
+     755:	8b 45 08             	mov    0x8(%ebp),%eax
+  cmd->file = file;
+     758:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+      break;
+     75b:	89 7d 08             	mov    %edi,0x8(%ebp)
+  cmd->efile = efile;
+     75e:	8b 55 d0             	mov    -0x30(%ebp),%edx
+  cmd->type = REDIR;
+     761:	c7 07 02 00 00 00    	movl   $0x2,(%edi)
+      break;
+     767:	83 c4 10             	add    $0x10,%esp
+  cmd->cmd = subcmd;
+     76a:	89 47 04             	mov    %eax,0x4(%edi)
+  cmd->file = file;
+     76d:	89 4f 08             	mov    %ecx,0x8(%edi)
+  cmd->efile = efile;
+     770:	89 57 0c             	mov    %edx,0xc(%edi)
+  cmd->mode = mode;
+     773:	c7 47 10 00 00 00 00 	movl   $0x0,0x10(%edi)
+  cmd->fd = fd;
+     77a:	c7 47 14 00 00 00 00 	movl   $0x0,0x14(%edi)
+      break;
+     781:	e9 fa fe ff ff       	jmp    680 <parseredirs+0x10>
+     786:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     78d:	8d 76 00             	lea    0x0(%esi),%esi
+    }
+  }
+  return cmd;
+}
+     790:	8b 45 08             	mov    0x8(%ebp),%eax
+     793:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     796:	5b                   	pop    %ebx
+     797:	5e                   	pop    %esi
+     798:	5f                   	pop    %edi
+     799:	5d                   	pop    %ebp
+     79a:	c3                   	ret
+      panic("missing file for redirection");
+     79b:	83 ec 0c             	sub    $0xc,%esp
+     79e:	68 4c 13 00 00       	push   $0x134c
+     7a3:	e8 d8 f9 ff ff       	call   180 <panic>
+     7a8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     7af:	90                   	nop
+
+000007b0 <parseexec>:
+  return cmd;
+}
+
+struct cmd*
+parseexec(char **ps, char *es)
+{
+     7b0:	55                   	push   %ebp
+     7b1:	89 e5                	mov    %esp,%ebp
+     7b3:	57                   	push   %edi
+     7b4:	56                   	push   %esi
+     7b5:	53                   	push   %ebx
+     7b6:	83 ec 30             	sub    $0x30,%esp
+     7b9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     7bc:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *q, *eq;
+  int tok, argc;
+  struct execcmd *cmd;
+  struct cmd *ret;
+
+  if(peek(ps, es, "("))
+     7bf:	68 6c 13 00 00       	push   $0x136c
+     7c4:	56                   	push   %esi
+     7c5:	53                   	push   %ebx
+     7c6:	e8 25 fe ff ff       	call   5f0 <peek>
+     7cb:	83 c4 10             	add    $0x10,%esp
+     7ce:	85 c0                	test   %eax,%eax
+     7d0:	0f 85 aa 00 00 00    	jne    880 <parseexec+0xd0>
+  cmd = malloc(sizeof(*cmd));
+     7d6:	83 ec 0c             	sub    $0xc,%esp
+     7d9:	89 c7                	mov    %eax,%edi
+     7db:	6a 54                	push   $0x54
+     7dd:	e8 4e 0a 00 00       	call   1230 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     7e2:	83 c4 0c             	add    $0xc,%esp
+     7e5:	6a 54                	push   $0x54
+     7e7:	6a 00                	push   $0x0
+     7e9:	89 45 d0             	mov    %eax,-0x30(%ebp)
+     7ec:	50                   	push   %eax
+     7ed:	e8 ae 04 00 00       	call   ca0 <memset>
+  cmd->type = EXEC;
+     7f2:	8b 45 d0             	mov    -0x30(%ebp),%eax
+
+  ret = execcmd();
+  cmd = (struct execcmd*)ret;
+
+  argc = 0;
+  ret = parseredirs(ret, ps, es);
+     7f5:	83 c4 0c             	add    $0xc,%esp
+  cmd->type = EXEC;
+     7f8:	c7 00 01 00 00 00    	movl   $0x1,(%eax)
+  ret = parseredirs(ret, ps, es);
+     7fe:	56                   	push   %esi
+     7ff:	53                   	push   %ebx
+     800:	50                   	push   %eax
+     801:	e8 6a fe ff ff       	call   670 <parseredirs>
+  while(!peek(ps, es, "|)&;")){
+     806:	83 c4 10             	add    $0x10,%esp
+  ret = parseredirs(ret, ps, es);
+     809:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  while(!peek(ps, es, "|)&;")){
+     80c:	eb 15                	jmp    823 <parseexec+0x73>
+     80e:	66 90                	xchg   %ax,%ax
+    cmd->argv[argc] = q;
+    cmd->eargv[argc] = eq;
+    argc++;
+    if(argc >= MAXARGS)
+      panic("too many args");
+    ret = parseredirs(ret, ps, es);
+     810:	83 ec 04             	sub    $0x4,%esp
+     813:	56                   	push   %esi
+     814:	53                   	push   %ebx
+     815:	ff 75 d4             	push   -0x2c(%ebp)
+     818:	e8 53 fe ff ff       	call   670 <parseredirs>
+     81d:	83 c4 10             	add    $0x10,%esp
+     820:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  while(!peek(ps, es, "|)&;")){
+     823:	83 ec 04             	sub    $0x4,%esp
+     826:	68 83 13 00 00       	push   $0x1383
+     82b:	56                   	push   %esi
+     82c:	53                   	push   %ebx
+     82d:	e8 be fd ff ff       	call   5f0 <peek>
+     832:	83 c4 10             	add    $0x10,%esp
+     835:	85 c0                	test   %eax,%eax
+     837:	75 5f                	jne    898 <parseexec+0xe8>
+    if((tok=gettoken(ps, es, &q, &eq)) == 0)
+     839:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+     83c:	50                   	push   %eax
+     83d:	8d 45 e0             	lea    -0x20(%ebp),%eax
+     840:	50                   	push   %eax
+     841:	56                   	push   %esi
+     842:	53                   	push   %ebx
+     843:	e8 38 fc ff ff       	call   480 <gettoken>
+     848:	83 c4 10             	add    $0x10,%esp
+     84b:	85 c0                	test   %eax,%eax
+     84d:	74 49                	je     898 <parseexec+0xe8>
+    if(tok != 'a')
+     84f:	83 f8 61             	cmp    $0x61,%eax
+     852:	75 62                	jne    8b6 <parseexec+0x106>
+    cmd->argv[argc] = q;
+     854:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     857:	8b 55 d0             	mov    -0x30(%ebp),%edx
+     85a:	89 44 ba 04          	mov    %eax,0x4(%edx,%edi,4)
+    cmd->eargv[argc] = eq;
+     85e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     861:	89 44 ba 2c          	mov    %eax,0x2c(%edx,%edi,4)
+    argc++;
+     865:	83 c7 01             	add    $0x1,%edi
+    if(argc >= MAXARGS)
+     868:	83 ff 0a             	cmp    $0xa,%edi
+     86b:	75 a3                	jne    810 <parseexec+0x60>
+      panic("too many args");
+     86d:	83 ec 0c             	sub    $0xc,%esp
+     870:	68 75 13 00 00       	push   $0x1375
+     875:	e8 06 f9 ff ff       	call   180 <panic>
+     87a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    return parseblock(ps, es);
+     880:	89 75 0c             	mov    %esi,0xc(%ebp)
+     883:	89 5d 08             	mov    %ebx,0x8(%ebp)
+  }
+  cmd->argv[argc] = 0;
+  cmd->eargv[argc] = 0;
+  return ret;
+}
+     886:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     889:	5b                   	pop    %ebx
+     88a:	5e                   	pop    %esi
+     88b:	5f                   	pop    %edi
+     88c:	5d                   	pop    %ebp
+    return parseblock(ps, es);
+     88d:	e9 ae 01 00 00       	jmp    a40 <parseblock>
+     892:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  cmd->argv[argc] = 0;
+     898:	8b 45 d0             	mov    -0x30(%ebp),%eax
+     89b:	c7 44 b8 04 00 00 00 	movl   $0x0,0x4(%eax,%edi,4)
+     8a2:	00 
+  cmd->eargv[argc] = 0;
+     8a3:	c7 44 b8 2c 00 00 00 	movl   $0x0,0x2c(%eax,%edi,4)
+     8aa:	00 
+}
+     8ab:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+     8ae:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     8b1:	5b                   	pop    %ebx
+     8b2:	5e                   	pop    %esi
+     8b3:	5f                   	pop    %edi
+     8b4:	5d                   	pop    %ebp
+     8b5:	c3                   	ret
+      panic("syntax");
+     8b6:	83 ec 0c             	sub    $0xc,%esp
+     8b9:	68 6e 13 00 00       	push   $0x136e
+     8be:	e8 bd f8 ff ff       	call   180 <panic>
+     8c3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     8ca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000008d0 <parsepipe>:
+{
+     8d0:	55                   	push   %ebp
+     8d1:	89 e5                	mov    %esp,%ebp
+     8d3:	57                   	push   %edi
+     8d4:	56                   	push   %esi
+     8d5:	53                   	push   %ebx
+     8d6:	83 ec 14             	sub    $0x14,%esp
+     8d9:	8b 75 08             	mov    0x8(%ebp),%esi
+     8dc:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  cmd = parseexec(ps, es);
+     8df:	57                   	push   %edi
+     8e0:	56                   	push   %esi
+     8e1:	e8 ca fe ff ff       	call   7b0 <parseexec>
+  if(peek(ps, es, "|")){
+     8e6:	83 c4 0c             	add    $0xc,%esp
+     8e9:	68 88 13 00 00       	push   $0x1388
+  cmd = parseexec(ps, es);
+     8ee:	89 c3                	mov    %eax,%ebx
+  if(peek(ps, es, "|")){
+     8f0:	57                   	push   %edi
+     8f1:	56                   	push   %esi
+     8f2:	e8 f9 fc ff ff       	call   5f0 <peek>
+     8f7:	83 c4 10             	add    $0x10,%esp
+     8fa:	85 c0                	test   %eax,%eax
+     8fc:	75 12                	jne    910 <parsepipe+0x40>
+}
+     8fe:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     901:	89 d8                	mov    %ebx,%eax
+     903:	5b                   	pop    %ebx
+     904:	5e                   	pop    %esi
+     905:	5f                   	pop    %edi
+     906:	5d                   	pop    %ebp
+     907:	c3                   	ret
+     908:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     90f:	90                   	nop
+    gettoken(ps, es, 0, 0);
+     910:	6a 00                	push   $0x0
+     912:	6a 00                	push   $0x0
+     914:	57                   	push   %edi
+     915:	56                   	push   %esi
+     916:	e8 65 fb ff ff       	call   480 <gettoken>
+    cmd = pipecmd(cmd, parsepipe(ps, es));
+     91b:	58                   	pop    %eax
+     91c:	5a                   	pop    %edx
+     91d:	57                   	push   %edi
+     91e:	56                   	push   %esi
+     91f:	e8 ac ff ff ff       	call   8d0 <parsepipe>
+  cmd = malloc(sizeof(*cmd));
+     924:	c7 04 24 0c 00 00 00 	movl   $0xc,(%esp)
+    cmd = pipecmd(cmd, parsepipe(ps, es));
+     92b:	89 c7                	mov    %eax,%edi
+  cmd = malloc(sizeof(*cmd));
+     92d:	e8 fe 08 00 00       	call   1230 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     932:	83 c4 0c             	add    $0xc,%esp
+     935:	6a 0c                	push   $0xc
+  cmd = malloc(sizeof(*cmd));
+     937:	89 c6                	mov    %eax,%esi
+  memset(cmd, 0, sizeof(*cmd));
+     939:	6a 00                	push   $0x0
+     93b:	50                   	push   %eax
+     93c:	e8 5f 03 00 00       	call   ca0 <memset>
+  cmd->left = left;
+     941:	89 5e 04             	mov    %ebx,0x4(%esi)
+  cmd->right = right;
+     944:	83 c4 10             	add    $0x10,%esp
+     947:	89 f3                	mov    %esi,%ebx
+  cmd->type = PIPE;
+     949:	c7 06 03 00 00 00    	movl   $0x3,(%esi)
+}
+     94f:	89 d8                	mov    %ebx,%eax
+  cmd->right = right;
+     951:	89 7e 08             	mov    %edi,0x8(%esi)
+}
+     954:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     957:	5b                   	pop    %ebx
+     958:	5e                   	pop    %esi
+     959:	5f                   	pop    %edi
+     95a:	5d                   	pop    %ebp
+     95b:	c3                   	ret
+     95c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000960 <parseline>:
+{
+     960:	55                   	push   %ebp
+     961:	89 e5                	mov    %esp,%ebp
+     963:	57                   	push   %edi
+     964:	56                   	push   %esi
+     965:	53                   	push   %ebx
+     966:	83 ec 24             	sub    $0x24,%esp
+     969:	8b 75 08             	mov    0x8(%ebp),%esi
+     96c:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  cmd = parsepipe(ps, es);
+     96f:	57                   	push   %edi
+     970:	56                   	push   %esi
+     971:	e8 5a ff ff ff       	call   8d0 <parsepipe>
+  while(peek(ps, es, "&")){
+     976:	83 c4 10             	add    $0x10,%esp
+  cmd = parsepipe(ps, es);
+     979:	89 c3                	mov    %eax,%ebx
+  while(peek(ps, es, "&")){
+     97b:	eb 3b                	jmp    9b8 <parseline+0x58>
+     97d:	8d 76 00             	lea    0x0(%esi),%esi
+    gettoken(ps, es, 0, 0);
+     980:	6a 00                	push   $0x0
+     982:	6a 00                	push   $0x0
+     984:	57                   	push   %edi
+     985:	56                   	push   %esi
+     986:	e8 f5 fa ff ff       	call   480 <gettoken>
+  cmd = malloc(sizeof(*cmd));
+     98b:	c7 04 24 08 00 00 00 	movl   $0x8,(%esp)
+     992:	e8 99 08 00 00       	call   1230 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     997:	83 c4 0c             	add    $0xc,%esp
+     99a:	6a 08                	push   $0x8
+     99c:	6a 00                	push   $0x0
+     99e:	50                   	push   %eax
+     99f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+     9a2:	e8 f9 02 00 00       	call   ca0 <memset>
+  cmd->type = BACK;
+     9a7:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  cmd->cmd = subcmd;
+     9aa:	83 c4 10             	add    $0x10,%esp
+  cmd->type = BACK;
+     9ad:	c7 02 05 00 00 00    	movl   $0x5,(%edx)
+  cmd->cmd = subcmd;
+     9b3:	89 5a 04             	mov    %ebx,0x4(%edx)
+     9b6:	89 d3                	mov    %edx,%ebx
+  while(peek(ps, es, "&")){
+     9b8:	83 ec 04             	sub    $0x4,%esp
+     9bb:	68 8a 13 00 00       	push   $0x138a
+     9c0:	57                   	push   %edi
+     9c1:	56                   	push   %esi
+     9c2:	e8 29 fc ff ff       	call   5f0 <peek>
+     9c7:	83 c4 10             	add    $0x10,%esp
+     9ca:	85 c0                	test   %eax,%eax
+     9cc:	75 b2                	jne    980 <parseline+0x20>
+  if(peek(ps, es, ";")){
+     9ce:	83 ec 04             	sub    $0x4,%esp
+     9d1:	68 86 13 00 00       	push   $0x1386
+     9d6:	57                   	push   %edi
+     9d7:	56                   	push   %esi
+     9d8:	e8 13 fc ff ff       	call   5f0 <peek>
+     9dd:	83 c4 10             	add    $0x10,%esp
+     9e0:	85 c0                	test   %eax,%eax
+     9e2:	75 0c                	jne    9f0 <parseline+0x90>
+}
+     9e4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     9e7:	89 d8                	mov    %ebx,%eax
+     9e9:	5b                   	pop    %ebx
+     9ea:	5e                   	pop    %esi
+     9eb:	5f                   	pop    %edi
+     9ec:	5d                   	pop    %ebp
+     9ed:	c3                   	ret
+     9ee:	66 90                	xchg   %ax,%ax
+    gettoken(ps, es, 0, 0);
+     9f0:	6a 00                	push   $0x0
+     9f2:	6a 00                	push   $0x0
+     9f4:	57                   	push   %edi
+     9f5:	56                   	push   %esi
+     9f6:	e8 85 fa ff ff       	call   480 <gettoken>
+    cmd = listcmd(cmd, parseline(ps, es));
+     9fb:	58                   	pop    %eax
+     9fc:	5a                   	pop    %edx
+     9fd:	57                   	push   %edi
+     9fe:	56                   	push   %esi
+     9ff:	e8 5c ff ff ff       	call   960 <parseline>
+  cmd = malloc(sizeof(*cmd));
+     a04:	c7 04 24 0c 00 00 00 	movl   $0xc,(%esp)
+    cmd = listcmd(cmd, parseline(ps, es));
+     a0b:	89 c7                	mov    %eax,%edi
+  cmd = malloc(sizeof(*cmd));
+     a0d:	e8 1e 08 00 00       	call   1230 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     a12:	83 c4 0c             	add    $0xc,%esp
+     a15:	6a 0c                	push   $0xc
+  cmd = malloc(sizeof(*cmd));
+     a17:	89 c6                	mov    %eax,%esi
+  memset(cmd, 0, sizeof(*cmd));
+     a19:	6a 00                	push   $0x0
+     a1b:	50                   	push   %eax
+     a1c:	e8 7f 02 00 00       	call   ca0 <memset>
+  cmd->left = left;
+     a21:	89 5e 04             	mov    %ebx,0x4(%esi)
+  cmd->right = right;
+     a24:	83 c4 10             	add    $0x10,%esp
+     a27:	89 f3                	mov    %esi,%ebx
+  cmd->type = LIST;
+     a29:	c7 06 04 00 00 00    	movl   $0x4,(%esi)
+}
+     a2f:	89 d8                	mov    %ebx,%eax
+  cmd->right = right;
+     a31:	89 7e 08             	mov    %edi,0x8(%esi)
+}
+     a34:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     a37:	5b                   	pop    %ebx
+     a38:	5e                   	pop    %esi
+     a39:	5f                   	pop    %edi
+     a3a:	5d                   	pop    %ebp
+     a3b:	c3                   	ret
+     a3c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000a40 <parseblock>:
+{
+     a40:	55                   	push   %ebp
+     a41:	89 e5                	mov    %esp,%ebp
+     a43:	57                   	push   %edi
+     a44:	56                   	push   %esi
+     a45:	53                   	push   %ebx
+     a46:	83 ec 10             	sub    $0x10,%esp
+     a49:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     a4c:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(!peek(ps, es, "("))
+     a4f:	68 6c 13 00 00       	push   $0x136c
+     a54:	56                   	push   %esi
+     a55:	53                   	push   %ebx
+     a56:	e8 95 fb ff ff       	call   5f0 <peek>
+     a5b:	83 c4 10             	add    $0x10,%esp
+     a5e:	85 c0                	test   %eax,%eax
+     a60:	74 4a                	je     aac <parseblock+0x6c>
+  gettoken(ps, es, 0, 0);
+     a62:	6a 00                	push   $0x0
+     a64:	6a 00                	push   $0x0
+     a66:	56                   	push   %esi
+     a67:	53                   	push   %ebx
+     a68:	e8 13 fa ff ff       	call   480 <gettoken>
+  cmd = parseline(ps, es);
+     a6d:	58                   	pop    %eax
+     a6e:	5a                   	pop    %edx
+     a6f:	56                   	push   %esi
+     a70:	53                   	push   %ebx
+     a71:	e8 ea fe ff ff       	call   960 <parseline>
+  if(!peek(ps, es, ")"))
+     a76:	83 c4 0c             	add    $0xc,%esp
+     a79:	68 a8 13 00 00       	push   $0x13a8
+  cmd = parseline(ps, es);
+     a7e:	89 c7                	mov    %eax,%edi
+  if(!peek(ps, es, ")"))
+     a80:	56                   	push   %esi
+     a81:	53                   	push   %ebx
+     a82:	e8 69 fb ff ff       	call   5f0 <peek>
+     a87:	83 c4 10             	add    $0x10,%esp
+     a8a:	85 c0                	test   %eax,%eax
+     a8c:	74 2b                	je     ab9 <parseblock+0x79>
+  gettoken(ps, es, 0, 0);
+     a8e:	6a 00                	push   $0x0
+     a90:	6a 00                	push   $0x0
+     a92:	56                   	push   %esi
+     a93:	53                   	push   %ebx
+     a94:	e8 e7 f9 ff ff       	call   480 <gettoken>
+  cmd = parseredirs(cmd, ps, es);
+     a99:	83 c4 0c             	add    $0xc,%esp
+     a9c:	56                   	push   %esi
+     a9d:	53                   	push   %ebx
+     a9e:	57                   	push   %edi
+     a9f:	e8 cc fb ff ff       	call   670 <parseredirs>
+}
+     aa4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     aa7:	5b                   	pop    %ebx
+     aa8:	5e                   	pop    %esi
+     aa9:	5f                   	pop    %edi
+     aaa:	5d                   	pop    %ebp
+     aab:	c3                   	ret
+    panic("parseblock");
+     aac:	83 ec 0c             	sub    $0xc,%esp
+     aaf:	68 8c 13 00 00       	push   $0x138c
+     ab4:	e8 c7 f6 ff ff       	call   180 <panic>
+    panic("syntax - missing )");
+     ab9:	83 ec 0c             	sub    $0xc,%esp
+     abc:	68 97 13 00 00       	push   $0x1397
+     ac1:	e8 ba f6 ff ff       	call   180 <panic>
+     ac6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     acd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000ad0 <nulterminate>:
+
+// NUL-terminate all the counted strings.
+struct cmd*
+nulterminate(struct cmd *cmd)
+{
+     ad0:	55                   	push   %ebp
+     ad1:	89 e5                	mov    %esp,%ebp
+     ad3:	53                   	push   %ebx
+     ad4:	83 ec 04             	sub    $0x4,%esp
+     ad7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  struct execcmd *ecmd;
+  struct listcmd *lcmd;
+  struct pipecmd *pcmd;
+  struct redircmd *rcmd;
+
+  if(cmd == 0)
+     ada:	85 db                	test   %ebx,%ebx
+     adc:	0f 84 7e 00 00 00    	je     b60 <nulterminate+0x90>
+    return 0;
+
+  switch(cmd->type){
+     ae2:	83 3b 05             	cmpl   $0x5,(%ebx)
+     ae5:	77 20                	ja     b07 <nulterminate+0x37>
+     ae7:	8b 03                	mov    (%ebx),%eax
+     ae9:	ff 24 85 e8 13 00 00 	jmp    *0x13e8(,%eax,4)
+    nulterminate(pcmd->right);
+    break;
+
+  case LIST:
+    lcmd = (struct listcmd*)cmd;
+    nulterminate(lcmd->left);
+     af0:	83 ec 0c             	sub    $0xc,%esp
+     af3:	ff 73 04             	push   0x4(%ebx)
+     af6:	e8 d5 ff ff ff       	call   ad0 <nulterminate>
+    nulterminate(lcmd->right);
+     afb:	58                   	pop    %eax
+     afc:	ff 73 08             	push   0x8(%ebx)
+     aff:	e8 cc ff ff ff       	call   ad0 <nulterminate>
+    break;
+     b04:	83 c4 10             	add    $0x10,%esp
+    return 0;
+     b07:	89 d8                	mov    %ebx,%eax
+    bcmd = (struct backcmd*)cmd;
+    nulterminate(bcmd->cmd);
+    break;
+  }
+  return cmd;
+}
+     b09:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     b0c:	c9                   	leave
+     b0d:	c3                   	ret
+     b0e:	66 90                	xchg   %ax,%ax
+    nulterminate(bcmd->cmd);
+     b10:	83 ec 0c             	sub    $0xc,%esp
+     b13:	ff 73 04             	push   0x4(%ebx)
+     b16:	e8 b5 ff ff ff       	call   ad0 <nulterminate>
+    break;
+     b1b:	83 c4 10             	add    $0x10,%esp
+     b1e:	eb e7                	jmp    b07 <nulterminate+0x37>
+    for(i=0; ecmd->argv[i]; i++)
+     b20:	8b 4b 04             	mov    0x4(%ebx),%ecx
+     b23:	8d 43 08             	lea    0x8(%ebx),%eax
+     b26:	85 c9                	test   %ecx,%ecx
+     b28:	74 dd                	je     b07 <nulterminate+0x37>
+     b2a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      *ecmd->eargv[i] = 0;
+     b30:	8b 50 24             	mov    0x24(%eax),%edx
+    for(i=0; ecmd->argv[i]; i++)
+     b33:	83 c0 04             	add    $0x4,%eax
+      *ecmd->eargv[i] = 0;
+     b36:	c6 02 00             	movb   $0x0,(%edx)
+    for(i=0; ecmd->argv[i]; i++)
+     b39:	8b 50 fc             	mov    -0x4(%eax),%edx
+     b3c:	85 d2                	test   %edx,%edx
+     b3e:	75 f0                	jne    b30 <nulterminate+0x60>
+     b40:	eb c5                	jmp    b07 <nulterminate+0x37>
+     b42:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    nulterminate(rcmd->cmd);
+     b48:	83 ec 0c             	sub    $0xc,%esp
+     b4b:	ff 73 04             	push   0x4(%ebx)
+     b4e:	e8 7d ff ff ff       	call   ad0 <nulterminate>
+    *rcmd->efile = 0;
+     b53:	8b 43 0c             	mov    0xc(%ebx),%eax
+    break;
+     b56:	83 c4 10             	add    $0x10,%esp
+    *rcmd->efile = 0;
+     b59:	c6 00 00             	movb   $0x0,(%eax)
+    break;
+     b5c:	eb a9                	jmp    b07 <nulterminate+0x37>
+     b5e:	66 90                	xchg   %ax,%ax
+    return 0;
+     b60:	31 c0                	xor    %eax,%eax
+     b62:	eb a5                	jmp    b09 <nulterminate+0x39>
+     b64:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     b6b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     b6f:	90                   	nop
+
+00000b70 <parsecmd>:
+{
+     b70:	55                   	push   %ebp
+     b71:	89 e5                	mov    %esp,%ebp
+     b73:	57                   	push   %edi
+     b74:	56                   	push   %esi
+  cmd = parseline(&s, es);
+     b75:	8d 7d 08             	lea    0x8(%ebp),%edi
+{
+     b78:	53                   	push   %ebx
+     b79:	83 ec 18             	sub    $0x18,%esp
+  es = s + strlen(s);
+     b7c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     b7f:	53                   	push   %ebx
+     b80:	e8 eb 00 00 00       	call   c70 <strlen>
+  cmd = parseline(&s, es);
+     b85:	59                   	pop    %ecx
+     b86:	5e                   	pop    %esi
+  es = s + strlen(s);
+     b87:	01 c3                	add    %eax,%ebx
+  cmd = parseline(&s, es);
+     b89:	53                   	push   %ebx
+     b8a:	57                   	push   %edi
+     b8b:	e8 d0 fd ff ff       	call   960 <parseline>
+  peek(&s, es, "");
+     b90:	83 c4 0c             	add    $0xc,%esp
+     b93:	68 36 13 00 00       	push   $0x1336
+  cmd = parseline(&s, es);
+     b98:	89 c6                	mov    %eax,%esi
+  peek(&s, es, "");
+     b9a:	53                   	push   %ebx
+     b9b:	57                   	push   %edi
+     b9c:	e8 4f fa ff ff       	call   5f0 <peek>
+  if(s != es){
+     ba1:	8b 45 08             	mov    0x8(%ebp),%eax
+     ba4:	83 c4 10             	add    $0x10,%esp
+     ba7:	39 d8                	cmp    %ebx,%eax
+     ba9:	75 13                	jne    bbe <parsecmd+0x4e>
+  nulterminate(cmd);
+     bab:	83 ec 0c             	sub    $0xc,%esp
+     bae:	56                   	push   %esi
+     baf:	e8 1c ff ff ff       	call   ad0 <nulterminate>
+}
+     bb4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     bb7:	89 f0                	mov    %esi,%eax
+     bb9:	5b                   	pop    %ebx
+     bba:	5e                   	pop    %esi
+     bbb:	5f                   	pop    %edi
+     bbc:	5d                   	pop    %ebp
+     bbd:	c3                   	ret
+    printf(2, "leftovers: %s\n", s);
+     bbe:	52                   	push   %edx
+     bbf:	50                   	push   %eax
+     bc0:	68 aa 13 00 00       	push   $0x13aa
+     bc5:	6a 02                	push   $0x2
+     bc7:	e8 24 04 00 00       	call   ff0 <printf>
+    panic("syntax");
+     bcc:	c7 04 24 6e 13 00 00 	movl   $0x136e,(%esp)
+     bd3:	e8 a8 f5 ff ff       	call   180 <panic>
+     bd8:	66 90                	xchg   %ax,%ax
+     bda:	66 90                	xchg   %ax,%ax
+     bdc:	66 90                	xchg   %ax,%ax
+     bde:	66 90                	xchg   %ax,%ax
+
+00000be0 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+     be0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+     be1:	31 c0                	xor    %eax,%eax
+{
+     be3:	89 e5                	mov    %esp,%ebp
+     be5:	53                   	push   %ebx
+     be6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     be9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     bec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+     bf0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+     bf4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+     bf7:	83 c0 01             	add    $0x1,%eax
+     bfa:	84 d2                	test   %dl,%dl
+     bfc:	75 f2                	jne    bf0 <strcpy+0x10>
+    ;
+  return os;
+}
+     bfe:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     c01:	89 c8                	mov    %ecx,%eax
+     c03:	c9                   	leave
+     c04:	c3                   	ret
+     c05:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     c0c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000c10 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+     c10:	55                   	push   %ebp
+     c11:	89 e5                	mov    %esp,%ebp
+     c13:	53                   	push   %ebx
+     c14:	8b 55 08             	mov    0x8(%ebp),%edx
+     c17:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+     c1a:	0f b6 02             	movzbl (%edx),%eax
+     c1d:	84 c0                	test   %al,%al
+     c1f:	75 17                	jne    c38 <strcmp+0x28>
+     c21:	eb 3a                	jmp    c5d <strcmp+0x4d>
+     c23:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     c27:	90                   	nop
+     c28:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+     c2c:	83 c2 01             	add    $0x1,%edx
+     c2f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+     c32:	84 c0                	test   %al,%al
+     c34:	74 1a                	je     c50 <strcmp+0x40>
+    p++, q++;
+     c36:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+     c38:	0f b6 19             	movzbl (%ecx),%ebx
+     c3b:	38 c3                	cmp    %al,%bl
+     c3d:	74 e9                	je     c28 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+     c3f:	29 d8                	sub    %ebx,%eax
+}
+     c41:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     c44:	c9                   	leave
+     c45:	c3                   	ret
+     c46:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     c4d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+     c50:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+     c54:	31 c0                	xor    %eax,%eax
+     c56:	29 d8                	sub    %ebx,%eax
+}
+     c58:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     c5b:	c9                   	leave
+     c5c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+     c5d:	0f b6 19             	movzbl (%ecx),%ebx
+     c60:	31 c0                	xor    %eax,%eax
+     c62:	eb db                	jmp    c3f <strcmp+0x2f>
+     c64:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     c6b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     c6f:	90                   	nop
+
+00000c70 <strlen>:
+
+uint
+strlen(const char *s)
+{
+     c70:	55                   	push   %ebp
+     c71:	89 e5                	mov    %esp,%ebp
+     c73:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+     c76:	80 3a 00             	cmpb   $0x0,(%edx)
+     c79:	74 15                	je     c90 <strlen+0x20>
+     c7b:	31 c0                	xor    %eax,%eax
+     c7d:	8d 76 00             	lea    0x0(%esi),%esi
+     c80:	83 c0 01             	add    $0x1,%eax
+     c83:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+     c87:	89 c1                	mov    %eax,%ecx
+     c89:	75 f5                	jne    c80 <strlen+0x10>
+    ;
+  return n;
+}
+     c8b:	89 c8                	mov    %ecx,%eax
+     c8d:	5d                   	pop    %ebp
+     c8e:	c3                   	ret
+     c8f:	90                   	nop
+  for(n = 0; s[n]; n++)
+     c90:	31 c9                	xor    %ecx,%ecx
+}
+     c92:	5d                   	pop    %ebp
+     c93:	89 c8                	mov    %ecx,%eax
+     c95:	c3                   	ret
+     c96:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     c9d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000ca0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+     ca0:	55                   	push   %ebp
+     ca1:	89 e5                	mov    %esp,%ebp
+     ca3:	57                   	push   %edi
+     ca4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+     ca7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     caa:	8b 45 0c             	mov    0xc(%ebp),%eax
+     cad:	89 d7                	mov    %edx,%edi
+     caf:	fc                   	cld
+     cb0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+     cb2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+     cb5:	89 d0                	mov    %edx,%eax
+     cb7:	c9                   	leave
+     cb8:	c3                   	ret
+     cb9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000cc0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+     cc0:	55                   	push   %ebp
+     cc1:	89 e5                	mov    %esp,%ebp
+     cc3:	8b 45 08             	mov    0x8(%ebp),%eax
+     cc6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+     cca:	0f b6 10             	movzbl (%eax),%edx
+     ccd:	84 d2                	test   %dl,%dl
+     ccf:	75 12                	jne    ce3 <strchr+0x23>
+     cd1:	eb 1d                	jmp    cf0 <strchr+0x30>
+     cd3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     cd7:	90                   	nop
+     cd8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+     cdc:	83 c0 01             	add    $0x1,%eax
+     cdf:	84 d2                	test   %dl,%dl
+     ce1:	74 0d                	je     cf0 <strchr+0x30>
+    if(*s == c)
+     ce3:	38 d1                	cmp    %dl,%cl
+     ce5:	75 f1                	jne    cd8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+     ce7:	5d                   	pop    %ebp
+     ce8:	c3                   	ret
+     ce9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+     cf0:	31 c0                	xor    %eax,%eax
+}
+     cf2:	5d                   	pop    %ebp
+     cf3:	c3                   	ret
+     cf4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     cfb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     cff:	90                   	nop
+
+00000d00 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+     d00:	55                   	push   %ebp
+     d01:	89 e5                	mov    %esp,%ebp
+     d03:	57                   	push   %edi
+     d04:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+     d05:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+     d08:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+     d09:	31 db                	xor    %ebx,%ebx
+{
+     d0b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+     d0e:	eb 27                	jmp    d37 <gets+0x37>
+    cc = read(0, &c, 1);
+     d10:	83 ec 04             	sub    $0x4,%esp
+     d13:	6a 01                	push   $0x1
+     d15:	56                   	push   %esi
+     d16:	6a 00                	push   $0x0
+     d18:	e8 1e 01 00 00       	call   e3b <read>
+    if(cc < 1)
+     d1d:	83 c4 10             	add    $0x10,%esp
+     d20:	85 c0                	test   %eax,%eax
+     d22:	7e 1d                	jle    d41 <gets+0x41>
+      break;
+    buf[i++] = c;
+     d24:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+     d28:	8b 55 08             	mov    0x8(%ebp),%edx
+     d2b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+     d2f:	3c 0a                	cmp    $0xa,%al
+     d31:	74 10                	je     d43 <gets+0x43>
+     d33:	3c 0d                	cmp    $0xd,%al
+     d35:	74 0c                	je     d43 <gets+0x43>
+  for(i=0; i+1 < max; ){
+     d37:	89 df                	mov    %ebx,%edi
+     d39:	83 c3 01             	add    $0x1,%ebx
+     d3c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+     d3f:	7c cf                	jl     d10 <gets+0x10>
+     d41:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+     d43:	8b 45 08             	mov    0x8(%ebp),%eax
+     d46:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+     d4a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     d4d:	5b                   	pop    %ebx
+     d4e:	5e                   	pop    %esi
+     d4f:	5f                   	pop    %edi
+     d50:	5d                   	pop    %ebp
+     d51:	c3                   	ret
+     d52:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     d59:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000d60 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+     d60:	55                   	push   %ebp
+     d61:	89 e5                	mov    %esp,%ebp
+     d63:	56                   	push   %esi
+     d64:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+     d65:	83 ec 08             	sub    $0x8,%esp
+     d68:	6a 00                	push   $0x0
+     d6a:	ff 75 08             	push   0x8(%ebp)
+     d6d:	e8 f1 00 00 00       	call   e63 <open>
+  if(fd < 0)
+     d72:	83 c4 10             	add    $0x10,%esp
+     d75:	85 c0                	test   %eax,%eax
+     d77:	78 27                	js     da0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+     d79:	83 ec 08             	sub    $0x8,%esp
+     d7c:	ff 75 0c             	push   0xc(%ebp)
+     d7f:	89 c3                	mov    %eax,%ebx
+     d81:	50                   	push   %eax
+     d82:	e8 f4 00 00 00       	call   e7b <fstat>
+  close(fd);
+     d87:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+     d8a:	89 c6                	mov    %eax,%esi
+  close(fd);
+     d8c:	e8 ba 00 00 00       	call   e4b <close>
+  return r;
+     d91:	83 c4 10             	add    $0x10,%esp
+}
+     d94:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     d97:	89 f0                	mov    %esi,%eax
+     d99:	5b                   	pop    %ebx
+     d9a:	5e                   	pop    %esi
+     d9b:	5d                   	pop    %ebp
+     d9c:	c3                   	ret
+     d9d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+     da0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     da5:	eb ed                	jmp    d94 <stat+0x34>
+     da7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     dae:	66 90                	xchg   %ax,%ax
+
+00000db0 <atoi>:
+
+int
+atoi(const char *s)
+{
+     db0:	55                   	push   %ebp
+     db1:	89 e5                	mov    %esp,%ebp
+     db3:	53                   	push   %ebx
+     db4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+     db7:	0f be 02             	movsbl (%edx),%eax
+     dba:	8d 48 d0             	lea    -0x30(%eax),%ecx
+     dbd:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+     dc0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+     dc5:	77 1e                	ja     de5 <atoi+0x35>
+     dc7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     dce:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+     dd0:	83 c2 01             	add    $0x1,%edx
+     dd3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+     dd6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+     dda:	0f be 02             	movsbl (%edx),%eax
+     ddd:	8d 58 d0             	lea    -0x30(%eax),%ebx
+     de0:	80 fb 09             	cmp    $0x9,%bl
+     de3:	76 eb                	jbe    dd0 <atoi+0x20>
+  return n;
+}
+     de5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     de8:	89 c8                	mov    %ecx,%eax
+     dea:	c9                   	leave
+     deb:	c3                   	ret
+     dec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000df0 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+     df0:	55                   	push   %ebp
+     df1:	89 e5                	mov    %esp,%ebp
+     df3:	57                   	push   %edi
+     df4:	56                   	push   %esi
+     df5:	8b 45 10             	mov    0x10(%ebp),%eax
+     df8:	8b 55 08             	mov    0x8(%ebp),%edx
+     dfb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+     dfe:	85 c0                	test   %eax,%eax
+     e00:	7e 13                	jle    e15 <memmove+0x25>
+     e02:	01 d0                	add    %edx,%eax
+  dst = vdst;
+     e04:	89 d7                	mov    %edx,%edi
+     e06:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     e0d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+     e10:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+     e11:	39 f8                	cmp    %edi,%eax
+     e13:	75 fb                	jne    e10 <memmove+0x20>
+  return vdst;
+}
+     e15:	5e                   	pop    %esi
+     e16:	89 d0                	mov    %edx,%eax
+     e18:	5f                   	pop    %edi
+     e19:	5d                   	pop    %ebp
+     e1a:	c3                   	ret
+
+00000e1b <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+     e1b:	b8 01 00 00 00       	mov    $0x1,%eax
+     e20:	cd 40                	int    $0x40
+     e22:	c3                   	ret
+
+00000e23 <exit>:
+SYSCALL(exit)
+     e23:	b8 02 00 00 00       	mov    $0x2,%eax
+     e28:	cd 40                	int    $0x40
+     e2a:	c3                   	ret
+
+00000e2b <wait>:
+SYSCALL(wait)
+     e2b:	b8 03 00 00 00       	mov    $0x3,%eax
+     e30:	cd 40                	int    $0x40
+     e32:	c3                   	ret
+
+00000e33 <pipe>:
+SYSCALL(pipe)
+     e33:	b8 04 00 00 00       	mov    $0x4,%eax
+     e38:	cd 40                	int    $0x40
+     e3a:	c3                   	ret
+
+00000e3b <read>:
+SYSCALL(read)
+     e3b:	b8 05 00 00 00       	mov    $0x5,%eax
+     e40:	cd 40                	int    $0x40
+     e42:	c3                   	ret
+
+00000e43 <write>:
+SYSCALL(write)
+     e43:	b8 10 00 00 00       	mov    $0x10,%eax
+     e48:	cd 40                	int    $0x40
+     e4a:	c3                   	ret
+
+00000e4b <close>:
+SYSCALL(close)
+     e4b:	b8 15 00 00 00       	mov    $0x15,%eax
+     e50:	cd 40                	int    $0x40
+     e52:	c3                   	ret
+
+00000e53 <kill>:
+SYSCALL(kill)
+     e53:	b8 06 00 00 00       	mov    $0x6,%eax
+     e58:	cd 40                	int    $0x40
+     e5a:	c3                   	ret
+
+00000e5b <exec>:
+SYSCALL(exec)
+     e5b:	b8 07 00 00 00       	mov    $0x7,%eax
+     e60:	cd 40                	int    $0x40
+     e62:	c3                   	ret
+
+00000e63 <open>:
+SYSCALL(open)
+     e63:	b8 0f 00 00 00       	mov    $0xf,%eax
+     e68:	cd 40                	int    $0x40
+     e6a:	c3                   	ret
+
+00000e6b <mknod>:
+SYSCALL(mknod)
+     e6b:	b8 11 00 00 00       	mov    $0x11,%eax
+     e70:	cd 40                	int    $0x40
+     e72:	c3                   	ret
+
+00000e73 <unlink>:
+SYSCALL(unlink)
+     e73:	b8 12 00 00 00       	mov    $0x12,%eax
+     e78:	cd 40                	int    $0x40
+     e7a:	c3                   	ret
+
+00000e7b <fstat>:
+SYSCALL(fstat)
+     e7b:	b8 08 00 00 00       	mov    $0x8,%eax
+     e80:	cd 40                	int    $0x40
+     e82:	c3                   	ret
+
+00000e83 <link>:
+SYSCALL(link)
+     e83:	b8 13 00 00 00       	mov    $0x13,%eax
+     e88:	cd 40                	int    $0x40
+     e8a:	c3                   	ret
+
+00000e8b <mkdir>:
+SYSCALL(mkdir)
+     e8b:	b8 14 00 00 00       	mov    $0x14,%eax
+     e90:	cd 40                	int    $0x40
+     e92:	c3                   	ret
+
+00000e93 <chdir>:
+SYSCALL(chdir)
+     e93:	b8 09 00 00 00       	mov    $0x9,%eax
+     e98:	cd 40                	int    $0x40
+     e9a:	c3                   	ret
+
+00000e9b <dup>:
+SYSCALL(dup)
+     e9b:	b8 0a 00 00 00       	mov    $0xa,%eax
+     ea0:	cd 40                	int    $0x40
+     ea2:	c3                   	ret
+
+00000ea3 <getpid>:
+SYSCALL(getpid)
+     ea3:	b8 0b 00 00 00       	mov    $0xb,%eax
+     ea8:	cd 40                	int    $0x40
+     eaa:	c3                   	ret
+
+00000eab <sbrk>:
+SYSCALL(sbrk)
+     eab:	b8 0c 00 00 00       	mov    $0xc,%eax
+     eb0:	cd 40                	int    $0x40
+     eb2:	c3                   	ret
+
+00000eb3 <sleep>:
+SYSCALL(sleep)
+     eb3:	b8 0d 00 00 00       	mov    $0xd,%eax
+     eb8:	cd 40                	int    $0x40
+     eba:	c3                   	ret
+
+00000ebb <uptime>:
+SYSCALL(uptime)
+     ebb:	b8 0e 00 00 00       	mov    $0xe,%eax
+     ec0:	cd 40                	int    $0x40
+     ec2:	c3                   	ret
+
+00000ec3 <setTicket>:
+SYSCALL(setTicket)
+     ec3:	b8 16 00 00 00       	mov    $0x16,%eax
+     ec8:	cd 40                	int    $0x40
+     eca:	c3                   	ret
+
+00000ecb <changeQueue>:
+SYSCALL(changeQueue)
+     ecb:	b8 17 00 00 00       	mov    $0x17,%eax
+     ed0:	cd 40                	int    $0x40
+     ed2:	c3                   	ret
+
+00000ed3 <setLotteryTicket>:
+SYSCALL(setLotteryTicket)
+     ed3:	b8 18 00 00 00       	mov    $0x18,%eax
+     ed8:	cd 40                	int    $0x40
+     eda:	c3                   	ret
+
+00000edb <setSRPFPriority>:
+SYSCALL(setSRPFPriority)
+     edb:	b8 19 00 00 00       	mov    $0x19,%eax
+     ee0:	cd 40                	int    $0x40
+     ee2:	c3                   	ret
+
+00000ee3 <printInfo>:
+SYSCALL(printInfo)
+     ee3:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     ee8:	cd 40                	int    $0x40
+     eea:	c3                   	ret
+
+00000eeb <configQueues>:
+SYSCALL(configQueues)
+     eeb:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     ef0:	cd 40                	int    $0x40
+     ef2:	c3                   	ret
+
+00000ef3 <setQuantum>:
+SYSCALL(setQuantum)
+     ef3:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     ef8:	cd 40                	int    $0x40
+     efa:	c3                   	ret
+
+00000efb <getSchedStat>:
+SYSCALL(getSchedStat)
+     efb:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     f00:	cd 40                	int    $0x40
+     f02:	c3                   	ret
+
+00000f03 <schedTrace>:
+SYSCALL(schedTrace)
+     f03:	b8 1e 00 00 00       	mov    $0x1e,%eax
+     f08:	cd 40                	int    $0x40
+     f0a:	c3                   	ret
+
+00000f0b <schedSeed>:
+SYSCALL(schedSeed)
+     f0b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     f10:	cd 40                	int    $0x40
+     f12:	c3                   	ret
+
+00000f13 <setSchedAttr>:
+SYSCALL(setSchedAttr)
+     f13:	b8 20 00 00 00       	mov    $0x20,%eax
+     f18:	cd 40                	int    $0x40
+     f1a:	c3                   	ret
+
+00000f1b <getSchedAttr>:
+SYSCALL(getSchedAttr)
+     f1b:	b8 21 00 00 00       	mov    $0x21,%eax
+     f20:	cd 40                	int    $0x40
+     f22:	c3                   	ret
+
+00000f23 <setAffinity>:
+SYSCALL(setAffinity)
+     f23:	b8 22 00 00 00       	mov    $0x22,%eax
+     f28:	cd 40                	int    $0x40
+     f2a:	c3                   	ret
+
+00000f2b <getAffinity>:
+SYSCALL(getAffinity)
+     f2b:	b8 23 00 00 00       	mov    $0x23,%eax
+     f30:	cd 40                	int    $0x40
+     f32:	c3                   	ret
+
+00000f33 <gangJoin>:
+SYSCALL(gangJoin)
+     f33:	b8 24 00 00 00       	mov    $0x24,%eax
+     f38:	cd 40                	int    $0x40
+     f3a:	c3                   	ret
+
+00000f3b <setRealtime>:
+SYSCALL(setRealtime)
+     f3b:	b8 25 00 00 00       	mov    $0x25,%eax
+     f40:	cd 40                	int    $0x40
+     f42:	c3                   	ret
+     f43:	66 90                	xchg   %ax,%ax
+     f45:	66 90                	xchg   %ax,%ax
+     f47:	66 90                	xchg   %ax,%ax
+     f49:	66 90                	xchg   %ax,%ax
+     f4b:	66 90                	xchg   %ax,%ax
+     f4d:	66 90                	xchg   %ax,%ax
+     f4f:	90                   	nop
+
+00000f50 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+     f50:	55                   	push   %ebp
+     f51:	89 e5                	mov    %esp,%ebp
+     f53:	57                   	push   %edi
+     f54:	56                   	push   %esi
+     f55:	53                   	push   %ebx
+     f56:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+     f58:	89 d1                	mov    %edx,%ecx
+{
+     f5a:	83 ec 3c             	sub    $0x3c,%esp
+     f5d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+     f60:	85 d2                	test   %edx,%edx
+     f62:	0f 89 80 00 00 00    	jns    fe8 <printint+0x98>
+     f68:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+     f6c:	74 7a                	je     fe8 <printint+0x98>
+    x = -xx;
+     f6e:	f7 d9                	neg    %ecx
+    neg = 1;
+     f70:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+     f75:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+     f78:	31 f6                	xor    %esi,%esi
+     f7a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+     f80:	89 c8                	mov    %ecx,%eax
+     f82:	31 d2                	xor    %edx,%edx
+     f84:	89 f7                	mov    %esi,%edi
+     f86:	f7 f3                	div    %ebx
+     f88:	8d 76 01             	lea    0x1(%esi),%esi
+     f8b:	0f b6 92 60 14 00 00 	movzbl 0x1460(%edx),%edx
+     f92:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+     f96:	89 ca                	mov    %ecx,%edx
+     f98:	89 c1                	mov    %eax,%ecx
+     f9a:	39 da                	cmp    %ebx,%edx
+     f9c:	73 e2                	jae    f80 <printint+0x30>
+  if(neg)
+     f9e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+     fa1:	85 c0                	test   %eax,%eax
+     fa3:	74 07                	je     fac <printint+0x5c>
+    buf[i++] = '-';
+     fa5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+     faa:	89 f7                	mov    %esi,%edi
+     fac:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+     faf:	8b 75 c0             	mov    -0x40(%ebp),%esi
+     fb2:	01 df                	add    %ebx,%edi
+     fb4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+     fb8:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+     fbb:	83 ec 04             	sub    $0x4,%esp
+     fbe:	88 45 d7             	mov    %al,-0x29(%ebp)
+     fc1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+     fc4:	6a 01                	push   $0x1
+     fc6:	50                   	push   %eax
+     fc7:	56                   	push   %esi
+     fc8:	e8 76 fe ff ff       	call   e43 <write>
+  while(--i >= 0)
+     fcd:	89 f8                	mov    %edi,%eax
+     fcf:	83 c4 10             	add    $0x10,%esp
+     fd2:	83 ef 01             	sub    $0x1,%edi
+     fd5:	39 d8                	cmp    %ebx,%eax
+     fd7:	75 df                	jne    fb8 <printint+0x68>
+}
+     fd9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     fdc:	5b                   	pop    %ebx
+     fdd:	5e                   	pop    %esi
+     fde:	5f                   	pop    %edi
+     fdf:	5d                   	pop    %ebp
+     fe0:	c3                   	ret
+     fe1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+     fe8:	31 c0                	xor    %eax,%eax
+     fea:	eb 89                	jmp    f75 <printint+0x25>
+     fec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000ff0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+     ff0:	55                   	push   %ebp
+     ff1:	89 e5                	mov    %esp,%ebp
+     ff3:	57                   	push   %edi
+     ff4:	56                   	push   %esi
+     ff5:	53                   	push   %ebx
+     ff6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+     ff9:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+     ffc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+     fff:	0f b6 1e             	movzbl (%esi),%ebx
+    1002:	83 c6 01             	add    $0x1,%esi
+    1005:	84 db                	test   %bl,%bl
+    1007:	74 67                	je     1070 <printf+0x80>
+    1009:	8d 4d 10             	lea    0x10(%ebp),%ecx
+    100c:	31 d2                	xor    %edx,%edx
+    100e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+    1011:	eb 34                	jmp    1047 <printf+0x57>
+    1013:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1017:	90                   	nop
+    1018:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+    101b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+    1020:	83 f8 25             	cmp    $0x25,%eax
+    1023:	74 18                	je     103d <printf+0x4d>
+  write(fd, &c, 1);
+    1025:	83 ec 04             	sub    $0x4,%esp
+    1028:	8d 45 e7             	lea    -0x19(%ebp),%eax
+    102b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    102e:	6a 01                	push   $0x1
+    1030:	50                   	push   %eax
+    1031:	57                   	push   %edi
+    1032:	e8 0c fe ff ff       	call   e43 <write>
+    1037:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+    103a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+    103d:	0f b6 1e             	movzbl (%esi),%ebx
+    1040:	83 c6 01             	add    $0x1,%esi
+    1043:	84 db                	test   %bl,%bl
+    1045:	74 29                	je     1070 <printf+0x80>
+    c = fmt[i] & 0xff;
+    1047:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+    104a:	85 d2                	test   %edx,%edx
+    104c:	74 ca                	je     1018 <printf+0x28>
+      }
+    } else if(state == '%'){
+    104e:	83 fa 25             	cmp    $0x25,%edx
+    1051:	75 ea                	jne    103d <printf+0x4d>
+      if(c == 'd'){
+    1053:	83 f8 25             	cmp    $0x25,%eax
+    1056:	0f 84 24 01 00 00    	je     1180 <printf+0x190>
+    105c:	83 e8 63             	sub    $0x63,%eax
+    105f:	83 f8 15             	cmp    $0x15,%eax
+    1062:	77 1c                	ja     1080 <printf+0x90>
+    1064:	ff 24 85 08 14 00 00 	jmp    *0x1408(,%eax,4)
+    106b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    106f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+    1070:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1073:	5b                   	pop    %ebx
+    1074:	5e                   	pop    %esi
+    1075:	5f                   	pop    %edi
+    1076:	5d                   	pop    %ebp
+    1077:	c3                   	ret
+    1078:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    107f:	90                   	nop
+  write(fd, &c, 1);
+    1080:	83 ec 04             	sub    $0x4,%esp
+    1083:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    1086:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+    108a:	6a 01                	push   $0x1
+    108c:	52                   	push   %edx
+    108d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    1090:	57                   	push   %edi
+    1091:	e8 ad fd ff ff       	call   e43 <write>
+    1096:	83 c4 0c             	add    $0xc,%esp
+    1099:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    109c:	6a 01                	push   $0x1
+    109e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+    10a1:	52                   	push   %edx
+    10a2:	57                   	push   %edi
+    10a3:	e8 9b fd ff ff       	call   e43 <write>
+        putc(fd, c);
+    10a8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    10ab:	31 d2                	xor    %edx,%edx
+    10ad:	eb 8e                	jmp    103d <printf+0x4d>
+    10af:	90                   	nop
+        printint(fd, *ap, 16, 0);
+    10b0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    10b3:	83 ec 0c             	sub    $0xc,%esp
+    10b6:	b9 10 00 00 00       	mov    $0x10,%ecx
+    10bb:	8b 13                	mov    (%ebx),%edx
+    10bd:	6a 00                	push   $0x0
+    10bf:	89 f8                	mov    %edi,%eax
+        ap++;
+    10c1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+    10c4:	e8 87 fe ff ff       	call   f50 <printint>
+        ap++;
+    10c9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    10cc:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    10cf:	31 d2                	xor    %edx,%edx
+    10d1:	e9 67 ff ff ff       	jmp    103d <printf+0x4d>
+    10d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    10dd:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+    10e0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+    10e3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+    10e5:	83 c0 04             	add    $0x4,%eax
+    10e8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+    10eb:	85 db                	test   %ebx,%ebx
+    10ed:	0f 84 9d 00 00 00    	je     1190 <printf+0x1a0>
+        while(*s != 0){
+    10f3:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+    10f6:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+    10f8:	84 c0                	test   %al,%al
+    10fa:	0f 84 3d ff ff ff    	je     103d <printf+0x4d>
+    1100:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    1103:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+    1106:	89 de                	mov    %ebx,%esi
+    1108:	89 d3                	mov    %edx,%ebx
+    110a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+    1110:	83 ec 04             	sub    $0x4,%esp
+    1113:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+    1116:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+    1119:	6a 01                	push   $0x1
+    111b:	53                   	push   %ebx
+    111c:	57                   	push   %edi
+    111d:	e8 21 fd ff ff       	call   e43 <write>
+        while(*s != 0){
+    1122:	0f b6 06             	movzbl (%esi),%eax
+    1125:	83 c4 10             	add    $0x10,%esp
+    1128:	84 c0                	test   %al,%al
+    112a:	75 e4                	jne    1110 <printf+0x120>
+      state = 0;
+    112c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+    112f:	31 d2                	xor    %edx,%edx
+    1131:	e9 07 ff ff ff       	jmp    103d <printf+0x4d>
+    1136:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    113d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+    1140:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    1143:	83 ec 0c             	sub    $0xc,%esp
+    1146:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    114b:	8b 13                	mov    (%ebx),%edx
+    114d:	6a 01                	push   $0x1
+    114f:	e9 6b ff ff ff       	jmp    10bf <printf+0xcf>
+    1154:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+    1158:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+    115b:	83 ec 04             	sub    $0x4,%esp
+    115e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+    1161:	8b 03                	mov    (%ebx),%eax
+        ap++;
+    1163:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+    1166:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+    1169:	6a 01                	push   $0x1
+    116b:	52                   	push   %edx
+    116c:	57                   	push   %edi
+    116d:	e8 d1 fc ff ff       	call   e43 <write>
+        ap++;
+    1172:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    1175:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    1178:	31 d2                	xor    %edx,%edx
+    117a:	e9 be fe ff ff       	jmp    103d <printf+0x4d>
+    117f:	90                   	nop
+  write(fd, &c, 1);
+    1180:	83 ec 04             	sub    $0x4,%esp
+    1183:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    1186:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    1189:	6a 01                	push   $0x1
+    118b:	e9 11 ff ff ff       	jmp    10a1 <printf+0xb1>
+    1190:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+    1195:	bb 00 14 00 00       	mov    $0x1400,%ebx
+    119a:	e9 61 ff ff ff       	jmp    1100 <printf+0x110>
+    119f:	90                   	nop
+
+000011a0 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+    11a0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    11a1:	a1 84 1a 00 00       	mov    0x1a84,%eax
+{
+    11a6:	89 e5                	mov    %esp,%ebp
+    11a8:	57                   	push   %edi
+    11a9:	56                   	push   %esi
+    11aa:	53                   	push   %ebx
+    11ab:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+    11ae:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    11b1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    11b8:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    11ba:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    11bc:	39 ca                	cmp    %ecx,%edx
+    11be:	73 30                	jae    11f0 <free+0x50>
+    11c0:	39 c1                	cmp    %eax,%ecx
+    11c2:	72 04                	jb     11c8 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    11c4:	39 c2                	cmp    %eax,%edx
+    11c6:	72 f0                	jb     11b8 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    11c8:	8b 73 fc             	mov    -0x4(%ebx),%esi
+    11cb:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+    11ce:	39 f8                	cmp    %edi,%eax
+    11d0:	74 2e                	je     1200 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+    11d2:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+    11d5:	8b 42 04             	mov    0x4(%edx),%eax
+    11d8:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    11db:	39 f1                	cmp    %esi,%ecx
+    11dd:	74 38                	je     1217 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+    11df:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+    11e1:	5b                   	pop    %ebx
+  freep = p;
+    11e2:	89 15 84 1a 00 00    	mov    %edx,0x1a84
+}
+    11e8:	5e                   	pop    %esi
+    11e9:	5f                   	pop    %edi
+    11ea:	5d                   	pop    %ebp
+    11eb:	c3                   	ret
+    11ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    11f0:	39 c1                	cmp    %eax,%ecx
+    11f2:	72 d0                	jb     11c4 <free+0x24>
+    11f4:	eb c2                	jmp    11b8 <free+0x18>
+    11f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    11fd:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+    1200:	03 70 04             	add    0x4(%eax),%esi
+    1203:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    1206:	8b 02                	mov    (%edx),%eax
+    1208:	8b 00                	mov    (%eax),%eax
+    120a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+    120d:	8b 42 04             	mov    0x4(%edx),%eax
+    1210:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    1213:	39 f1                	cmp    %esi,%ecx
+    1215:	75 c8                	jne    11df <free+0x3f>
+    p->s.size += bp->s.size;
+    1217:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+    121a:	89 15 84 1a 00 00    	mov    %edx,0x1a84
+    p->s.size += bp->s.size;
+    1220:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+    1223:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+    1226:	89 0a                	mov    %ecx,(%edx)
+}
+    1228:	5b                   	pop    %ebx
+    1229:	5e                   	pop    %esi
+    122a:	5f                   	pop    %edi
+    122b:	5d                   	pop    %ebp
+    122c:	c3                   	ret
+    122d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001230 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+    1230:	55                   	push   %ebp
+    1231:	89 e5                	mov    %esp,%ebp
+    1233:	57                   	push   %edi
+    1234:	56                   	push   %esi
+    1235:	53                   	push   %ebx
+    1236:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    1239:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+    123c:	8b 15 84 1a 00 00    	mov    0x1a84,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    1242:	8d 78 07             	lea    0x7(%eax),%edi
+    1245:	c1 ef 03             	shr    $0x3,%edi
+    1248:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+    124b:	85 d2                	test   %edx,%edx
+    124d:	0f 84 8d 00 00 00    	je     12e0 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    1253:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    1255:	8b 48 04             	mov    0x4(%eax),%ecx
+    1258:	39 f9                	cmp    %edi,%ecx
+    125a:	73 64                	jae    12c0 <malloc+0x90>
+  if(nu < 4096)
+    125c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    1261:	39 df                	cmp    %ebx,%edi
+    1263:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+    1266:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+    126d:	eb 0a                	jmp    1279 <malloc+0x49>
+    126f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    1270:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    1272:	8b 48 04             	mov    0x4(%eax),%ecx
+    1275:	39 f9                	cmp    %edi,%ecx
+    1277:	73 47                	jae    12c0 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+    1279:	89 c2                	mov    %eax,%edx
+    127b:	39 05 84 1a 00 00    	cmp    %eax,0x1a84
+    1281:	75 ed                	jne    1270 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+    1283:	83 ec 0c             	sub    $0xc,%esp
+    1286:	56                   	push   %esi
+    1287:	e8 1f fc ff ff       	call   eab <sbrk>
+  if(p == (char*)-1)
+    128c:	83 c4 10             	add    $0x10,%esp
+    128f:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1292:	74 1c                	je     12b0 <malloc+0x80>
+  hp->s.size = nu;
+    1294:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+    1297:	83 ec 0c             	sub    $0xc,%esp
+    129a:	83 c0 08             	add    $0x8,%eax
+    129d:	50                   	push   %eax
+    129e:	e8 fd fe ff ff       	call   11a0 <free>
+  return freep;
+    12a3:	8b 15 84 1a 00 00    	mov    0x1a84,%edx
+      if((p = morecore(nunits)) == 0)
+    12a9:	83 c4 10             	add    $0x10,%esp
+    12ac:	85 d2                	test   %edx,%edx
+    12ae:	75 c0                	jne    1270 <malloc+0x40>
+        return 0;
+  }
+}
+    12b0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+    12b3:	31 c0                	xor    %eax,%eax
+}
+    12b5:	5b                   	pop    %ebx
+    12b6:	5e                   	pop    %esi
+    12b7:	5f                   	pop    %edi
+    12b8:	5d                   	pop    %ebp
+    12b9:	c3                   	ret
+    12ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+    12c0:	39 cf                	cmp    %ecx,%edi
+    12c2:	74 4c                	je     1310 <malloc+0xe0>
+        p->s.size -= nunits;
+    12c4:	29 f9                	sub    %edi,%ecx
+    12c6:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+    12c9:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+    12cc:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+    12cf:	89 15 84 1a 00 00    	mov    %edx,0x1a84
+}
+    12d5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+    12d8:	83 c0 08             	add    $0x8,%eax
+}
+    12db:	5b                   	pop    %ebx
+    12dc:	5e                   	pop    %esi
+    12dd:	5f                   	pop    %edi
+    12de:	5d                   	pop    %ebp
+    12df:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+    12e0:	c7 05 84 1a 00 00 88 	movl   $0x1a88,0x1a84
+    12e7:	1a 00 00 
+    base.s.size = 0;
+    12ea:	b8 88 1a 00 00       	mov    $0x1a88,%eax
+    base.s.ptr = freep = prevp = &base;
+    12ef:	c7 05 88 1a 00 00 88 	movl   $0x1a88,0x1a88
+    12f6:	1a 00 00 
+    base.s.size = 0;
+    12f9:	c7 05 8c 1a 00 00 00 	movl   $0x0,0x1a8c
+    1300:	00 00 00 
+    if(p->s.size >= nunits){
+    1303:	e9 54 ff ff ff       	jmp    125c <malloc+0x2c>
+    1308:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    130f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+    1310:	8b 08                	mov    (%eax),%ecx
+    1312:	89 0a                	mov    %ecx,(%edx)
+    1314:	eb b9                	jmp    12cf <malloc+0x9f>
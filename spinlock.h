@@ -1,3 +1,7 @@
+// Included by proc.h as well as directly, so guarded.
+#ifndef SPINLOCK_H
+#define SPINLOCK_H
+
 // Mutual exclusion lock.
 struct spinlock {
   uint locked;       // Is the lock held?
@@ -9,3 +13,5 @@ struct spinlock {
                      // that locked the lock.
 };
 
+
+#endif
@@ -108,6 +108,17 @@ extern int sys_changeQueue(void);
 extern int sys_setLotteryTicket(void);
 extern int sys_setSRPFPriority(void);
 extern int sys_printInfo(void);
+extern int sys_configQueues(void);
+extern int sys_setQuantum(void);
+extern int sys_getSchedStat(void);
+extern int sys_schedTrace(void);
+extern int sys_schedSeed(void);
+extern int sys_setSchedAttr(void);
+extern int sys_getSchedAttr(void);
+extern int sys_setAffinity(void);
+extern int sys_getAffinity(void);
+extern int sys_gangJoin(void);
+extern int sys_setRealtime(void);
 
 
 static int (*syscalls[])(void) = {
@@ -137,6 +148,17 @@ static int (*syscalls[])(void) = {
 [SYS_setLotteryTicket] sys_setLotteryTicket,
 [SYS_setSRPFPriority] sys_setSRPFPriority,
 [SYS_printInfo] sys_printInfo,
+[SYS_configQueues] sys_configQueues,
+[SYS_setQuantum] sys_setQuantum,
+[SYS_getSchedStat] sys_getSchedStat,
+[SYS_schedTrace] sys_schedTrace,
+[SYS_schedSeed] sys_schedSeed,
+[SYS_setSchedAttr] sys_setSchedAttr,
+[SYS_getSchedAttr] sys_getSchedAttr,
+[SYS_setAffinity] sys_setAffinity,
+[SYS_getAffinity] sys_getAffinity,
+[SYS_gangJoin] sys_gangJoin,
+[SYS_setRealtime] sys_setRealtime,
 };
 
 void
@@ -25,4 +25,14 @@
 #define SYS_setLotteryTicket 24
 #define SYS_setSRPFPriority 25
 #define SYS_printInfo 26
-#define SYS_floatToStr 27
\ No newline at end of file
+#define SYS_configQueues 27
+#define SYS_setQuantum 28
+#define SYS_getSchedStat 29
+#define SYS_schedTrace 30
+#define SYS_schedSeed 31
+#define SYS_setSchedAttr 32
+#define SYS_getSchedAttr 33
+#define SYS_setAffinity 34
+#define SYS_getAffinity 35
+#define SYS_gangJoin 36
+#define SYS_setRealtime 37
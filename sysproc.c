@@ -97,9 +97,7 @@ sys_setTicket(void)
   if(argint(0, &ticketNum) < 0)
     return -1; 
 
-  struct proc *p = myproc();
-  p->mlfq.lotteryTicket = ticketNum;
-  return 0;
+  return setProcTicket(ticketNum);
 }
 
 int 
@@ -146,4 +144,140 @@ int
 sys_printInfo(void)
 {
   return printInfo();
-}
\ No newline at end of file
+}
+
+int
+sys_configQueues(void)
+{
+  int n;
+  int *classes;
+
+  if(argint(0, &n) < 0)
+    return -1;
+  if(n < 1 || n >= NQUEUE)
+    return -1;
+  if(argptr(1, (void*)&classes, n*sizeof(classes[0])) < 0)
+    return -1;
+  return configQueues(n, classes);
+}
+
+int
+sys_setQuantum(void)
+{
+  int queue, n;
+
+  if(argint(0, &queue) < 0)
+    return -1;
+  if(argint(1, &n) < 0)
+    return -1;
+  return setQuantum(queue, n);
+}
+
+int
+sys_getSchedStat(void)
+{
+  struct schedstat *st;
+
+  if(argptr(0, (void*)&st, sizeof(*st)) < 0)
+    return -1;
+  getSchedStat(st);
+  return 0;
+}
+
+int
+sys_schedTrace(void)
+{
+  struct schedevent *buf;
+  int n;
+
+  if(argint(1, &n) < 0 || n < 0)
+    return -1;
+  // No more than the rings hold, which also keeps
+  // the size below from overflowing.
+  if(n > NCPU*NTRACE)
+    n = NCPU*NTRACE;
+  if(argptr(0, (void*)&buf, n*sizeof(*buf)) < 0)
+    return -1;
+  return schedTrace(buf, n);
+}
+
+int
+sys_schedSeed(void)
+{
+  int seed;
+
+  if(argint(0, &seed) < 0)
+    return -1;
+  schedSeed(seed);
+  return 0;
+}
+
+int
+sys_setSchedAttr(void)
+{
+  struct schedattr *a;
+  int *pids;
+  int n;
+
+  if(argint(1, &n) < 0 || n < 1 || n > NPROC)
+    return -1;
+  if(argptr(0, (void*)&pids, n*sizeof(*pids)) < 0)
+    return -1;
+  if(argptr(2, (void*)&a, sizeof(*a)) < 0)
+    return -1;
+  return setSchedAttr(pids, n, a);
+}
+
+int
+sys_getSchedAttr(void)
+{
+  struct schedattr *a;
+  int pid;
+
+  if(argint(0, &pid) < 0)
+    return -1;
+  if(argptr(1, (void*)&a, sizeof(*a)) < 0)
+    return -1;
+  return getSchedAttr(pid, a);
+}
+
+int
+sys_setAffinity(void)
+{
+  int pid, mask;
+
+  if(argint(0, &pid) < 0 || argint(1, &mask) < 0)
+    return -1;
+  return setAffinity(pid, mask);
+}
+
+int
+sys_getAffinity(void)
+{
+  int pid;
+
+  if(argint(0, &pid) < 0)
+    return -1;
+  return getAffinity(pid);
+}
+
+int
+sys_gangJoin(void)
+{
+  int id;
+
+  if(argint(0, &id) < 0)
+    return -1;
+  return gangJoin(id);
+}
+
+int
+sys_setRealtime(void)
+{
+  int pid, runtime, period, deadline;
+
+  if(argint(0, &pid) < 0 || argint(1, &runtime) < 0 ||
+     argint(2, &period) < 0 || argint(3, &deadline) < 0)
+    return -1;
+  return setRealtime(pid, runtime, period, deadline);
+}
@@ -0,0 +1,99 @@
+// Scheduler event trace.
+//
+// Each CPU appends events to its own ring with interrupts off,
+// so recording takes no lock: the CPU is the only writer of its
+// ring's head, and schedTrace() the only reader, advancing the
+// tail. When a ring is full new events are dropped and counted.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "mmu.h"
+#include "x86.h"
+#include "proc.h"
+#include "spinlock.h"
+
+struct tracering {
+  struct schedevent ev[NTRACE];
+  volatile uint head;          // Next slot the CPU writes
+  volatile uint tail;          // Next slot the reader drains
+  uint dropped;                // Events lost to a full ring
+};
+
+static struct tracering rings[NCPU];
+static struct spinlock drainlock;  // Serializes readers only
+
+void
+traceinit(void)
+{
+  initlock(&drainlock, "trace");
+}
+
+// Record an event about p on this CPU.
+void
+traceevent(int type, struct proc *p, int arg, int reason)
+{
+  struct tracering *r;
+  struct schedevent *e;
+  uint64 tsc;
+
+  pushcli();
+  r = &rings[cpuid()];
+  if(r->head - r->tail >= NTRACE){
+    r->dropped++;
+    popcli();
+    return;
+  }
+  e = &r->ev[r->head % NTRACE];
+  tsc = rdtsc();
+  e->tsclo = (uint)tsc;
+  e->tschi = (uint)(tsc >> 32);
+  e->tick = ticks;
+  e->pid = p->pid;
+  e->arg = arg;
+  e->cpu = cpuid();
+  e->type = type;
+  e->queue = p->mlfq.queueNumber;
+  e->reason = reason;
+  // The event must be complete before the reader can see it.
+  __sync_synchronize();
+  r->head++;
+  popcli();
+}
+
+// Events lost so far because a ring was full.
+int
+tracedropped(void)
+{
+  struct tracering *r;
+  int n = 0;
+
+  for(r = rings; r < &rings[ncpu]; r++)
+    n += r->dropped;
+  return n;
+}
+
+// Move up to n buffered events, oldest first per CPU, into buf.
+// Returns the number of events copied.
+int
+schedTrace(struct schedevent *buf, int n)
+{
+  struct tracering *r;
+  uint head;
+  int got;
+
+  got = 0;
+  acquire(&drainlock);
+  for(r = rings; r < &rings[ncpu] && got < n; r++){
+    head = r->head;
+    __sync_synchronize();
+    while(r->tail != head && got < n){
+      buf[got++] = r->ev[r->tail % NTRACE];
+      // Done reading the slot before handing it back.
+      __sync_synchronize();
+      r->tail++;
+    }
+  }
+  release(&drainlock);
+  return got;
+}
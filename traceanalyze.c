@@ -0,0 +1,348 @@
+// Host-side analyzer for scheduler traces.
+// Reads a file written by schedtrace out of an xv6 fs.img and
+// prints a per-process timeline and dispatch latency figures.
+// usage: traceanalyze fs.img file [-t]
+
+#include <stdio.h>
+#include <unistd.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+
+#define stat xv6_stat  // avoid clash with host struct stat
+#include "types.h"
+#include "fs.h"
+#include "param.h"
+#include "sched.h"
+
+int fsfd;
+struct superblock sb;
+
+struct event {
+  uint64 tsc;
+  struct schedevent e;
+};
+
+struct event *ev;
+int nev;
+
+// Per-pid state while walking the trace.
+struct pstat {
+  int pid;
+  int dispatches;
+  uint64 runcycles;            // Summed dispatch-to-desched cycles
+  uint runticks;
+  uint64 runstart;             // tsc of the open dispatch, or 0
+  uint tickstart;
+  int readycpu;                // A wakeup or fork is waiting, or -1
+  uint64 readytsc;
+  uint readytick;
+};
+
+struct pstat *ps;
+int nps;
+
+uint64 *latcyc;                // Ready-to-dispatch samples
+uint *lattick;
+int nlat;
+
+void
+rsect(uint sec, void *buf)
+{
+  if(lseek(fsfd, sec * BSIZE, 0) != sec * BSIZE){
+    perror("lseek");
+    exit(1);
+  }
+  if(read(fsfd, buf, BSIZE) != BSIZE){
+    perror("read");
+    exit(1);
+  }
+}
+
+void
+rinode(uint inum, struct dinode *ip)
+{
+  char buf[BSIZE];
+
+  rsect(IBLOCK(inum, sb), buf);
+  *ip = ((struct dinode*)buf)[inum % IPB];
+}
+
+// Disk block holding byte off of the file, or 0 if none.
+uint
+bmap(struct dinode *ip, uint off)
+{
+  uint bn = off / BSIZE;
+  uint indirect[NINDIRECT];
+
+  if(bn < NDIRECT)
+    return ip->addrs[bn];
+  bn -= NDIRECT;
+  if(bn >= NINDIRECT || ip->addrs[NDIRECT] == 0)
+    return 0;
+  rsect(ip->addrs[NDIRECT], (char*)indirect);
+  return indirect[bn];
+}
+
+// Read the whole file into a fresh buffer.
+char*
+readfile(struct dinode *ip)
+{
+  char *data, buf[BSIZE];
+  uint off, b, n;
+
+  data = malloc(ip->size + 1);
+  for(off = 0; off < ip->size; off += n){
+    n = BSIZE - off % BSIZE;
+    if(n > ip->size - off)
+      n = ip->size - off;
+    if((b = bmap(ip, off)) == 0)
+      memset(data + off, 0, n);
+    else {
+      rsect(b, buf);
+      memmove(data + off, buf + off % BSIZE, n);
+    }
+  }
+  return data;
+}
+
+// Inode number of name in the root directory, or 0.
+uint
+lookup(char *name)
+{
+  struct dinode root;
+  struct dirent *de;
+  char *dir;
+  uint i, inum;
+
+  rinode(ROOTINO, &root);
+  dir = readfile(&root);
+  inum = 0;
+  for(i = 0; i + sizeof(*de) <= root.size; i += sizeof(*de)){
+    de = (struct dirent*)(dir + i);
+    if(de->inum != 0 && strncmp(de->name, name, DIRSIZ) == 0){
+      inum = de->inum;
+      break;
+    }
+  }
+  free(dir);
+  return inum;
+}
+
+int
+evcmp(const void *a, const void *b)
+{
+  const struct event *x = a, *y = b;
+
+  if(x->tsc != y->tsc)
+    return x->tsc < y->tsc ? -1 : 1;
+  return 0;
+}
+
+int
+cyccmp(const void *a, const void *b)
+{
+  uint64 x = *(const uint64*)a, y = *(const uint64*)b;
+
+  return x < y ? -1 : x > y;
+}
+
+int
+tickcmp(const void *a, const void *b)
+{
+  uint x = *(const uint*)a, y = *(const uint*)b;
+
+  return x < y ? -1 : x > y;
+}
+
+struct pstat*
+findpstat(int pid)
+{
+  int i;
+
+  for(i = 0; i < nps; i++)
+    if(ps[i].pid == pid)
+      return &ps[i];
+  ps = realloc(ps, (nps+1) * sizeof(*ps));
+  memset(&ps[nps], 0, sizeof(*ps));
+  ps[nps].pid = pid;
+  ps[nps].readycpu = -1;
+  return &ps[nps++];
+}
+
+char*
+evname(int type)
+{
+  static char *names[] = {
+  [EV_DISPATCH] "dispatch",
+  [EV_DESCHED]  "desched",
+  [EV_WAKEUP]   "wakeup",
+  [EV_QUEUE]    "queue",
+  [EV_TICKET]   "ticket",
+  [EV_PRIORITY] "priority",
+  [EV_FORK]     "fork",
+  };
+
+  if(type <= 0 || type >= sizeof(names)/sizeof(names[0]) || names[type] == 0)
+    return "?";
+  return names[type];
+}
+
+char*
+reasonname(int reason)
+{
+  static char *names[] = {
+  [EVR_PREEMPT] "preempt",
+  [EVR_SLEEP]   "sleep",
+  [EVR_EXIT]    "exit",
+  [EVR_MANUAL]  "manual",
+  [EVR_DEMOTE]  "demote",
+  [EVR_PROMOTE] "promote",
+  [EVR_AGE]     "age",
+  };
+
+  if(reason <= 0 || reason >= sizeof(names)/sizeof(names[0]) || names[reason] == 0)
+    return "";
+  return names[reason];
+}
+
+// Print every event of pid relative to the first event in the trace.
+void
+timeline(int pid)
+{
+  struct event *e;
+  int i;
+
+  printf("pid %d:\n", pid);
+  for(i = 0; i < nev; i++){
+    e = &ev[i];
+    if(e->e.pid != pid)
+      continue;
+    printf("  %12llu  tick %6u  cpu %u  q%u  %-8s %s",
+           (unsigned long long)(e->tsc - ev[0].tsc), e->e.tick, e->e.cpu,
+           e->e.queue, evname(e->e.type), reasonname(e->e.reason));
+    if(e->e.type == EV_QUEUE || e->e.type == EV_TICKET ||
+       e->e.type == EV_PRIORITY || e->e.type == EV_FORK)
+      printf(" %d", e->e.arg);
+    printf("\n");
+  }
+}
+
+int
+main(int argc, char *argv[])
+{
+  struct dinode din;
+  struct schedevent *raw;
+  struct pstat *p;
+  struct event *e;
+  char buf[BSIZE];
+  uint inum;
+  uint64 cycsum;
+  uint ticksum;
+  int i, showtimeline;
+
+  if(argc < 3){
+    fprintf(stderr, "Usage: traceanalyze fs.img file [-t]\n");
+    exit(1);
+  }
+  showtimeline = argc > 3 && strcmp(argv[3], "-t") == 0;
+
+  fsfd = open(argv[1], O_RDONLY);
+  if(fsfd < 0){
+    perror(argv[1]);
+    exit(1);
+  }
+  rsect(1, buf);
+  memmove(&sb, buf, sizeof(sb));
+
+  if((inum = lookup(argv[2])) == 0){
+    fprintf(stderr, "traceanalyze: no %s in %s\n", argv[2], argv[1]);
+    exit(1);
+  }
+  rinode(inum, &din);
+  raw = (struct schedevent*)readfile(&din);
+  nev = din.size / sizeof(struct schedevent);
+  if(nev == 0){
+    printf("no events\n");
+    exit(0);
+  }
+
+  // Each CPU's ring drains in order, but the CPUs interleave,
+  // so put the whole trace in time-stamp order first.
+  ev = malloc(nev * sizeof(*ev));
+  for(i = 0; i < nev; i++){
+    ev[i].e = raw[i];
+    ev[i].tsc = ((uint64)raw[i].tschi << 32) | raw[i].tsclo;
+  }
+  qsort(ev, nev, sizeof(*ev), evcmp);
+
+  latcyc = malloc(nev * sizeof(*latcyc));
+  lattick = malloc(nev * sizeof(*lattick));
+  for(i = 0; i < nev; i++){
+    e = &ev[i];
+    p = findpstat(e->e.pid);
+    switch(e->e.type){
+    case EV_WAKEUP:
+    case EV_FORK:
+      p->readycpu = e->e.cpu;
+      p->readytsc = e->tsc;
+      p->readytick = e->e.tick;
+      break;
+    case EV_DISPATCH:
+      p->dispatches++;
+      p->runstart = e->tsc;
+      p->tickstart = e->e.tick;
+      if(p->readycpu >= 0){
+        latcyc[nlat] = e->tsc - p->readytsc;
+        lattick[nlat] = e->e.tick - p->readytick;
+        nlat++;
+        p->readycpu = -1;
+      }
+      break;
+    case EV_DESCHED:
+      if(p->runstart){
+        p->runcycles += e->tsc - p->runstart;
+        p->runticks += e->e.tick - p->tickstart;
+        p->runstart = 0;
+      }
+      break;
+    }
+  }
+
+  printf("%d events over %u ticks, %llu cycles\n", nev,
+         ev[nev-1].e.tick - ev[0].e.tick,
+         (unsigned long long)(ev[nev-1].tsc - ev[0].tsc));
+  printf("pid  dispatches  runticks     runcycles  cycles/dispatch\n");
+  for(i = 0; i < nps; i++){
+    p = &ps[i];
+    printf("%-4d %10d  %8u  %12llu  %15llu\n", p->pid, p->dispatches,
+           p->runticks, (unsigned long long)p->runcycles,
+           (unsigned long long)(p->dispatches ? p->runcycles / p->dispatches : 0));
+  }
+
+  if(nlat > 0){
+    cycsum = 0;
+    ticksum = 0;
+    for(i = 0; i < nlat; i++){
+      cycsum += latcyc[i];
+      ticksum += lattick[i];
+    }
+    qsort(latcyc, nlat, sizeof(*latcyc), cyccmp);
+    qsort(lattick, nlat, sizeof(*lattick), tickcmp);
+    printf("wakeup-to-dispatch latency, %d samples:\n", nlat);
+    printf("  ticks   mean %u.%02u  p99 %u  max %u\n",
+           ticksum / nlat, ticksum * 100 / nlat % 100,
+           lattick[nlat * 99 / 100], lattick[nlat-1]);
+    printf("  cycles  mean %llu  p99 %llu  max %llu\n",
+           (unsigned long long)(cycsum / nlat),
+           (unsigned long long)latcyc[nlat * 99 / 100],
+           (unsigned long long)latcyc[nlat-1]);
+  }
+
+  if(showtimeline)
+    for(i = 0; i < nps; i++)
+      timeline(ps[i].pid);
+
+  free(raw);
+  exit(0);
+}
@@ -43,6 +43,9 @@ trap(struct trapframe *tf)
     syscall();
     if(myproc()->killed)
       exit();
+    // Let a process the call woke preempt this one.
+    if(takeresched())
+      yield();
     return;
   }
 
@@ -53,6 +56,7 @@ trap(struct trapframe *tf)
       ticks++;
       wakeup(&ticks);
       release(&tickslock);
+      schedclock();
     }
     lapiceoi();
     break;
@@ -71,6 +75,11 @@ trap(struct trapframe *tf)
     uartintr();
     lapiceoi();
     break;
+  case T_IRQ0 + IRQ_RESCHED:
+    // Another CPU queued work for an idle scheduler here;
+    // taking the interrupt is enough to leave hlt.
+    lapiceoi();
+    break;
   case T_IRQ0 + 7:
   case T_IRQ0 + IRQ_SPURIOUS:
     cprintf("cpu%d: spurious interrupt at %x:%x\n",
@@ -100,10 +109,14 @@ trap(struct trapframe *tf)
   if(myproc() && myproc()->killed && (tf->cs&3) == DPL_USER)
     exit();
 
-  // Force process to give up CPU on clock tick.
+  // Force process to give up CPU once its time slice is over.
   // If interrupts were on while locks held, would need to check nlock.
   if(myproc() && myproc()->state == RUNNING &&
-     tf->trapno == T_IRQ0+IRQ_TIMER)
+     tf->trapno == T_IRQ0+IRQ_TIMER && schedtick())
+    yield();
+
+  // Or early, if a process on a higher queue woke up.
+  if(myproc() && myproc()->state == RUNNING && takeresched())
     yield();
 
   // Check if the process has been killed since we yielded
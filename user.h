@@ -1,5 +1,8 @@
 struct stat;
 struct rtcdate;
+struct schedattr;
+struct schedstat;
+struct schedevent;
 
 // system calls
 int fork(void);
@@ -28,6 +31,17 @@ int changeQueue(int, int);
 int setLotteryTicket(int, int);
 int setSRPFPriority(int, char*);
 int printInfo(void);
+int configQueues(int, int*);
+int setQuantum(int, int);
+int getSchedStat(struct schedstat*);
+int schedTrace(struct schedevent*, int);
+int schedSeed(uint);
+int setSchedAttr(int*, int, struct schedattr*);
+int getSchedAttr(int, struct schedattr*);
+int setAffinity(int, uint);
+int getAffinity(int);
+int gangJoin(int);
+int setRealtime(int, int, int, int);
 
 // ulib.c
 int stat(const char*, struct stat*);